@@ -0,0 +1,19 @@
+# Copyright (c) 2019 The STE||AR-Group
+#
+# Distributed under the Boost Software License, Version 1.0. (See accompanying
+# file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+# The built-in vector packs (hpx::parallel::simd::pack) do not depend on any
+# external library. Their width follows the instruction set the code is
+# compiled for (e.g. -march=native), without vector extensions of the
+# target architecture they hold a single element.
+
+if(NOT (CMAKE_CXX_COMPILER_ID STREQUAL "GNU" OR
+        CMAKE_CXX_COMPILER_ID MATCHES "Clang"))
+  hpx_warn("The built-in vector packs use plain loops if the compiler does not support GCC vector extensions")
+endif()
+
+hpx_add_config_define(HPX_HAVE_DATAPAR)
+hpx_add_config_define(HPX_HAVE_DATAPAR_BUILTIN)
+
+hpx_info("Using built-in vector packs (vectorization)")
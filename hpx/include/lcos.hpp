@@ -15,14 +15,26 @@
 
 #include <hpx/lcos/packaged_action.hpp>
 
+#include <hpx/lcos/all_gather.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/all_to_all.hpp>
 #include <hpx/lcos/barrier.hpp>
+#include <hpx/lcos/buffered_send_channel.hpp>
 #include <hpx/lcos/channel.hpp>
+#include <hpx/lcos/combining_latch.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/communicator_collectives.hpp>
+#include <hpx/lcos/dissemination_barrier.hpp>
+#include <hpx/lcos/distributed_task_pool.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
 #include <hpx/lcos/gather.hpp>
 #include <hpx/lcos/latch.hpp>
+#include <hpx/lcos/pipelined_broadcast.hpp>
 #if defined(HPX_HAVE_QUEUE_COMPATIBILITY)
 #include <hpx/lcos/queue.hpp>
 #endif
 #include <hpx/lcos/reduce.hpp>
+#include <hpx/lcos/scan.hpp>
 
 #include <hpx/include/async.hpp>
 #include <hpx/include/dataflow.hpp>
@@ -9,6 +9,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/dataflow.hpp>
+#include <hpx/lcos/local/async_mutex.hpp>
+#include <hpx/lcos/local/async_semaphore.hpp>
 #include <hpx/lcos/local/barrier.hpp>
 #include <hpx/lcos/local/channel.hpp>
 #include <hpx/lcos/local/condition_variable.hpp>
@@ -20,6 +22,7 @@
 #include <hpx/lcos/local/recursive_mutex.hpp>
 #include <hpx/lcos/local/shared_mutex.hpp>
 #include <hpx/lcos/local/sliding_semaphore.hpp>
+#include <hpx/lcos/local/task_graph.hpp>
 
 #include <hpx/lcos/future.hpp>
 #include <hpx/lcos/local/and_gate.hpp>
@@ -7,6 +7,7 @@
 #define HPX_PARALLEL_FOR_LOOP_MAR_04_2016_0654PM
 
 #include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/algorithms/for_loop_tiled.hpp>
 
 #endif
 
@@ -0,0 +1,11 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_INCLUDE_PARALLEL_VIEW_HPP)
+#define HPX_INCLUDE_PARALLEL_VIEW_HPP
+
+#include <hpx/parallel/view.hpp>
+
+#endif
@@ -0,0 +1,108 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/all_gather.hpp
+
+#if !defined(HPX_LCOS_ALL_GATHER_HPP)
+#define HPX_LCOS_ALL_GATHER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Bruck's algorithm: in round k each site sends all values it has
+        // collected so far (up to 2^k of them) to the site 2^k positions to
+        // its left and receives the same number of values from the site 2^k
+        // positions to its right. All values are available after
+        // ceil(log2(N)) rounds, for any number of sites.
+        template <typename T>
+        std::vector<T> all_gather_bruck(communicator comm,
+            std::size_t generation, T value)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+
+            // blocks[i] holds the value of site (this_site + i) % num_sites
+            std::vector<T> blocks;
+            blocks.reserve(num_sites);
+            blocks.push_back(std::move(value));
+
+            std::vector<hpx::future<void> > sends;
+
+            std::size_t tag = 0;
+            for (std::size_t dist = 1; dist < num_sites; dist *= 2, ++tag)
+            {
+                std::size_t const count = (std::min)(dist, num_sites - dist);
+                std::size_t const to = (this_site + num_sites - dist) % num_sites;
+                std::size_t const from = (this_site + dist) % num_sites;
+
+                sends.push_back(comm.send(to, generation, tag,
+                    serialize_range(blocks.data(), count)));
+
+                std::size_t const size = blocks.size();
+                blocks.resize(size + count);
+                deserialize_range(comm.receive(from, generation, tag).get(),
+                    blocks.data() + size, count);
+            }
+
+            for (hpx::future<void>& f : sends)
+                f.get();
+
+            // undo the rotation
+            std::rotate(blocks.begin(), blocks.begin() + (num_sites - this_site),
+                blocks.end());
+            return blocks;
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// AllGather a set of values from different call sites
+    ///
+    /// This function collects the values given by all sites of the given
+    /// communicator and makes them available to all sites. It uses Bruck's
+    /// algorithm, which finishes after ceil(log2(N)) rounds of messages.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_result The value contributed by this site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding a vector with the
+    ///             values of all sites, ordered by the sequence numbers of
+    ///             the sites. It will become ready once the all_gather
+    ///             operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<typename util::decay<T>::type> >
+    all_gather(communicator& comm, T && local_result,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<T>::type value_type;
+
+        return hpx::async(&detail::all_gather_bruck<value_type>,
+            comm, comm.next_generation(generation),
+            std::forward<T>(local_result));
+    }
+}}
+
+#endif
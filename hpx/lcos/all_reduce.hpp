@@ -0,0 +1,328 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/all_reduce.hpp
+
+#if !defined(HPX_LCOS_ALL_REDUCE_HPP)
+#define HPX_LCOS_ALL_REDUCE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // the tag of the message handing the result to a folded site
+        static std::size_t const all_reduce_result_tag = std::size_t(-1);
+
+        // wait for the given messages to be delivered, propagating errors
+        inline void wait_for_sends(std::vector<hpx::future<void> >& sends)
+        {
+            for (hpx::future<void>& f : sends)
+                f.get();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Recursive doubling: in round k each site exchanges its partial
+        // result with the site whose (renumbered) sequence number differs in
+        // bit k. The partial results always cover a contiguous range of
+        // sites, which allows for non-commutative operations.
+        //
+        // If the number of sites is not a power of two, the surplus sites
+        // first hand their value to their right neighbor and receive the
+        // result from it in the end.
+        template <typename T, typename F>
+        T all_reduce_recursive_doubling(communicator comm,
+            std::size_t generation, T value, F op)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+            if (num_sites == 1)
+                return value;
+
+            std::size_t pof2 = 1;
+            while (2 * pof2 <= num_sites)
+                pof2 *= 2;
+            std::size_t const rem = num_sites - pof2;
+
+            std::vector<hpx::future<void> > sends;
+
+            bool const folded = this_site < 2 * rem && this_site % 2 == 0;
+            if (folded)
+            {
+                sends.push_back(comm.send(this_site + 1, generation, 0,
+                    serialize_value(value)));
+
+                value = deserialize_value<T>(comm.receive(this_site + 1,
+                    generation, all_reduce_result_tag).get());
+            }
+            else
+            {
+                if (this_site < 2 * rem)
+                {
+                    T lhs = deserialize_value<T>(
+                        comm.receive(this_site - 1, generation, 0).get());
+                    value = op(std::move(lhs), std::move(value));
+                }
+
+                std::size_t const site = this_site < 2 * rem ?
+                    this_site / 2 : this_site - rem;
+
+                std::size_t tag = 1;
+                for (std::size_t mask = 1; mask < pof2; mask <<= 1, ++tag)
+                {
+                    std::size_t const partner_site = site ^ mask;
+                    std::size_t const partner = partner_site < rem ?
+                        2 * partner_site + 1 : partner_site + rem;
+
+                    sends.push_back(comm.send(partner, generation, tag,
+                        serialize_value(value)));
+
+                    T other = deserialize_value<T>(
+                        comm.receive(partner, generation, tag).get());
+
+                    if (partner < this_site)
+                        value = op(std::move(other), std::move(value));
+                    else
+                        value = op(std::move(value), std::move(other));
+                }
+
+                if (this_site < 2 * rem)
+                {
+                    sends.push_back(comm.send(this_site - 1, generation,
+                        all_reduce_result_tag, serialize_value(value)));
+                }
+            }
+
+            wait_for_sends(sends);
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The arrays reduced by the ring algorithms are split into one chunk
+        // per site.
+        inline std::size_t chunk_begin(std::size_t size, std::size_t num_sites,
+            std::size_t chunk)
+        {
+            return chunk * size / num_sites;
+        }
+
+        inline std::size_t chunk_size(std::size_t size, std::size_t num_sites,
+            std::size_t chunk)
+        {
+            return chunk_begin(size, num_sites, chunk + 1) -
+                chunk_begin(size, num_sites, chunk);
+        }
+
+        // Reduce-scatter: every site passes a chunk to its right neighbor and
+        // combines the chunk received from its left neighbor with its own
+        // data (in place, directly from the receive buffer). Afterwards site
+        // i owns the fully reduced chunk (i + 1) % N. This uses the tags
+        // 0 ... N - 2.
+        template <typename T, typename F>
+        void reduce_scatter_ring(communicator const& comm,
+            std::size_t generation, std::vector<T>& data, F& op,
+            std::vector<hpx::future<void> >& sends)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+            std::size_t const size = data.size();
+            std::size_t const right = (this_site + 1) % num_sites;
+            std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+            for (std::size_t step = 0; step != num_sites - 1; ++step)
+            {
+                std::size_t const send_chunk =
+                    (this_site + num_sites - step) % num_sites;
+                std::size_t const recv_chunk =
+                    (this_site + 2 * num_sites - step - 1) % num_sites;
+
+                sends.push_back(comm.send(right, generation, step,
+                    serialize_range(
+                        data.data() + chunk_begin(size, num_sites, send_chunk),
+                        chunk_size(size, num_sites, send_chunk))));
+
+                combine_elements(
+                    data.data() + chunk_begin(size, num_sites, recv_chunk),
+                    comm.receive(left, generation, step).get(),
+                    chunk_size(size, num_sites, recv_chunk), op);
+            }
+        }
+
+        // Ring algorithm: a reduce-scatter followed by an all-gather phase
+        // passing the reduced chunks around the ring. Every site sends and
+        // receives 2 * (N - 1) / N times the data, independently of the
+        // number of sites.
+        template <typename T, typename F>
+        std::vector<T> all_reduce_ring(communicator comm,
+            std::size_t generation, std::vector<T> data, F op)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+            if (num_sites == 1)
+                return data;
+
+            std::size_t const size = data.size();
+            std::size_t const right = (this_site + 1) % num_sites;
+            std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+            std::vector<hpx::future<void> > sends;
+            sends.reserve(2 * (num_sites - 1));
+
+            reduce_scatter_ring(comm, generation, data, op, sends);
+
+            for (std::size_t step = 0; step != num_sites - 1; ++step)
+            {
+                std::size_t const send_chunk =
+                    (this_site + num_sites + 1 - step) % num_sites;
+                std::size_t const recv_chunk =
+                    (this_site + num_sites - step) % num_sites;
+                std::size_t const tag = num_sites - 1 + step;
+
+                sends.push_back(comm.send(right, generation, tag,
+                    serialize_range(
+                        data.data() + chunk_begin(size, num_sites, send_chunk),
+                        chunk_size(size, num_sites, send_chunk))));
+
+                deserialize_range(
+                    comm.receive(left, generation, tag).get(),
+                    data.data() + chunk_begin(size, num_sites, recv_chunk),
+                    chunk_size(size, num_sites, recv_chunk));
+            }
+
+            wait_for_sends(sends);
+            return data;
+        }
+
+        // the minimal size (in bytes) of the data reduced using the ring
+        // algorithm
+        inline std::size_t get_all_reduce_ring_threshold()
+        {
+            static std::size_t const threshold =
+                hpx::util::safe_lexical_cast<std::size_t>(get_config_entry(
+                    "hpx.lcos.collectives.all_reduce_ring_threshold", 65536),
+                    std::size_t(65536));
+            return threshold;
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function combines the values given by all sites of the given
+    /// communicator using the given binary operation and makes the result
+    /// available to all sites. It uses recursive doubling, which finishes
+    /// after log2(N) rounds of message exchanges between pairs of sites,
+    /// without funneling the data through a root site.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_result The value contributed by this site.
+    /// \param  op          The binary operation used to combine the values.
+    ///                     It has to be associative, the values are always
+    ///                     combined in the order of the sites.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the combined value.
+    ///             It will become ready once the all_reduce operation has
+    ///             been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<typename util::decay<T>::type>
+    all_reduce(communicator& comm, T && local_result, F && op,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<T>::type value_type;
+        typedef typename util::decay<F>::type op_type;
+
+        return hpx::async(
+            &detail::all_reduce_recursive_doubling<value_type, op_type>,
+            comm, comm.next_generation(generation),
+            std::forward<T>(local_result), std::forward<F>(op));
+    }
+
+    /// AllReduce arrays of values from different call sites element by
+    /// element
+    ///
+    /// This function combines the elements with the same index of the arrays
+    /// given by all sites of the given communicator using the given binary
+    /// operation and makes the resulting array available to all sites. All
+    /// sites have to contribute arrays of the same size.
+    ///
+    /// Small arrays are combined using recursive doubling (see above). Large
+    /// arrays (at least hpx.lcos.collectives.all_reduce_ring_threshold bytes,
+    /// 64kB by default) are combined using a ring algorithm (reduce-scatter
+    /// followed by an all-gather), where every site sends and receives about
+    /// twice the size of the array, independently of the number of sites.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_result The array contributed by this site.
+    /// \param  op          The binary operation used to combine the elements.
+    ///                     It has to be associative and commutative. The
+    ///                     operations defined in hpx::lcos::reduction (plus,
+    ///                     multiplies, minimum, maximum) are applied to whole
+    ///                     vector packs for arithmetic types if datapar
+    ///                     support is available. The received elements are
+    ///                     combined in place, without copying them out of the
+    ///                     receive buffer.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the combined array.
+    ///             It will become ready once the all_reduce operation has
+    ///             been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T> >
+    all_reduce_elements(communicator& comm, std::vector<T> local_result,
+        F && op, std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<F>::type op_type;
+
+        generation = comm.next_generation(generation);
+
+        if (local_result.size() >= comm.num_sites() &&
+            local_result.size() * sizeof(T) >=
+                detail::get_all_reduce_ring_threshold())
+        {
+            return hpx::async(&detail::all_reduce_ring<T, op_type>,
+                comm, generation, std::move(local_result),
+                std::forward<F>(op));
+        }
+
+        detail::elementwise_op<op_type> elementwise = { std::forward<F>(op) };
+        return hpx::async(
+            &detail::all_reduce_recursive_doubling<
+                std::vector<T>, detail::elementwise_op<op_type> >,
+            comm, generation, std::move(local_result), std::move(elementwise));
+    }
+}}
+
+#endif
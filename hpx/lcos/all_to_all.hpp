@@ -0,0 +1,206 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/all_to_all.hpp
+
+#if !defined(HPX_LCOS_ALL_TO_ALL_HPP)
+#define HPX_LCOS_ALL_TO_ALL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        struct all_to_all_value
+        {
+            static communicator::buffer_type serialize(T const& value)
+            {
+                return serialize_value(value);
+            }
+
+            static T deserialize(communicator::buffer_type const& data)
+            {
+                return deserialize_value<T>(data);
+            }
+        };
+
+        template <typename T>
+        struct all_to_all_value<std::vector<T> >
+        {
+            static communicator::buffer_type serialize(
+                std::vector<T> const& value)
+            {
+                return serialize_vector(value);
+            }
+
+            static std::vector<T> deserialize(
+                communicator::buffer_type const& data)
+            {
+                return deserialize_vector<T>(data);
+            }
+        };
+
+        template <typename T, typename Allocator>
+        struct all_to_all_value<
+            serialization::serialize_buffer<T, Allocator> >
+        {
+            static communicator::buffer_type serialize(
+                serialization::serialize_buffer<T, Allocator> const& value)
+            {
+                return as_message(value);
+            }
+
+            static serialization::serialize_buffer<T, Allocator> deserialize(
+                communicator::buffer_type const& data)
+            {
+                return from_message<T, Allocator>(data);
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Pairwise exchange: in step s every site sends to one site and
+        // receives from another one, such that each site receives exactly
+        // one message per step. If the number of sites is a power of two
+        // the sites exchange their data pairwise (site ^ s), otherwise each
+        // site sends to the site s positions to its right and receives from
+        // the site s positions to its left. This avoids all sites sending to
+        // the same destination at the same time.
+        template <typename T, typename Result>
+        std::vector<Result> all_to_all_pairwise(communicator comm,
+            std::size_t generation, std::vector<T> data)
+        {
+            typedef all_to_all_value<T> value_type;
+
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+
+            // throwing here would leave the other sites waiting for the
+            // messages of this site
+            HPX_ASSERT(data.size() == num_sites);
+
+            bool const pairwise = (num_sites & (num_sites - 1)) == 0;
+
+            std::vector<Result> result(num_sites);
+            result[this_site] = std::move(data[this_site]);
+
+            std::vector<hpx::future<void> > sends;
+            sends.reserve(num_sites - 1);
+
+            for (std::size_t step = 1; step != num_sites; ++step)
+            {
+                std::size_t const to = pairwise ? (this_site ^ step) :
+                    (this_site + step) % num_sites;
+                std::size_t const from = pairwise ? (this_site ^ step) :
+                    (this_site + num_sites - step) % num_sites;
+
+                sends.push_back(comm.send(to, generation, step,
+                    value_type::serialize(data[to])));
+
+                result[from] = value_type::deserialize(
+                    comm.receive(from, generation, step).get());
+            }
+
+            for (hpx::future<void>& f : sends)
+                f.get();
+
+            return result;
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Exchange one value between each pair of call sites
+    ///
+    /// Every site of the given communicator sends the value local_result[i]
+    /// to the site i and receives one value from every site. The exchange is
+    /// scheduled such that every site receives one message per step.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_result The values to send, one per site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \note       The size of \a local_result has to be equal to the
+    ///             number of sites of the communicator on every site. This
+    ///             is not checked in release builds.
+    ///
+    /// \returns    This function returns a future holding a vector with the
+    ///             values received from all sites, ordered by the sequence
+    ///             numbers of the sites. It will become ready once the
+    ///             all_to_all operation has been completed.
+    ///
+    template <typename T>
+    hpx::future<std::vector<T> >
+    all_to_all(communicator& comm, std::vector<T> local_result,
+        std::size_t generation = std::size_t(-1))
+    {
+        return hpx::async(&detail::all_to_all_pairwise<T, T>,
+            comm, comm.next_generation(generation), std::move(local_result));
+    }
+
+    /// Exchange arrays of different sizes between each pair of call sites
+    ///
+    /// This is the same as all_to_all, except that the arrays sent to the
+    /// different sites may have different sizes.
+    ///
+    /// \returns    This function returns a future holding a vector with the
+    ///             arrays received from all sites, ordered by the sequence
+    ///             numbers of the sites.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::vector<T> > >
+    all_to_all_v(communicator& comm,
+        std::vector<std::vector<T> > local_result,
+        std::size_t generation = std::size_t(-1))
+    {
+        return hpx::async(
+            &detail::all_to_all_pairwise<std::vector<T>, std::vector<T> >,
+            comm, comm.next_generation(generation), std::move(local_result));
+    }
+
+    /// Exchange buffers of different sizes between each pair of call sites
+    ///
+    /// This is the same as all_to_all_v, except that the data is passed in
+    /// serialize_buffer's, which are sent and received without copying them.
+    /// The given buffers must not be modified before the returned future
+    /// has become ready.
+    ///
+    /// \returns    This function returns a future holding a vector with the
+    ///             buffers received from all sites, ordered by the sequence
+    ///             numbers of the sites.
+    ///
+    template <typename T, typename Allocator>
+    hpx::future<std::vector<serialization::serialize_buffer<T, Allocator> > >
+    all_to_all_v(communicator& comm,
+        std::vector<
+            serialization::serialize_buffer<T, Allocator>
+        > local_result,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef serialization::serialize_buffer<T, Allocator> buffer_type;
+        return hpx::async(
+            &detail::all_to_all_pairwise<buffer_type, buffer_type>,
+            comm, comm.next_generation(generation), std::move(local_result));
+    }
+}}
+
+#endif
@@ -0,0 +1,203 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/buffered_send_channel.hpp
+
+#if !defined(HPX_LCOS_BUFFERED_SEND_CHANNEL_HPP)
+#define HPX_LCOS_BUFFERED_SEND_CHANNEL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/channel.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/interval_timer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        template <typename T>
+        class buffered_send_channel_data
+          : public std::enable_shared_from_this<buffered_send_channel_data<T> >
+        {
+            typedef lcos::local::spinlock mutex_type;
+
+        public:
+            buffered_send_channel_data(send_channel<T> const& c,
+                    std::size_t max_size)
+              : channel_(c)
+              , max_size_(max_size)
+            {
+                buffer_.reserve(max_size_);
+            }
+
+            ~buffered_send_channel_data()
+            {
+                timer_.reset();
+                flush(launch::apply);
+            }
+
+            // periodically send the values which have been buffered for too
+            // long
+            void start_timer(std::int64_t interval)
+            {
+                std::weak_ptr<buffered_send_channel_data> weak_this(
+                    this->shared_from_this());
+
+                timer_.reset(new util::interval_timer(
+                    [weak_this]() -> bool
+                    {
+                        std::shared_ptr<buffered_send_channel_data> data =
+                            weak_this.lock();
+                        if (!data)
+                            return false;
+                        data->flush(launch::apply);
+                        return true;
+                    },
+                    interval, "hpx::lcos::buffered_send_channel", true));
+                timer_->start(false);
+            }
+
+            void set(T && value)
+            {
+                std::vector<T> values;
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    buffer_.push_back(std::move(value));
+                    if (buffer_.size() < max_size_)
+                        return;
+
+                    values.reserve(max_size_);
+                    std::swap(values, buffer_);
+                }
+                channel_.set_n(launch::apply, std::move(values));
+            }
+
+            std::vector<T> take_values()
+            {
+                std::vector<T> values;
+                values.reserve(max_size_);
+
+                std::lock_guard<mutex_type> l(mtx_);
+                std::swap(values, buffer_);
+                return values;
+            }
+
+            void flush(launch::apply_policy)
+            {
+                std::vector<T> values = take_values();
+                if (!values.empty())
+                    channel_.set_n(launch::apply, std::move(values));
+            }
+
+            hpx::future<void> flush(launch::async_policy)
+            {
+                std::vector<T> values = take_values();
+                if (values.empty())
+                    return hpx::make_ready_future();
+                return channel_.set_n(launch::async, std::move(values));
+            }
+
+        private:
+            mutex_type mtx_;
+            send_channel<T> channel_;
+            std::size_t const max_size_;
+            std::vector<T> buffer_;
+            std::unique_ptr<util::interval_timer> timer_;
+        };
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A buffered_send_channel aggregates the values sent to a (usually
+    /// remote) channel on the sending side. The buffered values are sent
+    /// using a single message once \a max_size values have been collected,
+    /// once they have been buffered for \a interval microseconds, or when
+    /// flush is called, whatever happens first. All values are sent when the
+    /// last copy of the buffered_send_channel is destroyed.
+    ///
+    /// The values sent in one message arrive at the channel in the order
+    /// they were set, separate messages may be delivered in any order.
+    ///
+    /// The messages sent by a buffered_send_channel can additionally be
+    /// combined with other parcels by the coalescing message handler, see
+    /// HPX_CHANNEL_USES_MESSAGE_COALESCING.
+    template <typename T>
+    class buffered_send_channel
+    {
+        static_assert(!std::is_void<T>::value,
+            "buffered_send_channel requires a value type");
+
+    public:
+        buffered_send_channel() = default;
+
+        /// Create a buffered_send_channel sending to the given channel
+        ///
+        /// \param c        The channel the values are sent to
+        /// \param max_size The number of values collected before they are
+        ///                 sent
+        /// \param interval The time (in microseconds) after which buffered
+        ///                 values are sent, zero disables sending values
+        ///                 after a time interval.
+        explicit buffered_send_channel(send_channel<T> const& c,
+                std::size_t max_size = 64, std::int64_t interval = 1000)
+          : data_(std::make_shared<detail::buffered_send_channel_data<T> >(
+                c, max_size == 0 ? 1 : max_size))
+        {
+            if (interval > 0)
+                data_->start_timer(interval);
+        }
+
+        explicit buffered_send_channel(channel<T> const& c,
+                std::size_t max_size = 64, std::int64_t interval = 1000)
+          : buffered_send_channel(send_channel<T>(c), max_size, interval)
+        {}
+
+        /// Buffer the given value, the values are sent once the buffer is
+        /// full
+        void set(T value)
+        {
+            HPX_ASSERT(data_);
+            data_->set(std::move(value));
+        }
+
+        /// Send all buffered values
+        void flush(launch::apply_policy)
+        {
+            HPX_ASSERT(data_);
+            data_->flush(launch::apply);
+        }
+
+        /// Send all buffered values, the returned future becomes ready once
+        /// they have been delivered
+        hpx::future<void> flush(launch::async_policy)
+        {
+            HPX_ASSERT(data_);
+            return data_->flush(launch::async);
+        }
+
+        /// Send all buffered values and wait for them to be delivered
+        void flush()
+        {
+            flush(launch::async).get();
+        }
+
+    private:
+        std::shared_ptr<detail::buffered_send_channel_data<T> > data_;
+    };
+}}
+
+#endif
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace hpx { namespace lcos
 {
@@ -288,6 +289,70 @@ namespace hpx { namespace lcos
             set(launch::sync, generation);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Retrieve the next count values from the channel using a single
+        // message
+        template <typename U = T>
+        typename std::enable_if<
+            !std::is_void<U>::value, hpx::future<std::vector<U> >
+        >::type
+        get_n(launch::async_policy, std::size_t count) const
+        {
+            typedef typename lcos::server::channel<T>::get_values_action
+                action_type;
+            return hpx::async(action_type(), this->get_id(), count);
+        }
+        template <typename U = T>
+        typename std::enable_if<
+            !std::is_void<U>::value, hpx::future<std::vector<U> >
+        >::type
+        get_n(std::size_t count) const
+        {
+            return get_n(launch::async, count);
+        }
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value, std::vector<U> >::type
+        get_n(launch::sync_policy, std::size_t count,
+            hpx::error_code& ec = hpx::throws) const
+        {
+            return get_n(launch::async, count).get(ec);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Push a sequence of values to the channel using a single message
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value, bool>::type
+        set_n(launch::apply_policy, std::vector<U> values)
+        {
+            typedef typename lcos::server::channel<T>::set_values_action
+                action_type;
+            return hpx::apply(action_type(), this->get_id(), std::move(values));
+        }
+        template <typename U = T>
+        typename std::enable_if<
+            !std::is_void<U>::value, hpx::future<void>
+        >::type
+        set_n(launch::async_policy, std::vector<U> values)
+        {
+            typedef typename lcos::server::channel<T>::set_values_action
+                action_type;
+            return hpx::async(action_type(), this->get_id(), std::move(values));
+        }
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value>::type
+        set_n(launch::sync_policy, std::vector<U> values)
+        {
+            typedef typename lcos::server::channel<T>::set_values_action
+                action_type;
+            action_type()(this->get_id(), std::move(values));
+        }
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value>::type
+        set_n(std::vector<U> values)
+        {
+            set_n(launch::sync, std::move(values));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void close(launch::apply_policy, bool force_delete_entries = false)
         {
@@ -394,6 +459,35 @@ namespace hpx { namespace lcos
             return get(launch::sync, generation, ec);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Retrieve the next count values from the channel using a single
+        // message
+        template <typename U = T>
+        typename std::enable_if<
+            !std::is_void<U>::value, hpx::future<std::vector<U> >
+        >::type
+        get_n(launch::async_policy, std::size_t count) const
+        {
+            typedef typename lcos::server::channel<T>::get_values_action
+                action_type;
+            return hpx::async(action_type(), this->get_id(), count);
+        }
+        template <typename U = T>
+        typename std::enable_if<
+            !std::is_void<U>::value, hpx::future<std::vector<U> >
+        >::type
+        get_n(std::size_t count) const
+        {
+            return get_n(launch::async, count);
+        }
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value, std::vector<U> >::type
+        get_n(launch::sync_policy, std::size_t count,
+            hpx::error_code& ec = hpx::throws) const
+        {
+            return get_n(launch::async, count).get(ec);
+        }
+
         ///////////////////////////////////////////////////////////////////////
         channel_iterator<T, channel<T> > begin() const
         {
@@ -529,6 +623,41 @@ namespace hpx { namespace lcos
             set(launch::sync, generation);
         }
 
+        ///////////////////////////////////////////////////////////////////////
+        // Push a sequence of values to the channel using a single message
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value, bool>::type
+        set_n(launch::apply_policy, std::vector<U> values)
+        {
+            typedef typename lcos::server::channel<T>::set_values_action
+                action_type;
+            return hpx::apply(action_type(), this->get_id(), std::move(values));
+        }
+        template <typename U = T>
+        typename std::enable_if<
+            !std::is_void<U>::value, hpx::future<void>
+        >::type
+        set_n(launch::async_policy, std::vector<U> values)
+        {
+            typedef typename lcos::server::channel<T>::set_values_action
+                action_type;
+            return hpx::async(action_type(), this->get_id(), std::move(values));
+        }
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value>::type
+        set_n(launch::sync_policy, std::vector<U> values)
+        {
+            typedef typename lcos::server::channel<T>::set_values_action
+                action_type;
+            action_type()(this->get_id(), std::move(values));
+        }
+        template <typename U = T>
+        typename std::enable_if<!std::is_void<U>::value>::type
+        set_n(std::vector<U> values)
+        {
+            set_n(launch::sync, std::move(values));
+        }
+
         ///////////////////////////////////////////////////////////////////////
         void close(launch::apply_policy, bool force_delete_entries = false)
         {
@@ -0,0 +1,281 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/combining_latch.hpp
+
+#if !defined(HPX_LCOS_COMBINING_LATCH_HPP)
+#define HPX_LCOS_COMBINING_LATCH_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/communicator_collectives.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        struct combining_latch_data
+        {
+            combining_latch_data(communicator && comm, std::ptrdiff_t count)
+              : comm_(std::move(comm))
+              , generation_(comm_.next_generation())
+              , counter_(count)
+            {
+                if (count < 0)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "hpx::lcos::combining_latch::combining_latch",
+                        "the count of a latch must not be negative");
+                }
+            }
+
+            // The sites form a binomial tree rooted at site 0 (see
+            // communicator_collectives.hpp). A site notifies its parent
+            // (tag 0) once its own counter and the subtrees of all of its
+            // children have reached zero. The root releases all sites by
+            // sending a message down the tree (tag 1).
+            void start()
+            {
+                std::size_t const num_sites = comm_.num_sites();
+                std::size_t const rank = tree_rank(comm_, 0);
+
+                std::size_t mask = first_child_distance(num_sites);
+                if (rank != 0)
+                    mask = lowest_bit(rank) / 2;
+
+                std::vector<std::size_t> children;
+                for (/**/; mask != 0; mask /= 2)
+                {
+                    if (rank + mask < num_sites)
+                        children.push_back(tree_site(comm_, 0, rank + mask));
+                }
+
+                std::vector<hpx::future<void> > subtree;
+                subtree.reserve(children.size() + 1);
+                subtree.push_back(arrived_.get_future());
+                for (std::size_t child : children)
+                {
+                    subtree.push_back(hpx::future<void>(
+                        comm_.receive(child, generation_, 0)));
+                }
+
+                communicator comm = comm_;
+                std::size_t const generation = generation_;
+
+                hpx::future<void> released = hpx::when_all(subtree).then(
+                    hpx::launch::sync,
+                    [comm, generation, rank](
+                        hpx::future<std::vector<hpx::future<void> > > f)
+                    ->  hpx::future<void>
+                    {
+                        for (hpx::future<void>& done : f.get())
+                            done.get();
+
+                        if (rank == 0)
+                            return hpx::make_ready_future();
+
+                        std::size_t const parent =
+                            tree_site(comm, 0, rank - lowest_bit(rank));
+
+                        return hpx::dataflow(hpx::launch::sync,
+                            [](hpx::future<void> s,
+                                hpx::future<communicator::buffer_type> r)
+                            {
+                                s.get();
+                                r.get();
+                            },
+                            comm.send(parent, generation, 0,
+                                communicator::buffer_type()),
+                            comm.receive(parent, generation, 1));
+                    });
+
+                released_ = released.then(hpx::launch::sync,
+                    [comm, generation, children](hpx::future<void> f)
+                    ->  hpx::future<void>
+                    {
+                        f.get();
+
+                        std::vector<hpx::future<void> > sends;
+                        sends.reserve(children.size());
+                        for (std::size_t child : children)
+                        {
+                            sends.push_back(comm.send(child, generation, 1,
+                                communicator::buffer_type()));
+                        }
+                        return hpx::when_all(sends).then(hpx::launch::sync,
+                            [](hpx::future<std::vector<hpx::future<void> > > s)
+                            {
+                                for (hpx::future<void>& sent : s.get())
+                                    sent.get();
+                            });
+                    });
+
+                if (counter_ == 0)
+                    arrived_.set_value();
+            }
+
+            void count_down(std::ptrdiff_t n)
+            {
+                if (n < 0)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "hpx::lcos::combining_latch::count_down",
+                        "the count must not be negative");
+                }
+
+                // the counter is never decremented below zero, not even
+                // temporarily
+                std::ptrdiff_t previous = counter_.load();
+                do
+                {
+                    if (previous < n)
+                    {
+                        HPX_THROW_EXCEPTION(bad_parameter,
+                            "hpx::lcos::combining_latch::count_down",
+                            "the counter of this site would become negative");
+                    }
+                } while (!counter_.compare_exchange_weak(previous,
+                    previous - n));
+
+                if (previous == n && n != 0)
+                    arrived_.set_value();
+            }
+
+            communicator comm_;
+            std::size_t const generation_;
+            std::atomic<std::ptrdiff_t> counter_;
+            lcos::local::promise<void> arrived_;
+            hpx::shared_future<void> released_;
+        };
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A combining_latch is a latch spanning the sites of a communicator
+    /// (usually one per locality). Every site is created with the number of
+    /// count downs expected on this site. The count downs are aggregated
+    /// locally, without sending any message. Once the counter of a site and
+    /// of all sites in its subtree have reached zero, the site sends a
+    /// single message to its parent in a binomial tree rooted at site 0.
+    /// Once the root knows that all counters have reached zero, it releases
+    /// all sites by sending one message down the tree.
+    ///
+    /// Each site sends and receives at most ceil(log2(N)) + 1 messages, the
+    /// root receives ceil(log2(N)) messages, independently of the number of
+    /// participants counting down.
+    ///
+    /// The latch is split-phase: \a arrive counts down without blocking,
+    /// \a wait waits for all sites to have counted down to zero.
+    ///
+    /// Every site has to create its own instance of the latch, the instances
+    /// may be used concurrently by any number of threads on their site.
+    class combining_latch
+    {
+    public:
+        /// Create an invalid latch
+        combining_latch() = default;
+
+        /// Create a latch spanning the sites of the given communicator
+        ///
+        /// \param comm     The communicator identifying the participating
+        ///                 sites. The latch is identified by the next
+        ///                 generation of the communicator, all sites have to
+        ///                 create their latches in the same order.
+        /// \param count    The number of count downs expected on this site,
+        ///                 this may be zero.
+        combining_latch(communicator comm, std::ptrdiff_t count)
+          : data_(std::make_shared<detail::combining_latch_data>(
+                std::move(comm), count))
+        {
+            data_->start();
+        }
+
+        /// Create a latch spanning all localities
+        ///
+        /// \param basename The name identifying this latch, it must be
+        ///                 unique amongst the communicators in use.
+        /// \param count    The number of count downs expected on this site,
+        ///                 this may be zero.
+        combining_latch(std::string const& basename, std::ptrdiff_t count)
+          : combining_latch(communicator(basename), count)
+        {}
+
+        /// Decrement the counter of this site by \a n. This function does
+        /// not block.
+        ///
+        /// \throws bad_parameter if the counter of this site would become
+        ///         negative.
+        void count_down(std::ptrdiff_t n = 1)
+        {
+            HPX_ASSERT(data_);
+            data_->count_down(n);
+        }
+
+        /// Decrement the counter of this site by one. This function does
+        /// not block.
+        void arrive()
+        {
+            count_down(1);
+        }
+
+        /// Return whether the counters of all sites have reached zero
+        bool is_ready() const
+        {
+            HPX_ASSERT(data_);
+            return data_->released_.is_ready();
+        }
+
+        /// Wait until the counters of all sites have reached zero
+        void wait() const
+        {
+            HPX_ASSERT(data_);
+            data_->released_.get();
+        }
+
+        /// \returns a future which becomes ready once the counters of all
+        ///          sites have reached zero.
+        hpx::shared_future<void> wait(hpx::launch::async_policy) const
+        {
+            HPX_ASSERT(data_);
+            return data_->released_;
+        }
+
+        /// Decrement the counter of this site by one and wait until the
+        /// counters of all sites have reached zero
+        void arrive_and_wait()
+        {
+            arrive();
+            wait();
+        }
+
+        /// The communicator the latch operates on
+        communicator const& get_communicator() const
+        {
+            HPX_ASSERT(data_);
+            return data_->comm_;
+        }
+
+    private:
+        std::shared_ptr<detail::combining_latch_data> data_;
+    };
+}}
+
+#endif
@@ -0,0 +1,346 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/communicator.hpp
+
+#if !defined(HPX_LCOS_COMMUNICATOR_HPP)
+#define HPX_LCOS_COMMUNICATOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/input_archive.hpp>
+#include <hpx/runtime/serialization/output_archive.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <boost/shared_array.hpp>
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        struct communicator_data;
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A communicator represents a fixed set of participating sites (usually
+    /// one per locality) which perform collective operations together. The
+    /// localities of all sites are determined once, when the communicator is
+    /// created. Afterwards every collective operation invoked on it costs
+    /// only the data messages exchanged between the sites: the messages are
+    /// delivered directly to the receiving site without resolving any names
+    /// and without creating any LCOs.
+    ///
+    /// All sites have to create the communicators sharing a name in the same
+    /// order, and have to invoke the same sequence of collective operations
+    /// on their communicator instances. Each operation is identified by a
+    /// generation number, which is incremented automatically for every
+    /// operation unless it is explicitly specified.
+    ///
+    /// The following collective operations can be invoked on a communicator:
+    /// broadcast, reduce, gather, scatter (see
+    /// hpx/lcos/communicator_collectives.hpp), all_reduce,
+    /// all_reduce_elements, all_gather, all_to_all, all_to_all_v,
+    /// inclusive_scan, exclusive_scan (and their elementwise variants, see
+    /// hpx/lcos/scan.hpp), pipelined_broadcast, and the
+    /// dissemination_barrier.
+    class HPX_EXPORT communicator
+    {
+    public:
+        /// The type of the messages exchanged between the sites
+        typedef serialization::serialize_buffer<char> buffer_type;
+
+        /// Create an invalid communicator
+        communicator() = default;
+
+        /// Create a communicator spanning all localities, the sequence number
+        /// of the local site is hpx::get_locality_id().
+        ///
+        /// \param basename The name identifying this communicator, it must be
+        ///                 unique amongst the communicators in use.
+        explicit communicator(std::string const& basename);
+
+        /// Create a communicator for a given number of sites, which may be
+        /// located anywhere. The sites exchange their localities once using
+        /// the given base name.
+        ///
+        /// \param basename The name identifying this communicator
+        /// \param num_sites The number of participating sites
+        /// \param this_site The sequence number of the local site
+        communicator(std::string const& basename, std::size_t num_sites,
+            std::size_t this_site);
+
+        /// Create a communicator for sites on the given localities, where
+        /// site i is located on the locality localities[i].
+        ///
+        /// \param basename The name identifying this communicator
+        /// \param localities The localities of all participating sites
+        /// \param this_site The sequence number of the local site
+        communicator(std::string const& basename,
+            std::vector<hpx::id_type> const& localities,
+            std::size_t this_site);
+
+        ~communicator();
+
+        /// Return whether this communicator refers to a set of sites
+        bool valid() const
+        {
+            return !!data_;
+        }
+
+        /// The number of participating sites
+        std::size_t num_sites() const;
+
+        /// The sequence number of the local site
+        std::size_t this_site() const;
+
+        /// The locality of the given site
+        hpx::id_type const& get_locality(std::size_t site) const;
+
+        /// Return the generation number identifying the next collective
+        /// operation if \a generation is std::size_t(-1), otherwise
+        /// \a generation itself.
+        std::size_t next_generation(std::size_t generation = std::size_t(-1));
+
+        /// Send the given message to the given site. The message is
+        /// identified by the generation number of the collective operation,
+        /// an operation specific tag, and the sequence number of the sending
+        /// site.
+        ///
+        /// \returns A future which becomes ready once the message has been
+        ///          delivered to the destination site.
+        hpx::future<void> send(std::size_t site, std::size_t generation,
+            std::size_t tag, buffer_type data) const;
+
+        /// Receive the message with the given generation number and tag
+        /// sent by the given site.
+        hpx::future<buffer_type> receive(std::size_t site,
+            std::size_t generation, std::size_t tag) const;
+
+    private:
+        std::shared_ptr<detail::communicator_data> data_;
+    };
+
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Collective operations exchange plain data, which is either copied
+        // as is (for bitwise serializable types) or serialized into the
+        // communicator's messages.
+        template <typename T>
+        struct is_plain_data
+          : std::integral_constant<bool,
+                std::is_arithmetic<T>::value ||
+                hpx::traits::is_bitwise_serializable<T>::value>
+        {};
+
+        // access a received message as a serialization container
+        struct message_view
+        {
+            std::size_t size() const
+            {
+                return size_;
+            }
+
+            char const& operator[](std::size_t i) const
+            {
+                return data_[i];
+            }
+
+            char const* data_;
+            std::size_t size_;
+        };
+
+        inline communicator::buffer_type make_message(std::vector<char>* data)
+        {
+            return communicator::buffer_type(data->data(), data->size(),
+                communicator::buffer_type::take,
+                [data](char*) { delete data; });
+        }
+
+        template <typename T>
+        communicator::buffer_type serialize_range(T const* first,
+            std::size_t count, std::true_type)
+        {
+            return communicator::buffer_type(
+                reinterpret_cast<char const*>(first), count * sizeof(T));
+        }
+
+        template <typename T>
+        communicator::buffer_type serialize_range(T const* first,
+            std::size_t count, std::false_type)
+        {
+            std::unique_ptr<std::vector<char> > data(new std::vector<char>);
+            {
+                serialization::output_archive ar(*data);
+                for (std::size_t i = 0; i != count; ++i)
+                    ar << first[i];
+            }
+            return make_message(data.release());
+        }
+
+        // create a message holding the given range of values
+        template <typename T>
+        communicator::buffer_type serialize_range(T const* first,
+            std::size_t count)
+        {
+            return serialize_range(first, count, is_plain_data<T>());
+        }
+
+        template <typename T>
+        void deserialize_range(communicator::buffer_type const& data,
+            T* first, std::size_t count, std::true_type)
+        {
+            HPX_ASSERT(data.size() == count * sizeof(T));
+            if (count != 0)
+                std::memcpy(first, data.data(), count * sizeof(T));
+        }
+
+        template <typename T>
+        void deserialize_range(communicator::buffer_type const& data,
+            T* first, std::size_t count, std::false_type)
+        {
+            message_view view = { data.data(), data.size() };
+            serialization::input_archive ar(view, data.size());
+            for (std::size_t i = 0; i != count; ++i)
+                ar >> first[i];
+        }
+
+        // extract the given range of values from a message
+        template <typename T>
+        void deserialize_range(communicator::buffer_type const& data,
+            T* first, std::size_t count)
+        {
+            deserialize_range(data, first, count, is_plain_data<T>());
+        }
+
+        template <typename T>
+        communicator::buffer_type serialize_value(T const& value)
+        {
+            return serialize_range(&value, 1);
+        }
+
+        // create a message holding the given array, the receiving end does
+        // not need to know the number of elements
+        template <typename T>
+        communicator::buffer_type serialize_vector(std::vector<T> const& data,
+            std::true_type)
+        {
+            return serialize_range(data.data(), data.size(), std::true_type());
+        }
+
+        template <typename T>
+        communicator::buffer_type serialize_vector(std::vector<T> const& data,
+            std::false_type)
+        {
+            return serialize_range(&data, 1, std::false_type());
+        }
+
+        template <typename T>
+        communicator::buffer_type serialize_vector(std::vector<T> const& data)
+        {
+            return serialize_vector(data, is_plain_data<T>());
+        }
+
+        template <typename T>
+        std::vector<T> deserialize_vector(
+            communicator::buffer_type const& data, std::true_type)
+        {
+            std::vector<T> values(data.size() / sizeof(T));
+            deserialize_range(data, values.data(), values.size(),
+                std::true_type());
+            return values;
+        }
+
+        template <typename T>
+        std::vector<T> deserialize_vector(
+            communicator::buffer_type const& data, std::false_type)
+        {
+            std::vector<T> values;
+            deserialize_range(data, &values, 1, std::false_type());
+            return values;
+        }
+
+        template <typename T>
+        std::vector<T> deserialize_vector(
+            communicator::buffer_type const& data)
+        {
+            return deserialize_vector<T>(data, is_plain_data<T>());
+        }
+
+        // Wrap the data of the given buffer into a message without copying
+        // it. The message keeps the data alive until it has been sent.
+        template <typename T, typename Allocator>
+        communicator::buffer_type as_message(
+            serialization::serialize_buffer<T, Allocator> const& data,
+            std::size_t first, std::size_t count)
+        {
+            static_assert(is_plain_data<T>::value,
+                "the elements of the buffer have to be bitwise serializable");
+            HPX_ASSERT(first + count <= data.size());
+
+            boost::shared_array<T> keep_alive = data.data_array();
+            return communicator::buffer_type(
+                reinterpret_cast<char*>(keep_alive.get() + first),
+                count * sizeof(T), communicator::buffer_type::reference,
+                [keep_alive](char*) {});
+        }
+
+        template <typename T, typename Allocator>
+        communicator::buffer_type as_message(
+            serialization::serialize_buffer<T, Allocator> const& data)
+        {
+            return as_message(data, 0, data.size());
+        }
+
+        // Refer to the data of a received message as a buffer of the given
+        // type without copying it.
+        template <typename T, typename Allocator = std::allocator<T> >
+        serialization::serialize_buffer<T, Allocator> from_message(
+            communicator::buffer_type const& data)
+        {
+            static_assert(is_plain_data<T>::value,
+                "the elements of the buffer have to be bitwise serializable");
+
+            typedef serialization::serialize_buffer<T, Allocator> buffer_type;
+
+            boost::shared_array<char> keep_alive = data.data_array();
+            return buffer_type(
+                reinterpret_cast<T*>(keep_alive.get()),
+                data.size() / sizeof(T), buffer_type::reference,
+                [keep_alive](T*) {});
+        }
+
+        template <typename T>
+        T deserialize_value(communicator::buffer_type const& data)
+        {
+            T value;
+            deserialize_range(data, &value, 1);
+            return value;
+        }
+    }
+    /// \endcond
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
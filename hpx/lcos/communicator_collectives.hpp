@@ -0,0 +1,503 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/communicator_collectives.hpp
+
+#if !defined(HPX_LCOS_COMMUNICATOR_COLLECTIVES_HPP)
+#define HPX_LCOS_COMMUNICATOR_COLLECTIVES_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The rooted collectives use binomial trees. The sites are renumbered
+        // such that the root has rank zero, the parent of rank r > 0 is r
+        // without its lowest set bit, and the children of rank r are r + 2^k
+        // for all 2^k smaller than the lowest set bit of r (any 2^k < N for
+        // the root). Every operation completes after ceil(log2(N)) rounds.
+        inline std::size_t lowest_bit(std::size_t rank)
+        {
+            return rank & (~rank + 1);
+        }
+
+        // the largest power of two smaller than the number of sites, used
+        // as the distance to the first child of the root
+        inline std::size_t first_child_distance(std::size_t num_sites)
+        {
+            std::size_t mask = 1;
+            while (2 * mask < num_sites)
+                mask *= 2;
+            return mask;
+        }
+
+        inline std::size_t tree_rank(communicator const& comm,
+            std::size_t root)
+        {
+            return (comm.this_site() + comm.num_sites() - root) %
+                comm.num_sites();
+        }
+
+        inline std::size_t tree_site(communicator const& comm,
+            std::size_t root, std::size_t rank)
+        {
+            return (rank + root) % comm.num_sites();
+        }
+
+        inline void check_root(communicator const& comm, std::size_t root,
+            char const* function)
+        {
+            if (root >= comm.num_sites())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, function,
+                    "the given root site is out of range: " +
+                    std::to_string(root));
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        T broadcast_binomial(communicator comm, std::size_t generation,
+            T value, std::size_t root)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const rank = tree_rank(comm, root);
+
+            std::size_t mask = first_child_distance(num_sites);
+            if (rank != 0)
+            {
+                std::size_t const parent = rank - lowest_bit(rank);
+                value = deserialize_value<T>(comm.receive(
+                    tree_site(comm, root, parent), generation, 0).get());
+                mask = lowest_bit(rank) / 2;
+            }
+
+            if (num_sites == 1)
+                return value;
+
+            // the message is created once and shared by all children
+            communicator::buffer_type const msg = serialize_value(value);
+
+            std::vector<hpx::future<void> > sends;
+            for (/**/; mask != 0; mask /= 2)
+            {
+                if (rank + mask < num_sites)
+                {
+                    sends.push_back(comm.send(
+                        tree_site(comm, root, rank + mask), generation, 0, msg));
+                }
+            }
+
+            for (hpx::future<void>& f : sends)
+                f.get();
+
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // the partial results always cover a contiguous range of ranks which
+        // are combined in order
+        template <typename T, typename F>
+        T reduce_binomial(communicator comm, std::size_t generation,
+            T value, F op, std::size_t root)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const rank = tree_rank(comm, root);
+
+            for (std::size_t mask = 1; mask < num_sites; mask *= 2)
+            {
+                if (rank & mask)
+                {
+                    comm.send(tree_site(comm, root, rank - mask), generation,
+                        0, serialize_value(value)).get();
+                    break;
+                }
+
+                if (rank + mask < num_sites)
+                {
+                    T other = deserialize_value<T>(comm.receive(
+                        tree_site(comm, root, rank + mask), generation, 0)
+                            .get());
+                    value = op(std::move(value), std::move(other));
+                }
+            }
+
+            return value;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // elementwise reduction of small arrays along the binomial tree, the
+        // received arrays are combined in place
+        template <typename T, typename F>
+        std::vector<T> reduce_elements_binomial(communicator comm,
+            std::size_t generation, std::vector<T> data, F op,
+            std::size_t root)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const rank = tree_rank(comm, root);
+
+            for (std::size_t mask = 1; mask < num_sites; mask *= 2)
+            {
+                if (rank & mask)
+                {
+                    comm.send(tree_site(comm, root, rank - mask), generation,
+                        0, serialize_range(data.data(), data.size())).get();
+                    return std::vector<T>();
+                }
+
+                if (rank + mask < num_sites)
+                {
+                    combine_elements(data.data(), comm.receive(
+                            tree_site(comm, root, rank + mask), generation, 0)
+                                .get(),
+                        data.size(), op);
+                }
+            }
+
+            return data;
+        }
+
+        // elementwise reduction of large arrays: a reduce-scatter along the
+        // ring, after which every site sends its fully reduced chunk to the
+        // root. Every site sends about twice the size of the array.
+        template <typename T, typename F>
+        std::vector<T> reduce_elements_ring(communicator comm,
+            std::size_t generation, std::vector<T> data, F op,
+            std::size_t root)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+            if (num_sites == 1)
+                return data;
+
+            std::size_t const size = data.size();
+            std::size_t const tag = num_sites - 1;
+
+            std::vector<hpx::future<void> > sends;
+            sends.reserve(num_sites);
+
+            reduce_scatter_ring(comm, generation, data, op, sends);
+
+            // site i owns the chunk (i + 1) % N
+            if (this_site != root)
+            {
+                std::size_t const chunk = (this_site + 1) % num_sites;
+                sends.push_back(comm.send(root, generation, tag,
+                    serialize_range(
+                        data.data() + chunk_begin(size, num_sites, chunk),
+                        chunk_size(size, num_sites, chunk))));
+
+                wait_for_sends(sends);
+                return std::vector<T>();
+            }
+
+            for (std::size_t site = 0; site != num_sites; ++site)
+            {
+                if (site == root)
+                    continue;
+
+                std::size_t const chunk = (site + 1) % num_sites;
+                deserialize_range(comm.receive(site, generation, tag).get(),
+                    data.data() + chunk_begin(size, num_sites, chunk),
+                    chunk_size(size, num_sites, chunk));
+            }
+
+            wait_for_sends(sends);
+            return data;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // blocks[i] holds the value of rank (rank + i)
+        template <typename T>
+        std::vector<T> gather_binomial(communicator comm,
+            std::size_t generation, T value, std::size_t root)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const rank = tree_rank(comm, root);
+
+            std::vector<T> blocks;
+            blocks.push_back(std::move(value));
+
+            for (std::size_t mask = 1; mask < num_sites; mask *= 2)
+            {
+                if (rank & mask)
+                {
+                    comm.send(tree_site(comm, root, rank - mask), generation,
+                        0, serialize_range(blocks.data(), blocks.size()))
+                            .get();
+                    return std::vector<T>();
+                }
+
+                if (rank + mask < num_sites)
+                {
+                    std::size_t const count =
+                        (std::min)(mask, num_sites - rank - mask);
+                    std::size_t const size = blocks.size();
+                    blocks.resize(size + count);
+                    deserialize_range(comm.receive(
+                            tree_site(comm, root, rank + mask), generation, 0)
+                                .get(),
+                        blocks.data() + size, count);
+                }
+            }
+
+            // the root has collected the values of all ranks, reorder them
+            // by site
+            std::rotate(blocks.begin(),
+                blocks.begin() + (num_sites - root) % num_sites, blocks.end());
+            return blocks;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        T scatter_binomial(communicator comm, std::size_t generation,
+            std::vector<T> values, std::size_t root)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const rank = tree_rank(comm, root);
+
+            // blocks[i] holds the value for rank (rank + i)
+            std::vector<T> blocks;
+            std::size_t mask = first_child_distance(num_sites);
+            if (rank == 0)
+            {
+                // throwing here would leave the other sites waiting for
+                // their values
+                HPX_ASSERT(values.size() == num_sites);
+
+                std::rotate(values.begin(), values.begin() + root,
+                    values.end());
+                blocks = std::move(values);
+            }
+            else
+            {
+                std::size_t const low = lowest_bit(rank);
+                blocks.resize((std::min)(low, num_sites - rank));
+                deserialize_range(comm.receive(
+                        tree_site(comm, root, rank - low), generation, 0).get(),
+                    blocks.data(), blocks.size());
+                mask = low / 2;
+            }
+
+            if (num_sites == 1)
+                return std::move(blocks[0]);
+
+            std::vector<hpx::future<void> > sends;
+            for (/**/; mask != 0; mask /= 2)
+            {
+                if (rank + mask < num_sites)
+                {
+                    std::size_t const count =
+                        (std::min)(mask, num_sites - rank - mask);
+                    sends.push_back(comm.send(
+                        tree_site(comm, root, rank + mask), generation, 0,
+                        serialize_range(blocks.data() + mask, count)));
+                }
+            }
+
+            for (hpx::future<void>& f : sends)
+                f.get();
+
+            return std::move(blocks[0]);
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Broadcast a value from one site to all sites of a communicator
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  value       The value to broadcast. It is ignored on all sites
+    ///                     but the root site.
+    /// \param  root        The sequence number of the site providing the
+    ///                     value. This is optional and defaults to zero.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the value of the
+    ///             root site.
+    ///
+    template <typename T>
+    hpx::future<typename util::decay<T>::type>
+    broadcast(communicator& comm, T && value, std::size_t root = 0,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<T>::type value_type;
+
+        detail::check_root(comm, root, "hpx::lcos::broadcast");
+        return hpx::async(&detail::broadcast_binomial<value_type>, comm,
+            comm.next_generation(generation), std::forward<T>(value), root);
+    }
+
+    /// Reduce the values of all sites of a communicator to one site
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  value       The value contributed by this site.
+    /// \param  op          The binary operation used to combine the values.
+    ///                     It has to be associative. The values are combined
+    ///                     in the order of the sites starting at the root
+    ///                     site (in the order of the sites if the root site
+    ///                     is site zero).
+    /// \param  root        The sequence number of the site receiving the
+    ///                     result. This is optional and defaults to zero.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the combined value
+    ///             on the root site, and a partial result on all other sites.
+    ///
+    template <typename T, typename F>
+    hpx::future<typename util::decay<T>::type>
+    reduce(communicator& comm, T && value, F && op, std::size_t root = 0,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<T>::type value_type;
+        typedef typename util::decay<F>::type op_type;
+
+        detail::check_root(comm, root, "hpx::lcos::reduce");
+        return hpx::async(&detail::reduce_binomial<value_type, op_type>, comm,
+            comm.next_generation(generation), std::forward<T>(value),
+            std::forward<F>(op), root);
+    }
+
+    /// Reduce arrays of values from all sites of a communicator element by
+    /// element to one site
+    ///
+    /// All sites have to contribute arrays of the same size. Small arrays are
+    /// reduced along a binomial tree. Large arrays (at least
+    /// hpx.lcos.collectives.all_reduce_ring_threshold bytes) are reduced by
+    /// a ring based reduce-scatter, after which the reduced chunks are sent
+    /// to the root site. The received elements are combined in place, see
+    /// all_reduce_elements for the operations which are vectorized.
+    ///
+    /// This function does not block, the returned future allows to overlap
+    /// the reduction with other work.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_result The array contributed by this site.
+    /// \param  op          The binary operation used to combine the elements.
+    ///                     It has to be associative and commutative.
+    /// \param  root        The sequence number of the site receiving the
+    ///                     result. This is optional and defaults to zero.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the combined array
+    ///             on the root site, and an empty array on all other sites.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T> >
+    reduce_elements(communicator& comm, std::vector<T> local_result, F && op,
+        std::size_t root = 0, std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<F>::type op_type;
+
+        detail::check_root(comm, root, "hpx::lcos::reduce_elements");
+        generation = comm.next_generation(generation);
+
+        if (local_result.size() >= comm.num_sites() &&
+            local_result.size() * sizeof(T) >=
+                detail::get_all_reduce_ring_threshold())
+        {
+            return hpx::async(&detail::reduce_elements_ring<T, op_type>,
+                comm, generation, std::move(local_result),
+                std::forward<F>(op), root);
+        }
+
+        return hpx::async(&detail::reduce_elements_binomial<T, op_type>,
+            comm, generation, std::move(local_result), std::forward<F>(op),
+            root);
+    }
+
+    /// Gather the values of all sites of a communicator on one site
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  value       The value contributed by this site.
+    /// \param  root        The sequence number of the site receiving the
+    ///                     values. This is optional and defaults to zero.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the values of all
+    ///             sites (ordered by site) on the root site, and an empty
+    ///             vector on all other sites.
+    ///
+    template <typename T>
+    hpx::future<std::vector<typename util::decay<T>::type> >
+    gather(communicator& comm, T && value, std::size_t root = 0,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<T>::type value_type;
+
+        detail::check_root(comm, root, "hpx::lcos::gather");
+        return hpx::async(&detail::gather_binomial<value_type>, comm,
+            comm.next_generation(generation), std::forward<T>(value), root);
+    }
+
+    /// Distribute the values given by one site to all sites of a communicator
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  values      The values to distribute, values[i] is sent to
+    ///                     site i. It is ignored on all sites but the root
+    ///                     site, where its size has to be equal to the
+    ///                     number of sites (this is not checked in release
+    ///                     builds).
+    /// \param  root        The sequence number of the site providing the
+    ///                     values. This is optional and defaults to zero.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the value sent to
+    ///             this site.
+    ///
+    template <typename T>
+    hpx::future<T>
+    scatter(communicator& comm, std::vector<T> values, std::size_t root = 0,
+        std::size_t generation = std::size_t(-1))
+    {
+        detail::check_root(comm, root, "hpx::lcos::scatter");
+        return hpx::async(&detail::scatter_binomial<T>, comm,
+            comm.next_generation(generation), std::move(values), root);
+    }
+}}
+
+#endif
@@ -0,0 +1,29 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_DETAIL_COROUTINE_FRAME_ALLOCATOR_HPP)
+#define HPX_LCOS_DETAIL_COROUTINE_FRAME_ALLOCATOR_HPP
+
+#include <hpx/config.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace lcos { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Coroutine frames are allocated from a cache owned by the calling worker
+    // (OS) thread. Freed frames are kept in per size class free lists and are
+    // reused by subsequent allocations of similar size, which avoids going
+    // through the global allocator for short lived coroutines. Frames which
+    // are too large for any size class are handled by the global allocator.
+    //
+    // A frame may be released on a different worker than the one it was
+    // allocated on, in which case it is cached by the releasing worker.
+    HPX_API_EXPORT void* allocate_coroutine_frame(std::size_t size);
+    HPX_API_EXPORT void deallocate_coroutine_frame(void* p, std::size_t size)
+        noexcept;
+}}}
+
+#endif
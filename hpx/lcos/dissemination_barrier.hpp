@@ -0,0 +1,133 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/dissemination_barrier.hpp
+
+#if !defined(HPX_LCOS_DISSEMINATION_BARRIER_HPP)
+#define HPX_LCOS_DISSEMINATION_BARRIER_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/dataflow.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/throw_exception.hpp>
+
+#include <cstddef>
+#include <string>
+#include <utility>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // In round k every site notifies the site 2^k positions to its right
+        // and waits for the notification of the site 2^k positions to its
+        // left. After ceil(log2(N)) rounds every site has transitively heard
+        // from all other sites. The next round is started by the thread
+        // delivering the notification, no thread is blocked meanwhile.
+        inline hpx::future<void> dissemination_round(communicator const& comm,
+            std::size_t generation, std::size_t round, std::size_t dist)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            if (dist >= num_sites)
+                return hpx::make_ready_future();
+
+            std::size_t const this_site = comm.this_site();
+
+            hpx::future<void> sent = comm.send((this_site + dist) % num_sites,
+                generation, round, communicator::buffer_type());
+            hpx::future<communicator::buffer_type> received = comm.receive(
+                (this_site + num_sites - dist) % num_sites, generation, round);
+
+            return hpx::dataflow(hpx::launch::sync,
+                [comm, generation, round, dist](hpx::future<void> s,
+                    hpx::future<communicator::buffer_type> r)
+                ->  hpx::future<void>
+                {
+                    s.get();
+                    r.get();
+                    return dissemination_round(
+                        comm, generation, round + 1, 2 * dist);
+                },
+                std::move(sent), std::move(received));
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A dissemination barrier synchronizes the sites of a communicator. In
+    /// each of its ceil(log2(N)) rounds every site exchanges a message with
+    /// exactly one other site, there is no root site all messages are
+    /// funneled through.
+    ///
+    /// The barrier is split-phase: \a arrive signals the arrival of this site
+    /// without blocking, \a wait waits for all sites to have arrived. Work
+    /// placed in between the two calls overlaps with the synchronization.
+    ///
+    /// Every site has to create its own instance of the barrier. The
+    /// instances are not thread-safe.
+    class dissemination_barrier
+    {
+    public:
+        /// Create a barrier synchronizing the sites of the given communicator
+        explicit dissemination_barrier(communicator comm)
+          : comm_(std::move(comm))
+        {}
+
+        /// Create a barrier synchronizing all localities
+        ///
+        /// \param basename The name identifying this barrier, it must be
+        ///                 unique amongst the communicators in use.
+        explicit dissemination_barrier(std::string const& basename)
+          : comm_(basename)
+        {}
+
+        /// Signal that this site has arrived at the barrier. This function
+        /// does not block. It must not be called again before \a wait.
+        void arrive()
+        {
+            if (pending_.valid())
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "hpx::lcos::dissemination_barrier::arrive",
+                    "this site has already arrived at the barrier");
+            }
+
+            pending_ = detail::dissemination_round(
+                comm_, comm_.next_generation(), 0, 1);
+        }
+
+        /// Wait until all sites have arrived at the barrier. If this site has
+        /// not called \a arrive, it arrives first.
+        void wait()
+        {
+            wait(hpx::launch::async).get();
+        }
+
+        /// \returns a future which becomes ready once all sites have arrived
+        ///          at the barrier.
+        hpx::future<void> wait(hpx::launch::async_policy)
+        {
+            if (!pending_.valid())
+                arrive();
+            return std::move(pending_);
+        }
+
+        /// The communicator the barrier operates on
+        communicator const& get_communicator() const
+        {
+            return comm_;
+        }
+
+    private:
+        communicator comm_;
+        hpx::future<void> pending_;
+    };
+}}
+
+#endif
@@ -0,0 +1,203 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/distributed_task_pool.hpp
+
+#if !defined(HPX_LCOS_DISTRIBUTED_TASK_POOL_HPP)
+#define HPX_LCOS_DISTRIBUTED_TASK_POOL_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/components/component_type.hpp>
+#include <hpx/runtime/naming/address.hpp>
+#include <hpx/runtime/naming/id_type.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/invoke_fused.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        struct task_pool_data;
+
+        ///////////////////////////////////////////////////////////////////////
+        // A task invoking a plain action with the given arguments on the
+        // locality it is executed on. The function of the action is called
+        // directly, it has to run on the worker thread of the pool to be
+        // able to post further tasks (see this_task_pool::post).
+        template <typename Action, typename ...Ts>
+        struct action_task
+        {
+            struct invoke_action
+            {
+                template <typename ...Us>
+                void operator()(Us const&... us) const
+                {
+                    wait(Action::execute_function(
+                        naming::address::address_type(0),
+                        naming::address::component_type(
+                            components::component_plain_function),
+                        us...));
+                }
+
+                // an action returning a future is finished once the future
+                // becomes ready
+                template <typename R>
+                static void wait(R &&)
+                {}
+
+                template <typename R>
+                static void wait(hpx::future<R> && f)
+                {
+                    f.get();
+                }
+            };
+
+            void operator()() const
+            {
+                util::invoke_fused(invoke_action(), args_);
+            }
+
+            template <typename Archive>
+            void serialize(Archive& ar, unsigned)
+            {
+                ar & args_;
+            }
+
+            util::tuple<Ts...> args_;
+        };
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A distributed_task_pool executes tasks on a set of sites (usually one
+    /// per locality) and balances the load between them dynamically. Tasks
+    /// posted to a site are queued locally, a site running out of work steals
+    /// a batch of tasks from another site.
+    ///
+    /// The victim of a steal attempt is chosen randomly: out of two randomly
+    /// selected sites the one with the longer queue is asked for work. The
+    /// queue lengths of the other sites are learned by gossiping: every site
+    /// periodically sends its own queue length to a random other site, every
+    /// steal request carries the queue length of the thief, and the size of
+    /// the reply tells the thief about the remaining work of the victim. A
+    /// victim hands out up to half of its queued tasks (at most
+    /// \a max_steal), taking the oldest ones, which usually represent the
+    /// largest amount of work for recursively generated workloads. Idle
+    /// workers are suspended until tasks are posted to their site or another
+    /// site is known to have queued tasks.
+    ///
+    /// The tasks have to be serializable, see \a make_task for creating tasks
+    /// invoking a plain action. A running task can post further tasks to its
+    /// own site using \a this_task_pool::post.
+    ///
+    /// Every site has to create its own instance of the pool. The sites
+    /// execute their tasks using \a num_workers HPX threads each, which are
+    /// stopped when the pool is destroyed.
+    class HPX_EXPORT distributed_task_pool
+    {
+    public:
+        /// The type of the tasks executed by the pool
+        typedef util::function<void()> task_type;
+
+        /// Create an invalid pool
+        distributed_task_pool() = default;
+
+        /// Create a pool spanning all localities, the sequence number of the
+        /// local site is hpx::get_locality_id().
+        ///
+        /// \param basename     The name identifying this pool, it must be
+        ///                     unique amongst the pools in use.
+        /// \param num_workers  The number of threads executing tasks on this
+        ///                     site, defaults to the number of cores used by
+        ///                     this locality.
+        /// \param max_steal    The maximal number of tasks handed out by this
+        ///                     site in reply to a single steal request.
+        explicit distributed_task_pool(std::string const& basename,
+            std::size_t num_workers = 0, std::size_t max_steal = 64);
+
+        /// Create a pool for sites on the given localities, where site i is
+        /// located on the locality localities[i].
+        ///
+        /// \param basename     The name identifying this pool
+        /// \param localities   The localities of all participating sites
+        /// \param this_site    The sequence number of the local site
+        /// \param num_workers  The number of threads executing tasks on this
+        ///                     site, defaults to the number of cores used by
+        ///                     this locality.
+        /// \param max_steal    The maximal number of tasks handed out by this
+        ///                     site in reply to a single steal request.
+        distributed_task_pool(std::string const& basename,
+            std::vector<hpx::id_type> const& localities, std::size_t this_site,
+            std::size_t num_workers = 0, std::size_t max_steal = 64);
+
+        distributed_task_pool(distributed_task_pool &&) = default;
+        distributed_task_pool& operator=(distributed_task_pool &&) = default;
+
+        ~distributed_task_pool();
+
+        /// Return whether this pool refers to a set of sites
+        bool valid() const
+        {
+            return !!data_;
+        }
+
+        /// The communicator spanning the sites of this pool
+        communicator const& get_communicator() const;
+
+        /// Queue the given task on this site
+        void post(task_type task);
+
+        /// The number of tasks currently queued on this site
+        std::size_t queue_length() const;
+
+        /// Wait until all tasks posted to any of the sites, including the
+        /// tasks posted by running tasks, have been executed. This is a
+        /// collective operation, it has to be invoked by all sites.
+        void wait();
+
+    private:
+        std::shared_ptr<detail::task_pool_data> data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Create a task invoking the given plain action with the given
+    /// arguments. The action is invoked on the locality of the site which
+    /// executes the task, all arguments have to be serializable.
+    template <typename Action, typename ...Ts>
+    distributed_task_pool::task_type make_task(Ts &&... ts)
+    {
+        typedef detail::action_task<
+                Action, typename util::decay<Ts>::type...
+            > task;
+
+        return task{ util::make_tuple(std::forward<Ts>(ts)...) };
+    }
+
+    namespace this_task_pool
+    {
+        /// Queue the given task on the site executing the calling task. This
+        /// function can only be called from a task run by a
+        /// distributed_task_pool.
+        HPX_EXPORT void post(distributed_task_pool::task_type task);
+    }
+}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif
@@ -0,0 +1,214 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/elementwise_reduction.hpp
+
+#if !defined(HPX_LCOS_ELEMENTWISE_REDUCTION_HPP)
+#define HPX_LCOS_ELEMENTWISE_REDUCTION_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/util/assert.hpp>
+
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/parallel/datapar.hpp>
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Predefined operations for the elementwise collective reductions
+    /// (all_reduce_elements, reduce_elements). They are applied to whole
+    /// vector packs at a time if HPX was configured with datapar support, any
+    /// other operation is applied one element at a time.
+    namespace reduction
+    {
+        struct plus
+        {
+            template <typename T>
+            T operator()(T const& lhs, T const& rhs) const
+            {
+                return lhs + rhs;
+            }
+        };
+
+        struct multiplies
+        {
+            template <typename T>
+            T operator()(T const& lhs, T const& rhs) const
+            {
+                return lhs * rhs;
+            }
+        };
+
+        struct minimum
+        {
+            template <typename T>
+            typename std::enable_if<std::is_arithmetic<T>::value, T>::type
+            operator()(T const& lhs, T const& rhs) const
+            {
+                return rhs < lhs ? rhs : lhs;
+            }
+
+            // vector packs provide min as a free function
+            template <typename T>
+            typename std::enable_if<!std::is_arithmetic<T>::value, T>::type
+            operator()(T const& lhs, T const& rhs) const
+            {
+                return min(lhs, rhs);
+            }
+        };
+
+        struct maximum
+        {
+            template <typename T>
+            typename std::enable_if<std::is_arithmetic<T>::value, T>::type
+            operator()(T const& lhs, T const& rhs) const
+            {
+                return lhs < rhs ? rhs : lhs;
+            }
+
+            template <typename T>
+            typename std::enable_if<!std::is_arithmetic<T>::value, T>::type
+            operator()(T const& lhs, T const& rhs) const
+            {
+                return max(lhs, rhs);
+            }
+        };
+    }
+
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        template <typename F>
+        struct is_vectorizable_reduction
+          : std::false_type
+        {};
+
+        template <>
+        struct is_vectorizable_reduction<reduction::plus>
+          : std::true_type
+        {};
+
+        template <>
+        struct is_vectorizable_reduction<reduction::multiplies>
+          : std::true_type
+        {};
+
+        template <>
+        struct is_vectorizable_reduction<reduction::minimum>
+          : std::true_type
+        {};
+
+        template <>
+        struct is_vectorizable_reduction<reduction::maximum>
+          : std::true_type
+        {};
+
+        ///////////////////////////////////////////////////////////////////////
+        // dest[i] = op(dest[i], src[i])
+        template <typename T, typename F>
+        void combine_elements(T* dest, T const* src, std::size_t count,
+            F& op, std::false_type)
+        {
+            for (std::size_t i = 0; i != count; ++i)
+                dest[i] = op(std::move(dest[i]), src[i]);
+        }
+
+        template <typename T, typename F>
+        void combine_elements(T* dest, T const* src, std::size_t count,
+            F& op, std::true_type)
+        {
+#if defined(HPX_HAVE_DATAPAR)
+            hpx::parallel::transform(hpx::parallel::execution::dataseq,
+                dest, dest + count, src, dest, op);
+#else
+            // a plain loop over arrays of arithmetic types is vectorized by
+            // the compiler
+            for (std::size_t i = 0; i != count; ++i)
+                dest[i] = op(dest[i], src[i]);
+#endif
+        }
+
+        template <typename T, typename F>
+        void combine_elements(T* dest, T const* src, std::size_t count, F& op)
+        {
+            typedef std::integral_constant<bool,
+                    std::is_arithmetic<T>::value &&
+                    is_vectorizable_reduction<F>::value
+                > vectorize;
+
+            combine_elements(dest, src, count, op, vectorize());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Combine the elements of a received message into the given array.
+        // The elements are read directly from the receive buffer if they are
+        // suitably aligned, otherwise they are copied first.
+        template <typename T, typename F>
+        void combine_elements(T* dest, communicator::buffer_type const& data,
+            std::size_t count, F& op, std::true_type)
+        {
+            HPX_ASSERT(data.size() == count * sizeof(T));
+            if (count == 0)
+                return;
+
+            if (reinterpret_cast<std::uintptr_t>(data.data()) %
+                    alignof(T) == 0)
+            {
+                combine_elements(dest,
+                    reinterpret_cast<T const*>(data.data()), count, op);
+                return;
+            }
+
+            std::vector<T> values(count);
+            std::memcpy(values.data(), data.data(), count * sizeof(T));
+            combine_elements(dest, values.data(), count, op);
+        }
+
+        template <typename T, typename F>
+        void combine_elements(T* dest, communicator::buffer_type const& data,
+            std::size_t count, F& op, std::false_type)
+        {
+            std::vector<T> values(count);
+            deserialize_range(data, values.data(), count, std::false_type());
+            combine_elements(dest, values.data(), count, op);
+        }
+
+        template <typename T, typename F>
+        void combine_elements(T* dest, communicator::buffer_type const& data,
+            std::size_t count, F& op)
+        {
+            combine_elements(dest, data, count, op, is_plain_data<T>());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename F>
+        struct elementwise_op
+        {
+            template <typename T>
+            std::vector<T> operator()(std::vector<T> lhs,
+                std::vector<T> const& rhs)
+            {
+                HPX_ASSERT(lhs.size() == rhs.size());
+                combine_elements(lhs.data(), rhs.data(), lhs.size(), op_);
+                return lhs;
+            }
+
+            F op_;
+        };
+    }
+    /// \endcond
+}}
+
+#endif
@@ -0,0 +1,155 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_ASYNC_MUTEX_HPP)
+#define HPX_LCOS_LOCAL_ASYNC_MUTEX_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/async_lock.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/deferred_call.hpp>
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    /// An async_mutex is a mutex which never suspends the thread trying to
+    /// acquire it. Instead, lock_async() returns a future which becomes ready
+    /// as soon as the calling code owns the mutex. If the mutex is not
+    /// contended the returned future is ready immediately.
+    ///
+    /// On unlock() the ownership is handed directly to the oldest waiter,
+    /// i.e. the mutex is never observed as being unlocked while there are
+    /// waiters pending. Any continuation attached to the future returned by
+    /// lock_async() therefore runs while owning the mutex and has to call
+    /// unlock() exactly once when done (see run_guarded below which does
+    /// that automatically).
+    template <typename Mutex = hpx::lcos::local::spinlock>
+    class async_mutex_var
+    {
+    private:
+        typedef Mutex mutex_type;
+
+    public:
+        HPX_NON_COPYABLE(async_mutex_var);
+
+    public:
+        async_mutex_var()
+          : locked_(false)
+        {}
+
+        ~async_mutex_var()
+        {
+            HPX_ASSERT(waiters_.empty());
+        }
+
+        /// \brief Acquire the mutex asynchronously.
+        ///
+        /// \returns A future which becomes ready once the mutex is owned by
+        ///          the caller. The future is ready on return if the mutex
+        ///          was not locked.
+        hpx::future<void> lock_async()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            if (!locked_)
+            {
+                locked_ = true;
+                return hpx::make_ready_future();
+            }
+
+            waiters_.emplace_back();
+            return waiters_.back().get_future();
+        }
+
+        /// \brief Try to acquire the mutex without waiting.
+        ///
+        /// \returns true if the mutex was acquired, false otherwise.
+        bool try_lock()
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (locked_)
+                return false;
+
+            locked_ = true;
+            return true;
+        }
+
+        /// \brief Release the mutex. If there are waiters pending, the
+        ///        ownership is passed on to the oldest of those.
+        void unlock()
+        {
+            std::unique_lock<mutex_type> l(mtx_);
+            HPX_ASSERT(locked_);
+
+            if (waiters_.empty())
+            {
+                locked_ = false;
+                return;
+            }
+
+            // the mutex stays locked, it is now owned by the next waiter
+            lcos::local::promise<void> next(std::move(waiters_.front()));
+            waiters_.pop_front();
+
+            l.unlock();
+            next.set_value();
+        }
+
+        /// \brief Return whether the mutex is currently owned by anybody
+        bool is_locked() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return locked_;
+        }
+
+        /// \brief Return the number of pending waiters
+        std::size_t num_waiters() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return waiters_.size();
+        }
+
+    private:
+        mutable mutex_type mtx_;
+        bool locked_;
+        std::deque<lcos::local::promise<void> > waiters_;
+    };
+
+    typedef async_mutex_var<> async_mutex;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Conceptually, running a function guarded by an async_mutex is like
+    /// running it as a continuation of lock_async() while holding the lock,
+    /// unlocking it afterwards. The returned future refers to the result of
+    /// invoking the given function.
+    template <typename Mutex, typename F, typename ...Args>
+    hpx::future<typename util::detail::invoke_deferred_result<F, Args...>::type>
+    run_guarded(async_mutex_var<Mutex>& mtx, F&& f, Args&&... args)
+    {
+        typedef typename util::detail::invoke_deferred_result<
+                F, Args...
+            >::type result_type;
+        typedef decltype(util::deferred_call(
+                std::forward<F>(f), std::forward<Args>(args)...)
+            ) deferred_type;
+
+        return mtx.lock_async().then(hpx::launch::sync,
+            detail::async_guarded_call<
+                detail::async_unlock<async_mutex_var<Mutex> >,
+                deferred_type, result_type
+            >(detail::async_unlock<async_mutex_var<Mutex> >(mtx),
+                util::deferred_call(
+                std::forward<F>(f), std::forward<Args>(args)...)));
+    }
+}}}
+
+#endif
@@ -0,0 +1,175 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_ASYNC_SEMAPHORE_HPP)
+#define HPX_LCOS_LOCAL_ASYNC_SEMAPHORE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/detail/async_lock.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/deferred_call.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    /// An async_semaphore is a counting semaphore which never suspends the
+    /// thread waiting on it. Instead, wait_async() returns a future which
+    /// becomes ready as soon as the requested number of credits has been
+    /// acquired by the caller. If enough credits are available the returned
+    /// future is ready immediately.
+    ///
+    /// Waiters are served in FIFO order: signal() hands the released credits
+    /// directly to the oldest waiters whose requests can be satisfied, which
+    /// ensures that a waiter asking for many credits is not starved by a
+    /// stream of waiters asking for fewer.
+    template <typename Mutex = hpx::lcos::local::spinlock>
+    class async_semaphore_var
+    {
+    private:
+        typedef Mutex mutex_type;
+
+        struct waiter
+        {
+            explicit waiter(std::int64_t count)
+              : count_(count)
+            {}
+
+            std::int64_t count_;
+            lcos::local::promise<void> promise_;
+        };
+
+    public:
+        HPX_NON_COPYABLE(async_semaphore_var);
+
+    public:
+        /// \brief Construct a new asynchronous semaphore
+        ///
+        /// \param value    [in] The initial number of available credits.
+        explicit async_semaphore_var(std::int64_t value = 0)
+          : value_(value)
+        {}
+
+        ~async_semaphore_var()
+        {
+            HPX_ASSERT(waiters_.empty());
+        }
+
+        /// \brief Acquire the given number of credits asynchronously.
+        ///
+        /// \param count    [in] The number of credits to acquire.
+        ///
+        /// \returns A future which becomes ready once the credits have been
+        ///          acquired by the caller. The future is ready on return if
+        ///          enough credits were available and nobody else is waiting.
+        hpx::future<void> wait_async(std::int64_t count = 1)
+        {
+            HPX_ASSERT(count > 0);
+
+            std::unique_lock<mutex_type> l(mtx_);
+            if (waiters_.empty() && value_ >= count)
+            {
+                value_ -= count;
+                return hpx::make_ready_future();
+            }
+
+            waiters_.emplace_back(count);
+            return waiters_.back().promise_.get_future();
+        }
+
+        /// \brief Try to acquire the given number of credits without waiting.
+        ///
+        /// \returns true if the credits were acquired, false otherwise.
+        bool try_wait(std::int64_t count = 1)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!waiters_.empty() || value_ < count)
+                return false;
+
+            value_ -= count;
+            return true;
+        }
+
+        /// \brief Release the given number of credits, passing them on to
+        ///        pending waiters, if any.
+        void signal(std::int64_t count = 1)
+        {
+            std::vector<lcos::local::promise<void> > ready;
+
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+
+                value_ += count;
+                while (!waiters_.empty() && waiters_.front().count_ <= value_)
+                {
+                    value_ -= waiters_.front().count_;
+                    ready.push_back(std::move(waiters_.front().promise_));
+                    waiters_.pop_front();
+                }
+            }
+
+            // the credits are now owned by the woken waiters
+            for (lcos::local::promise<void>& p : ready)
+                p.set_value();
+        }
+
+        /// \brief Return the number of currently available credits
+        std::int64_t value() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return value_;
+        }
+
+        /// \brief Return the number of pending waiters
+        std::size_t num_waiters() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return waiters_.size();
+        }
+
+    private:
+        mutable mutex_type mtx_;
+        std::int64_t value_;
+        std::deque<waiter> waiters_;
+    };
+
+    typedef async_semaphore_var<> async_semaphore;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Run the given function as a continuation after \a count credits have
+    /// been acquired from the semaphore, releasing those afterwards. The
+    /// returned future refers to the result of invoking the given function.
+    template <typename Mutex, typename F, typename ...Args>
+    hpx::future<typename util::detail::invoke_deferred_result<F, Args...>::type>
+    run_guarded(async_semaphore_var<Mutex>& sem, std::int64_t count,
+        F&& f, Args&&... args)
+    {
+        typedef typename util::detail::invoke_deferred_result<
+                F, Args...
+            >::type result_type;
+        typedef decltype(util::deferred_call(
+                std::forward<F>(f), std::forward<Args>(args)...)
+            ) deferred_type;
+
+        return sem.wait_async(count).then(hpx::launch::sync,
+            detail::async_guarded_call<
+                detail::async_signal<async_semaphore_var<Mutex> >,
+                deferred_type, result_type
+            >(detail::async_signal<async_semaphore_var<Mutex> >(sem, count),
+                util::deferred_call(
+                std::forward<F>(f), std::forward<Args>(args)...)));
+    }
+}}}
+
+#endif
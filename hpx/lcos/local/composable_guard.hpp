@@ -89,6 +89,7 @@
 
 #include <atomic>
 #include <cstddef>
+#include <exception>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -129,6 +130,25 @@ namespace hpx { namespace lcos { namespace local
         HPX_API_EXPORT void free(guard_task* task);
 
         typedef util::unique_function_nonser<void()> guard_function;
+        typedef util::unique_function_nonser<void(std::exception_ptr const&)>
+            guard_error_handler;
+
+        // A link in the queue of tasks waiting for a combining_guard
+        struct combining_guard_task
+        {
+            combining_guard_task()
+              : next(nullptr)
+            {}
+
+            combining_guard_task(guard_function && f,
+                    guard_error_handler && on_error)
+              : next(nullptr), run(std::move(f)), on_error(std::move(on_error))
+            {}
+
+            std::atomic<combining_guard_task*> next;
+            guard_function run;
+            guard_error_handler on_error;
+        };
     }
 
     class guard : public detail::debug_object
@@ -169,6 +189,44 @@ namespace hpx { namespace lcos { namespace local
             guard_set& guards, detail::guard_function task);
     };
 
+    /// A combining_guard serializes the tasks run on it, just like a guard.
+    /// If the guard is not contended, the task is run directly on the calling
+    /// thread without allocating any memory. Otherwise the task is appended
+    /// to a wait-free multi-producer/single-consumer queue and the thread
+    /// currently owning the guard executes it after its own task, combining
+    /// the work of all contending threads. After a batch of tasks has been
+    /// run this way, the owner hands off the remaining queue to a new HPX
+    /// thread instead of running other threads' tasks forever.
+    class combining_guard : public detail::debug_object
+    {
+    public:
+        HPX_NON_COPYABLE(combining_guard);
+
+    public:
+        HPX_API_EXPORT combining_guard();
+        HPX_API_EXPORT ~combining_guard();
+
+    private:
+        friend struct combining_guard_release;
+        friend HPX_API_EXPORT void run_guarded_handled(
+            combining_guard& guard, detail::guard_function task,
+            detail::guard_error_handler on_error);
+
+        void push(detail::combining_guard_task* task);
+        detail::combining_guard_task* pop();
+        void drain();
+
+        // the number of tasks submitted and not finished yet, the guard is
+        // owned by whoever increments this from zero
+        std::atomic<std::size_t> pending_;
+
+        // intrusive MPSC queue (D. Vyukov), producers push at head_, the
+        // owner of the guard pops from tail_
+        std::atomic<detail::combining_guard_task*> head_;
+        detail::combining_guard_task* tail_;
+        detail::combining_guard_task stub_;
+    };
+
     /// Conceptually, a guard acts like a mutex on an asynchronous task. The
     /// mutex is locked before the task runs, and unlocked afterwards.
     HPX_API_EXPORT void run_guarded(guard& guard, detail::guard_function task);
@@ -180,6 +238,27 @@ namespace hpx { namespace lcos { namespace local
             util::deferred_call(std::forward<F>(f), std::forward<Args>(args)...)));
     }
 
+    /// Run the given task while owning the combining_guard. The task is run
+    /// on the calling thread if the guard is not contended, an exception
+    /// thrown by it is passed to \a on_error.
+    HPX_API_EXPORT void run_guarded_handled(combining_guard& guard,
+        detail::guard_function task, detail::guard_error_handler on_error);
+
+    /// Run the given task while owning the combining_guard. The task is run
+    /// on the calling thread if the guard is not contended, in which case an
+    /// exception thrown by it is rethrown to the caller. An exception thrown
+    /// by a task which was run by another thread is reported and otherwise
+    /// ignored.
+    HPX_API_EXPORT void run_guarded(
+        combining_guard& guard, detail::guard_function task);
+
+    template <typename F, typename ...Args>
+    void run_guarded(combining_guard& guard, F&& f, Args&&... args)
+    {
+        return run_guarded(guard, detail::guard_function(
+            util::deferred_call(std::forward<F>(f), std::forward<Args>(args)...)));
+    }
+
     /// Conceptually, a guard_set acts like a set of mutexes on an asynchronous task.
     /// The mutexes are locked before the task runs, and unlocked afterwards.
     HPX_API_EXPORT void run_guarded(guard_set& guards, detail::guard_function task);
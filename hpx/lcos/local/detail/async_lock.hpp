@@ -0,0 +1,107 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_DETAIL_ASYNC_LOCK_HPP)
+#define HPX_LCOS_LOCAL_DETAIL_ASYNC_LOCK_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+
+#include <cstdint>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace local { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // Release policies used by the continuations below
+    template <typename Mutex>
+    struct async_unlock
+    {
+        explicit async_unlock(Mutex& mtx)
+          : mtx_(&mtx)
+        {}
+
+        void operator()() const
+        {
+            mtx_->unlock();
+        }
+
+        Mutex* mtx_;
+    };
+
+    template <typename Semaphore>
+    struct async_signal
+    {
+        async_signal(Semaphore& sem, std::int64_t count)
+          : sem_(&sem), count_(count)
+        {}
+
+        void operator()() const
+        {
+            sem_->signal(count_);
+        }
+
+        Semaphore* sem_;
+        std::int64_t count_;
+    };
+
+    // Make sure the lock is released even if the guarded function throws.
+    template <typename Release>
+    struct release_on_exit
+    {
+        explicit release_on_exit(Release const& release)
+          : release_(release)
+        {}
+
+        ~release_on_exit()
+        {
+            release_();
+        }
+
+        Release const& release_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The continuation attached to the future returned from lock_async(). It
+    // is invoked while owning the lock and releases it after the wrapped
+    // function has finished executing.
+    template <typename Release, typename F, typename R>
+    struct async_guarded_call
+    {
+        async_guarded_call(Release const& release, F && f)
+          : release_(release), f_(std::move(f))
+        {}
+
+        R operator()(hpx::future<void> && f)
+        {
+            f.get();                // propagate exceptions, if any
+            release_on_exit<Release> on_exit(release_);
+            return f_();
+        }
+
+        Release release_;
+        F f_;
+    };
+
+    template <typename Release, typename F>
+    struct async_guarded_call<Release, F, void>
+    {
+        async_guarded_call(Release const& release, F && f)
+          : release_(release), f_(std::move(f))
+        {}
+
+        void operator()(hpx::future<void> && f)
+        {
+            f.get();                // propagate exceptions, if any
+            release_on_exit<Release> on_exit(release_);
+            f_();
+        }
+
+        Release release_;
+        F f_;
+    };
+}}}}
+
+#endif
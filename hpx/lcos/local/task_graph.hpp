@@ -0,0 +1,286 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_LCOS_LOCAL_TASK_GRAPH_HPP)
+#define HPX_LCOS_LOCAL_TASK_GRAPH_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/detail/pack.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/optional.hpp>
+#include <hpx/util/result_of.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <initializer_list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_MSVC_WARNING_PRAGMA)
+#pragma warning(push)
+#pragma warning(disable: 4251)
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace lcos { namespace local
+{
+    /// A task_graph records a directed acyclic graph of tasks once and allows
+    /// to execute (replay) it any number of times afterwards.
+    ///
+    /// Building the same graph of futures for every time step of an
+    /// iterative algorithm (e.g. using dataflow) requires allocating a shared
+    /// state for each task, registering continuations and checking for
+    /// readiness over and over again. A task_graph instead pre-computes the
+    /// successors and the number of dependencies of each node when it is
+    /// captured. Replaying it only resets the dependency counters and
+    /// schedules the nodes directly as soon as all of their predecessors have
+    /// finished running.
+    ///
+    /// Nodes added using add() run tasks which do not return values, they
+    /// communicate through memory owned by the application (as in the usual
+    /// double-buffered stencil codes). Nodes added using add_typed() run
+    /// tasks returning a value, which is stored in the graph and passed to
+    /// the tasks of the nodes depending on them, similar to dataflow. In
+    /// both cases new inputs for a replay are supplied by modifying memory
+    /// referred to by the tasks (or by swapping buffers) in between two
+    /// invocations of run().
+    class task_graph
+    {
+    public:
+        HPX_NON_COPYABLE(task_graph);
+
+    public:
+        typedef util::function_nonser<void()> task_function;
+
+        /// The handle referring to a node of the graph.
+        class node
+        {
+        public:
+            node()
+              : graph_(nullptr)
+              , index_(std::size_t(-1))
+            {}
+
+            bool valid() const
+            {
+                return graph_ != nullptr;
+            }
+
+            std::size_t index() const
+            {
+                return index_;
+            }
+
+        private:
+            friend class task_graph;
+
+            node(task_graph const* graph, std::size_t index)
+              : graph_(graph)
+              , index_(index)
+            {}
+
+            task_graph const* graph_;
+            std::size_t index_;
+        };
+
+        /// The handle referring to a node of the graph whose task returns a
+        /// value of type \a T. It can be used as a dependency wherever an
+        /// untyped node can be used.
+        template <typename T>
+        class typed_node : public node
+        {
+        public:
+            typed_node() = default;
+
+            /// \brief Return the value computed by this node during the
+            ///        last run of the graph.
+            ///
+            /// \note This must not be called before the future returned by
+            ///       run() has become ready, and only if the run succeeded.
+            T const& get() const
+            {
+                HPX_ASSERT(result_ && result_->has_value());
+                return **result_;
+            }
+
+        private:
+            friend class task_graph;
+
+            typed_node(node const& n,
+                    std::shared_ptr<util::optional<T> > result)
+              : node(n)
+              , result_(std::move(result))
+            {}
+
+            std::shared_ptr<util::optional<T> > result_;
+        };
+
+    public:
+        HPX_EXPORT task_graph();
+        HPX_EXPORT ~task_graph();
+
+        /// \brief Add a new node to the graph which does not depend on any
+        ///        other node.
+        ///
+        /// \param f    The function to execute whenever the graph is run.
+        ///
+        /// \returns The handle referring to the newly added node.
+        node add(task_function f)
+        {
+            return add_node(std::move(f), nullptr, 0);
+        }
+
+        /// \brief Add a new node to the graph which will be executed only
+        ///        after all of the given nodes have finished executing.
+        ///
+        /// \param f    The function to execute whenever the graph is run.
+        /// \param deps The nodes this node depends on. All of those need to
+        ///             have been added to this graph before.
+        ///
+        /// \returns The handle referring to the newly added node.
+        node add(task_function f, std::initializer_list<node> deps)
+        {
+            return add_node(std::move(f), deps.begin(), deps.size());
+        }
+
+        node add(task_function f, std::vector<node> const& deps)
+        {
+            return add_node(std::move(f), deps.data(), deps.size());
+        }
+
+        /// \brief Add a new node to the graph whose task computes a value
+        ///        from the values of the given nodes.
+        ///
+        /// \param f    The function to execute whenever the graph is run.
+        ///             It is invoked with the values computed by the given
+        ///             nodes (as const references) during the same run, and
+        ///             has to return a (non-void) value.
+        /// \param deps The nodes this node depends on. All of those need to
+        ///             have been added to this graph before.
+        ///
+        /// \returns The handle referring to the newly added node, which
+        ///          gives access to the computed value.
+        template <typename F, typename ... Ts>
+        typed_node<typename util::invoke_result<
+            typename std::decay<F>::type&, Ts const&...
+        >::type>
+        add_typed(F && f, typed_node<Ts> const&... deps)
+        {
+            typedef typename util::invoke_result<
+                    typename std::decay<F>::type&, Ts const&...
+                >::type result_type;
+
+            static_assert(!std::is_void<result_type>::value,
+                "the task of a typed node has to return a value, use add() "
+                "for tasks without a result");
+
+            std::shared_ptr<util::optional<result_type> > result =
+                std::make_shared<util::optional<result_type> >();
+
+            // the leading element avoids a zero sized array
+            node const dep_nodes[] = { node(), deps... };
+            node n = add_node(
+                typed_task<typename std::decay<F>::type, result_type, Ts...>{
+                    std::forward<F>(f), result, util::make_tuple(deps...)
+                },
+                dep_nodes + 1, sizeof...(Ts));
+
+            return typed_node<result_type>(n, std::move(result));
+        }
+
+        /// \brief Execute all nodes of the graph respecting their
+        ///        dependencies.
+        ///
+        /// \returns A future which becomes ready once all nodes have been
+        ///          executed. If any of the tasks threw an exception the
+        ///          nodes not yet started are skipped and the (first)
+        ///          exception is reported through the returned future.
+        ///
+        /// \note The graph must not be modified or run again before the
+        ///       returned future has become ready.
+        HPX_EXPORT hpx::future<void> run();
+
+        /// \brief Return the number of nodes in the graph
+        std::size_t size() const
+        {
+            return nodes_.size();
+        }
+
+        /// \brief Remove all nodes from the graph
+        HPX_EXPORT void clear();
+
+    private:
+        HPX_EXPORT node add_node(
+            task_function && f, node const* deps, std::size_t num_deps);
+
+        // invokes the function of a typed node with the values of its
+        // dependencies and stores the result
+        template <typename F, typename R, typename ... Ts>
+        struct typed_task
+        {
+            void operator()()
+            {
+                invoke(typename util::detail::make_index_pack<
+                    sizeof...(Ts)>::type());
+            }
+
+            template <std::size_t ... Is>
+            void invoke(util::detail::pack_c<std::size_t, Is...>)
+            {
+                result_->emplace(
+                    util::invoke(f_, util::get<Is>(deps_).get()...));
+            }
+
+            F f_;
+            std::shared_ptr<util::optional<R> > result_;
+            util::tuple<typed_node<Ts>...> deps_;
+        };
+
+        void prepare();
+        void execute(std::size_t index);
+        void finish_node(std::size_t& next);
+        void set_exception(std::exception_ptr const& e);
+
+        struct node_data
+        {
+            task_function f_;
+            std::vector<std::size_t> successors_;
+            std::size_t num_dependencies_;
+        };
+
+        typedef lcos::local::spinlock mutex_type;
+
+        std::vector<node_data> nodes_;
+        std::vector<std::size_t> roots_;
+
+        // pre-allocated dependency counters, one per node, (re-)created on
+        // first use after the graph was modified
+        std::unique_ptr<std::atomic<std::size_t>[]> counters_;
+        bool prepared_;
+
+        std::atomic<std::size_t> remaining_;
+        std::atomic<bool> running_;
+        std::atomic<bool> failed_;
+
+        mutex_type mtx_;
+        std::exception_ptr exception_;
+        lcos::local::promise<void> done_;
+    };
+}}}
+
+#if defined(HPX_MSVC_WARNING_PRAGMA)
+#pragma warning(pop)
+#endif
+
+#endif
@@ -0,0 +1,204 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/pipelined_broadcast.hpp
+
+#if !defined(HPX_LCOS_PIPELINED_BROADCAST_HPP)
+#define HPX_LCOS_PIPELINED_BROADCAST_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/config_entry.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/safe_lexical_cast.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        // the size (in bytes) of the segments a large buffer is split into,
+        // invalid sizes (including 0) are replaced by the default
+        inline std::size_t read_broadcast_segment_size()
+        {
+            std::size_t const segment_size =
+                hpx::util::safe_lexical_cast<std::size_t>(get_config_entry(
+                    "hpx.lcos.collectives.broadcast_segment_size", 262144),
+                    std::size_t(262144));
+            return segment_size != 0 ? segment_size : std::size_t(262144);
+        }
+
+        inline std::size_t get_broadcast_segment_size()
+        {
+            static std::size_t const segment_size =
+                read_broadcast_segment_size();
+            return segment_size;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The sites form a binary tree rooted at the given site. The root
+        // splits the buffer into segments and sends them to its children one
+        // by one. Every other site forwards each segment to its children as
+        // soon as it has arrived, without waiting for the remaining ones, so
+        // that all levels of the tree are busy at the same time. The total
+        // time is roughly proportional to size + depth * segment size, as
+        // opposed to depth * size when forwarding the whole buffer.
+        //
+        // The first message (tag 0) holds the number of elements and the
+        // number of elements per segment, segment i is sent using tag i + 1.
+        template <typename T>
+        serialization::serialize_buffer<T> pipelined_broadcast_tree(
+            communicator comm, std::size_t generation,
+            serialization::serialize_buffer<T> data, std::size_t root)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+            if (num_sites == 1)
+                return data;
+
+            // the position of this site in the tree
+            std::size_t const rank = (this_site + num_sites - root) % num_sites;
+
+            std::vector<std::size_t> children;
+            for (std::size_t child = 2 * rank + 1;
+                 child <= 2 * rank + 2 && child < num_sites; ++child)
+            {
+                children.push_back((child + root) % num_sites);
+            }
+
+            std::vector<hpx::future<void> > sends;
+
+            auto forward =
+                [&](std::size_t tag, communicator::buffer_type const& msg)
+                {
+                    for (std::size_t child : children)
+                        sends.push_back(comm.send(child, generation, tag, msg));
+                };
+
+            std::size_t header[2] = { 0, 0 };
+            if (rank == 0)
+            {
+                header[0] = data.size();
+                header[1] = (std::max)(
+                    get_broadcast_segment_size() / sizeof(T), std::size_t(1));
+                forward(0, serialize_range(header, 2));
+
+                std::size_t tag = 1;
+                for (std::size_t first = 0; first < header[0];
+                     first += header[1], ++tag)
+                {
+                    std::size_t const count =
+                        (std::min)(header[1], header[0] - first);
+                    forward(tag, as_message(data, first, count));
+                }
+            }
+            else
+            {
+                std::size_t const parent =
+                    ((rank - 1) / 2 + root) % num_sites;
+
+                communicator::buffer_type msg =
+                    comm.receive(parent, generation, 0).get();
+                forward(0, msg);
+                deserialize_range(msg, header, 2);
+
+                // request all segments up front, they are handled in order
+                std::size_t const num_segments =
+                    (header[0] + header[1] - 1) / header[1];
+
+                std::vector<hpx::future<communicator::buffer_type> > segments;
+                segments.reserve(num_segments);
+                for (std::size_t i = 0; i != num_segments; ++i)
+                    segments.push_back(comm.receive(parent, generation, i + 1));
+
+                // a single segment is handed out without copying it
+                if (num_segments == 1)
+                {
+                    msg = segments[0].get();
+                    forward(1, msg);
+                    data = from_message<T>(msg);
+                }
+                else
+                {
+                    data = serialization::serialize_buffer<T>(header[0]);
+                    for (std::size_t i = 0; i != num_segments; ++i)
+                    {
+                        msg = segments[i].get();
+                        forward(i + 1, msg);
+
+                        HPX_ASSERT(msg.size() % sizeof(T) == 0);
+                        std::memcpy(data.data() + i * header[1], msg.data(),
+                            msg.size());
+                    }
+                }
+            }
+
+            for (hpx::future<void>& f : sends)
+                f.get();
+
+            return data;
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Broadcast a (large) buffer from one site to all sites of a communicator
+    ///
+    /// The buffer given by the root site is split into segments of
+    /// hpx.lcos.collectives.broadcast_segment_size bytes (256kB by default),
+    /// which are sent down a binary tree spanning all sites. Every site
+    /// forwards each segment to its children as soon as it has been received,
+    /// which overlaps the transfers on all levels of the tree. The segments
+    /// are sent without copying the data of the buffer.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  data        The buffer to broadcast. It is ignored on all
+    ///                     sites but the root site. Its elements have to be
+    ///                     bitwise serializable.
+    /// \param  root        The sequence number of the site providing the data.
+    ///                     This is optional and defaults to zero.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the buffer sent by
+    ///             the root site. It will become ready once this site has
+    ///             received and forwarded all segments.
+    ///
+    template <typename T>
+    hpx::future<serialization::serialize_buffer<T> >
+    pipelined_broadcast(communicator& comm,
+        serialization::serialize_buffer<T> data, std::size_t root = 0,
+        std::size_t generation = std::size_t(-1))
+    {
+        if (root >= comm.num_sites())
+        {
+            return hpx::make_exceptional_future<
+                    serialization::serialize_buffer<T>
+                >(HPX_GET_EXCEPTION(bad_parameter,
+                    "hpx::lcos::pipelined_broadcast",
+                    "the given root site is out of range: " +
+                        std::to_string(root)));
+        }
+
+        return hpx::async(&detail::pipelined_broadcast_tree<T>, comm,
+            comm.next_generation(generation), std::move(data), root);
+    }
+}}
+
+#endif
@@ -0,0 +1,257 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/scan.hpp
+
+#if !defined(HPX_LCOS_SCAN_HPP)
+#define HPX_LCOS_SCAN_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/optional.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos
+{
+    /// \cond NOINTERNAL
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // Recursive doubling: in round k every site i sends its partial
+        // result, which covers the values of the sites (i - 2^k, i], to site
+        // i + 2^k and prepends the partial result received from site i - 2^k.
+        // After ceil(log2(N)) rounds the partial result of site i covers the
+        // values of the sites [0, i]. The values received by a site cover
+        // the adjacent ranges left of it, so they are combined into the
+        // exclusive result as well.
+        //
+        // The values are always combined in the order of the sites, which
+        // allows for non-commutative operations.
+        template <typename T, typename F>
+        T scan_recursive_doubling(communicator comm, std::size_t generation,
+            T value, F op, util::optional<T> init)
+        {
+            std::size_t const num_sites = comm.num_sites();
+            std::size_t const this_site = comm.this_site();
+
+            util::optional<T> exclusive;
+            std::vector<hpx::future<void> > sends;
+
+            std::size_t tag = 0;
+            for (std::size_t dist = 1; dist < num_sites; dist *= 2, ++tag)
+            {
+                if (this_site + dist < num_sites)
+                {
+                    sends.push_back(comm.send(this_site + dist, generation,
+                        tag, serialize_value(value)));
+                }
+
+                if (this_site >= dist)
+                {
+                    T other = deserialize_value<T>(
+                        comm.receive(this_site - dist, generation, tag).get());
+
+                    if (init)
+                    {
+                        if (exclusive)
+                            exclusive = op(other, std::move(*exclusive));
+                        else
+                            exclusive = other;
+                    }
+                    value = op(std::move(other), std::move(value));
+                }
+            }
+
+            wait_for_sends(sends);
+
+            if (!init)
+                return value;
+            if (!exclusive)
+                return std::move(*init);
+            return op(std::move(*init), std::move(*exclusive));
+        }
+    }
+    /// \endcond
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Compute the inclusive prefix reduction of the values given by the
+    /// sites of a communicator
+    ///
+    /// Site i receives the combination of the values given by the sites
+    /// 0 ... i. The algorithm finishes after ceil(log2(N)) rounds, in each
+    /// of which every site sends and receives at most one message.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_value The value contributed by this site.
+    /// \param  op          The binary operation used to combine the values.
+    ///                     It has to be associative, the values are always
+    ///                     combined in the order of the sites.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the prefix
+    ///             reduction up to and including this site. It will become
+    ///             ready once the scan operation has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<typename util::decay<T>::type>
+    inclusive_scan(communicator& comm, T && local_value, F && op,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<T>::type value_type;
+        typedef typename util::decay<F>::type op_type;
+
+        return hpx::async(
+            &detail::scan_recursive_doubling<value_type, op_type>,
+            comm, comm.next_generation(generation),
+            std::forward<T>(local_value), std::forward<F>(op),
+            util::optional<value_type>());
+    }
+
+    /// Compute the exclusive prefix reduction of the values given by the
+    /// sites of a communicator
+    ///
+    /// Site 0 receives \a init, site i > 0 receives the combination of
+    /// \a init and the values given by the sites 0 ... i - 1. This is
+    /// commonly used to compute the offsets of the data held by the sites
+    /// within a global sequence. The algorithm is the same as for
+    /// \a inclusive_scan.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_value The value contributed by this site.
+    /// \param  init        The initial value, it has to be the same on all
+    ///                     sites.
+    /// \param  op          The binary operation used to combine the values.
+    ///                     It has to be associative, the values are always
+    ///                     combined in the order of the sites.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the prefix
+    ///             reduction of all sites before this one. It will become
+    ///             ready once the scan operation has been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<typename util::decay<T>::type>
+    exclusive_scan(communicator& comm, T && local_value,
+        typename util::decay<T>::type init, F && op,
+        std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<T>::type value_type;
+        typedef typename util::decay<F>::type op_type;
+
+        return hpx::async(
+            &detail::scan_recursive_doubling<value_type, op_type>,
+            comm, comm.next_generation(generation),
+            std::forward<T>(local_value), std::forward<F>(op),
+            util::optional<value_type>(std::move(init)));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Compute the inclusive prefix reductions of arrays of values given by
+    /// the sites of a communicator element by element
+    ///
+    /// Element j of the array returned to site i is the combination of the
+    /// elements j of the arrays given by the sites 0 ... i. All sites have
+    /// to contribute arrays of the same size.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_value The array contributed by this site.
+    /// \param  op          The binary operation used to combine the elements,
+    ///                     it has to be associative. The operations defined
+    ///                     in hpx::lcos::reduction are applied to whole
+    ///                     vector packs for arithmetic types if datapar
+    ///                     support is available.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the resulting
+    ///             array. It will become ready once the scan operation has
+    ///             been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T> >
+    inclusive_scan_elements(communicator& comm, std::vector<T> local_value,
+        F && op, std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<F>::type op_type;
+        typedef detail::elementwise_op<op_type> elementwise_type;
+
+        elementwise_type elementwise = { std::forward<F>(op) };
+        return hpx::async(
+            &detail::scan_recursive_doubling<std::vector<T>, elementwise_type>,
+            comm, comm.next_generation(generation), std::move(local_value),
+            std::move(elementwise), util::optional<std::vector<T> >());
+    }
+
+    /// Compute the exclusive prefix reductions of arrays of values given by
+    /// the sites of a communicator element by element
+    ///
+    /// Element j of the array returned to site 0 is \a init, element j of
+    /// the array returned to site i > 0 is the combination of \a init and
+    /// the elements j of the arrays given by the sites 0 ... i - 1. All
+    /// sites have to contribute arrays of the same size.
+    ///
+    /// \param  comm        The communicator identifying the participating
+    ///                     sites.
+    /// \param  local_value The array contributed by this site.
+    /// \param  init        The initial value of all elements, it has to be
+    ///                     the same on all sites.
+    /// \param  op          The binary operation used to combine the elements,
+    ///                     it has to be associative. The operations defined
+    ///                     in hpx::lcos::reduction are applied to whole
+    ///                     vector packs for arithmetic types if datapar
+    ///                     support is available.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the collective operation performed on
+    ///                     the given communicator. This is optional and
+    ///                     defaults to the next generation of the
+    ///                     communicator.
+    ///
+    /// \returns    This function returns a future holding the resulting
+    ///             array. It will become ready once the scan operation has
+    ///             been completed.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::vector<T> >
+    exclusive_scan_elements(communicator& comm, std::vector<T> local_value,
+        T const& init, F && op, std::size_t generation = std::size_t(-1))
+    {
+        typedef typename util::decay<F>::type op_type;
+        typedef detail::elementwise_op<op_type> elementwise_type;
+
+        std::vector<T> initial(local_value.size(), init);
+
+        elementwise_type elementwise = { std::forward<F>(op) };
+        return hpx::async(
+            &detail::scan_recursive_doubling<std::vector<T>, elementwise_type>,
+            comm, comm.next_generation(generation), std::move(local_value),
+            std::move(elementwise),
+            util::optional<std::vector<T> >(std::move(initial)));
+    }
+}}
+
+#endif
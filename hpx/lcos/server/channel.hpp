@@ -9,9 +9,12 @@
 #include <hpx/config.hpp>
 #include <hpx/lcos/base_lco_with_value.hpp>
 #include <hpx/lcos/local/channel.hpp>
+#include <hpx/lcos/when_all.hpp>
+#include <hpx/plugins/parcel/coalescing_message_handler_registration.hpp>
 #include <hpx/runtime/actions/component_action.hpp>
 #include <hpx/runtime/components/component_type.hpp>
 #include <hpx/runtime/components/server/component_base.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
 #include <hpx/traits/get_remote_result.hpp>
 #include <hpx/traits/is_component.hpp>
 #include <hpx/traits/promise_remote_result.hpp>
@@ -24,6 +27,7 @@
 #include <exception>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace lcos { namespace server
@@ -104,6 +108,37 @@ namespace hpx { namespace lcos { namespace server
         }
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, set_generation);
 
+        // Push a sequence of values to the channel using a single message
+        void set_values(std::vector<RemoteType> && values)
+        {
+            for (RemoteType& value : values)
+                channel_.set(std::move(value));
+        }
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, set_values);
+
+        // Retrieve the next count values from the channel using a single
+        // message
+        hpx::future<std::vector<result_type> > get_values(std::size_t count)
+        {
+            std::vector<hpx::future<result_type> > values;
+            values.reserve(count);
+            for (std::size_t i = 0; i != count; ++i)
+                values.push_back(channel_.get());
+
+            return hpx::when_all(values).then(hpx::launch::sync,
+                [](hpx::future<std::vector<hpx::future<result_type> > > && f)
+                {
+                    std::vector<hpx::future<result_type> > values = f.get();
+
+                    std::vector<result_type> result;
+                    result.reserve(values.size());
+                    for (hpx::future<result_type>& value : values)
+                        result.push_back(value.get());
+                    return result;
+                });
+        }
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(channel, get_values);
+
         std::size_t close(bool force_delete_entries)
         {
             return channel_.close(force_delete_entries);
@@ -138,6 +173,14 @@ namespace hpx { namespace lcos { namespace server
         hpx::lcos::server::channel< type>::set_generation_action,             \
         HPX_PP_CAT(__channel_set_generation_action,                           \
             HPX_PP_CAT(type, name)));                                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::server::channel< type>::set_values_action,                 \
+        HPX_PP_CAT(__channel_set_values_action,                               \
+            HPX_PP_CAT(type, name)));                                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                          \
+        hpx::lcos::server::channel< type>::get_values_action,                 \
+        HPX_PP_CAT(__channel_get_values_action,                               \
+            HPX_PP_CAT(type, name)));                                         \
     HPX_REGISTER_ACTION_DECLARATION(                                          \
         hpx::lcos::server::channel< type>::close_action,                      \
         HPX_PP_CAT(__channel_close_action,                                    \
@@ -176,6 +219,14 @@ namespace hpx { namespace lcos { namespace server
         hpx::lcos::server::channel< type>::set_generation_action,             \
         HPX_PP_CAT(__channel_set_generation_action,                           \
             HPX_PP_CAT(type, name)));                                         \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::server::channel< type>::set_values_action,                 \
+        HPX_PP_CAT(__channel_set_values_action,                               \
+            HPX_PP_CAT(type, name)));                                         \
+    HPX_REGISTER_ACTION(                                                      \
+        hpx::lcos::server::channel< type>::get_values_action,                 \
+        HPX_PP_CAT(__channel_get_values_action,                               \
+            HPX_PP_CAT(type, name)));                                         \
     HPX_REGISTER_ACTION(                                                      \
         hpx::lcos::server::channel< type>::close_action,                      \
         HPX_PP_CAT(__channel_close_action,                                    \
@@ -183,4 +234,32 @@ namespace hpx { namespace lcos { namespace server
     HPX_REGISTER_BASE_LCO_WITH_VALUE(type, type, name, component_tag)         \
 /**/
 
+// Let the parcels setting values of a channel of the given type be combined
+// by the coalescing message handler (if available), the parcels are sent
+// once enough of them have been collected or after a time interval (see
+// hpx.plugins.coalescing_message_handler). This has to be used in the same
+// translation unit as HPX_REGISTER_CHANNEL.
+#define HPX_CHANNEL_USES_MESSAGE_COALESCING(...)                              \
+    HPX_CHANNEL_USES_MESSAGE_COALESCING_(__VA_ARGS__)                         \
+/**/
+#define HPX_CHANNEL_USES_MESSAGE_COALESCING_(...)                             \
+    HPX_PP_EXPAND(HPX_PP_CAT(                                                 \
+        HPX_CHANNEL_USES_MESSAGE_COALESCING_, HPX_PP_NARGS(__VA_ARGS__)       \
+    )(__VA_ARGS__))                                                           \
+/**/
+
+#define HPX_CHANNEL_USES_MESSAGE_COALESCING_1(type)                           \
+    HPX_CHANNEL_USES_MESSAGE_COALESCING_2(type, type)                         \
+/**/
+#define HPX_CHANNEL_USES_MESSAGE_COALESCING_2(type, name)                     \
+    HPX_ACTION_USES_MESSAGE_COALESCING_NOTHROW(                               \
+        hpx::lcos::server::channel< type>::set_generation_action,             \
+        HPX_PP_STRINGIZE(HPX_PP_CAT(channel_set_action_, name)),              \
+        std::size_t(-1), std::size_t(-1))                                     \
+    HPX_ACTION_USES_MESSAGE_COALESCING_NOTHROW(                               \
+        hpx::lcos::server::channel< type>::set_values_action,                 \
+        HPX_PP_STRINGIZE(HPX_PP_CAT(channel_set_action_, name)),              \
+        std::size_t(-1), std::size_t(-1))                                     \
+/**/
+
 #endif
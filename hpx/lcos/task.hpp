@@ -0,0 +1,410 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/lcos/task.hpp
+
+#if !defined(HPX_LCOS_TASK_HPP)
+#define HPX_LCOS_TASK_HPP
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_AWAIT)
+
+#include <hpx/lcos/detail/coroutine_frame_allocator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/channel.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/traits/future_access.hpp>
+#include <hpx/util/optional.hpp>
+
+#if defined(HPX_HAVE_EMULATE_COROUTINE_SUPPORT_LIBRARY)
+#include <hpx/util/await_traits.hpp>
+#else
+#include <experimental/coroutine>
+#endif
+
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace lcos
+{
+    template <typename T = void>
+    class task;
+
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // The callable registered with a shared state to resume a suspended
+        // coroutine. It is small enough to be stored without allocating.
+        struct resume_coroutine
+        {
+            void operator()()
+            {
+                handle_.resume();
+            }
+
+            std::experimental::coroutine_handle<> handle_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Awaiting a future directly attaches the resumption of the awaiting
+        // coroutine to the shared state of the future. The future is kept in
+        // the coroutine frame, which avoids copying the reference to the
+        // shared state and attaching a continuation which would create
+        // another shared state (as future::then would do).
+        template <typename Future>
+        struct future_awaiter
+        {
+            explicit future_awaiter(Future && f)
+              : f_(std::move(f))
+            {}
+
+            bool await_ready() const
+            {
+                return f_.is_ready();
+            }
+
+            void await_suspend(std::experimental::coroutine_handle<> h)
+            {
+                // the coroutine may be resumed and its frame (including f_)
+                // destroyed before set_on_completed returns
+                auto st = traits::detail::get_shared_state(f_);
+                st->set_on_completed(resume_coroutine{h});
+            }
+
+            decltype(std::declval<Future&>().get()) await_resume()
+            {
+                return f_.get();
+            }
+
+            Future f_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Awaiting an executor continues the awaiting coroutine on a new
+        // thread created by that executor.
+        template <typename Executor>
+        struct executor_awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            void await_suspend(std::experimental::coroutine_handle<> h)
+            {
+                parallel::execution::post(exec_, resume_coroutine{h});
+            }
+
+            void await_resume() const noexcept {}
+
+            Executor exec_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        struct task_promise_base
+        {
+            // the coroutine frames are allocated from a per worker cache
+            static void* operator new(std::size_t size)
+            {
+                return allocate_coroutine_frame(size);
+            }
+
+            static void operator delete(void* p, std::size_t size) noexcept
+            {
+                deallocate_coroutine_frame(p, size);
+            }
+
+            // tasks are started lazily, once they are awaited
+            std::experimental::suspend_always initial_suspend() noexcept
+            {
+                return std::experimental::suspend_always{};
+            }
+
+            // transfer control directly to the awaiting coroutine
+            struct final_awaiter
+            {
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                template <typename Promise>
+                std::experimental::coroutine_handle<> await_suspend(
+                    std::experimental::coroutine_handle<Promise> h) noexcept
+                {
+                    return h.promise().continuation_;
+                }
+
+                void await_resume() const noexcept {}
+            };
+
+            final_awaiter final_suspend() noexcept
+            {
+                return final_awaiter{};
+            }
+
+            void set_exception(std::exception_ptr e)
+            {
+                exception_ = std::move(e);
+            }
+
+            void unhandled_exception()
+            {
+                exception_ = std::current_exception();
+            }
+
+            void rethrow_if_exception()
+            {
+                if (exception_)
+                    std::rethrow_exception(exception_);
+            }
+
+            ///////////////////////////////////////////////////////////////////
+            // customize co_await for futures, channels, and executors
+            template <typename T>
+            future_awaiter<hpx::future<T> > await_transform(
+                hpx::future<T> && f)
+            {
+                return future_awaiter<hpx::future<T> >(std::move(f));
+            }
+
+            // awaiting a future consumes it, which has to be explicit
+            // (co_await std::move(f)) to not invalidate the caller's future
+            template <typename T>
+            void await_transform(hpx::future<T>& f) = delete;
+
+            template <typename T>
+            future_awaiter<hpx::shared_future<T> > await_transform(
+                hpx::shared_future<T> f)
+            {
+                return future_awaiter<hpx::shared_future<T> >(std::move(f));
+            }
+
+            // co_await on a channel receives the next value
+            template <typename T>
+            future_awaiter<hpx::future<T> > await_transform(
+                local::channel<T> c)
+            {
+                return future_awaiter<hpx::future<T> >(c.get());
+            }
+
+            template <typename T>
+            future_awaiter<hpx::future<T> > await_transform(
+                local::receive_channel<T> c)
+            {
+                return future_awaiter<hpx::future<T> >(c.get());
+            }
+
+            // co_await on an executor reschedules the coroutine
+            template <typename Executor>
+            typename std::enable_if<
+                parallel::execution::is_one_way_executor<
+                    typename std::decay<Executor>::type>::value,
+                executor_awaiter<typename std::decay<Executor>::type>
+            >::type
+            await_transform(Executor && exec)
+            {
+                return executor_awaiter<typename std::decay<Executor>::type>{
+                    std::forward<Executor>(exec)};
+            }
+
+            // everything else is awaited as is
+            template <typename Awaitable>
+            typename std::enable_if<
+                !parallel::execution::is_one_way_executor<
+                    typename std::decay<Awaitable>::type>::value,
+                Awaitable&&
+            >::type
+            await_transform(Awaitable && a) noexcept
+            {
+                return std::forward<Awaitable>(a);
+            }
+
+            std::experimental::coroutine_handle<> continuation_;
+            std::exception_ptr exception_;
+        };
+
+        template <typename T>
+        struct task_promise : task_promise_base
+        {
+            task<T> get_return_object();
+
+            template <typename U>
+            void return_value(U && value)
+            {
+                value_.emplace(std::forward<U>(value));
+            }
+
+            T get()
+            {
+                rethrow_if_exception();
+                return std::move(*value_);
+            }
+
+            util::optional<T> value_;
+        };
+
+        template <>
+        struct task_promise<void> : task_promise_base
+        {
+            task<void> get_return_object();
+
+            void return_void() noexcept {}
+
+            void get()
+            {
+                rethrow_if_exception();
+            }
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A task<T> is the return type of a lazily started, stackless coroutine
+    /// producing a value of type T. The coroutine starts running only once
+    /// the task is awaited by another coroutine, in which case control is
+    /// transferred directly between the two coroutines without creating a
+    /// shared state or scheduling an HPX thread. A task which is completed
+    /// resumes the coroutine awaiting it (symmetric transfer).
+    ///
+    /// Inside a task the following expressions may be awaited without
+    /// creating an intermediate shared state:
+    ///
+    ///   - hpx::future<T> and hpx::shared_future<T>: the coroutine is resumed
+    ///     once the future becomes ready.
+    ///   - hpx::lcos::local::channel<T> and receive_channel<T>: the coroutine
+    ///     is resumed with the next value received from the channel.
+    ///   - any one-way executor: the coroutine is resumed on a new thread
+    ///     created by the executor.
+    ///
+    /// Use hpx::lcos::to_future to start a task from a non-coroutine context.
+    template <typename T>
+    class task
+    {
+    public:
+        typedef detail::task_promise<T> promise_type;
+        typedef std::experimental::coroutine_handle<promise_type> handle_type;
+
+        task() noexcept = default;
+
+        explicit task(handle_type h) noexcept
+          : handle_(h)
+        {}
+
+        task(task && rhs) noexcept
+          : handle_(rhs.handle_)
+        {
+            rhs.handle_ = nullptr;
+        }
+
+        task& operator=(task && rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                if (handle_)
+                    handle_.destroy();
+                handle_ = rhs.handle_;
+                rhs.handle_ = nullptr;
+            }
+            return *this;
+        }
+
+        task(task const&) = delete;
+        task& operator=(task const&) = delete;
+
+        ~task()
+        {
+            if (handle_)
+                handle_.destroy();
+        }
+
+        /// Returns whether this task refers to a coroutine
+        bool valid() const noexcept
+        {
+            return static_cast<bool>(handle_);
+        }
+
+        /// Returns whether the coroutine of this task has completed
+        bool is_ready() const noexcept
+        {
+            return !handle_ || handle_.done();
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        bool await_ready() const noexcept
+        {
+            return is_ready();
+        }
+
+        // start the coroutine of this task by transferring control to it,
+        // it resumes the awaiting coroutine once it has completed
+        std::experimental::coroutine_handle<> await_suspend(
+            std::experimental::coroutine_handle<> awaiting) noexcept
+        {
+            handle_.promise().continuation_ = awaiting;
+            return handle_;
+        }
+
+        T await_resume()
+        {
+            return handle_.promise().get();
+        }
+
+    private:
+        handle_type handle_ = nullptr;
+    };
+
+    namespace detail
+    {
+        template <typename T>
+        task<T> task_promise<T>::get_return_object()
+        {
+            return task<T>(
+                task<T>::handle_type::from_promise(*this));
+        }
+
+        inline task<void> task_promise<void>::get_return_object()
+        {
+            return task<void>(
+                task<void>::handle_type::from_promise(*this));
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Start the given task and return a future which becomes ready once the
+    /// task has completed.
+    template <typename T>
+    hpx::future<T> to_future(task<T> t)
+    {
+        co_return co_await std::move(t);
+    }
+
+    inline hpx::future<void> to_future(task<void> t)
+    {
+        co_await std::move(t);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Return an awaitable which, when awaited from a coroutine, resumes the
+    /// coroutine on a new thread created by the given executor.
+    template <typename Executor>
+    detail::executor_awaiter<typename std::decay<Executor>::type>
+    resume_on(Executor && exec)
+    {
+        return detail::executor_awaiter<typename std::decay<Executor>::type>{
+            std::forward<Executor>(exec)};
+    }
+}}
+
+namespace hpx
+{
+    using lcos::task;
+}
+
+#endif
+
+#endif
@@ -0,0 +1,599 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_HISTOGRAM_HPP)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_HISTOGRAM_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // the minimal number of elements distributed in parallel
+    static const std::size_t histogram_limit = 1ul << 15;
+
+    // histograms with at most this many bins are always counted in dense
+    // arrays, larger ones only if the bins are not sparse for a chunk
+    static const std::size_t histogram_dense_bins = 1024;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All bits of the result depend on all bits of the hash value, this
+    // protects the tables below from weak hash functions (std::hash of
+    // integers usually is the identity).
+    inline std::uint64_t histogram_mix(std::uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    // maps a mixed hash value uniformly to [0, num_shards)
+    inline std::size_t histogram_shard(std::uint64_t h,
+        std::size_t num_shards)
+    {
+        return static_cast<std::size_t>(
+            ((h >> 32) * static_cast<std::uint64_t>(num_shards)) >> 32);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // An open addressing hash table (with linear probing) which combines the
+    // values of equal keys. Every chunk of the input sequence is aggregated
+    // in its own table, no synchronization is required.
+    template <typename Key, typename Value, typename Hash, typename KeyEqual>
+    class privatized_table
+    {
+    public:
+        typedef std::pair<Key, Value> entry_type;
+
+        privatized_table(Hash const& hash, KeyEqual const& eq,
+                std::size_t capacity = 16)
+          : hash_(hash), eq_(eq), size_(0)
+        {
+            std::size_t c = 16;
+            while (c < capacity)
+                c *= 2;
+            resize(c);
+        }
+
+        std::size_t size() const
+        {
+            return size_;
+        }
+
+        // INVOKE(op, value, v) is assigned to the value stored for key, v
+        // is stored if the key was not found
+        template <typename K, typename V, typename Op>
+        void combine(K && key, V && v, Op && op)
+        {
+            std::uint64_t const h = histogram_mix(
+                static_cast<std::uint64_t>(hpx::util::invoke(hash_, key)));
+
+            std::size_t const mask = used_.size() - 1;
+            std::size_t i = static_cast<std::size_t>(h) & mask;
+            while (used_[i])
+            {
+                if (hashes_[i] == h && hpx::util::invoke(eq_, keys_[i], key))
+                {
+                    values_[i] = hpx::util::invoke(op, std::move(values_[i]),
+                        std::forward<V>(v));
+                    return;
+                }
+                i = (i + 1) & mask;
+            }
+
+            used_[i] = 1;
+            hashes_[i] = h;
+            keys_[i] = std::forward<K>(key);
+            values_[i] = std::forward<V>(v);
+
+            // keep the load factor below 1/2
+            if (++size_ * 2 > used_.size())
+                resize(used_.size() * 2);
+        }
+
+        // Moves the stored entries to entries, ordered by the shard of their
+        // keys. The entries of shard s end up in the range
+        // [offsets[s], offsets[s + 1]).
+        void extract(std::vector<entry_type>& entries,
+            std::vector<std::size_t>& offsets, std::size_t num_shards)
+        {
+            offsets.assign(num_shards + 1, 0);
+            for (std::size_t i = 0; i != used_.size(); ++i)
+            {
+                if (used_[i])
+                    ++offsets[histogram_shard(hashes_[i], num_shards) + 1];
+            }
+            for (std::size_t s = 0; s != num_shards; ++s)
+                offsets[s + 1] += offsets[s];
+
+            std::vector<std::size_t> pos(offsets.begin(), offsets.end() - 1);
+            entries.resize(size_);
+            for (std::size_t i = 0; i != used_.size(); ++i)
+            {
+                if (used_[i])
+                {
+                    std::size_t& p =
+                        pos[histogram_shard(hashes_[i], num_shards)];
+                    entries[p].first = std::move(keys_[i]);
+                    entries[p].second = std::move(values_[i]);
+                    ++p;
+                }
+            }
+
+            std::vector<unsigned char>().swap(used_);
+            std::vector<std::uint64_t>().swap(hashes_);
+            std::vector<Key>().swap(keys_);
+            std::vector<Value>().swap(values_);
+            size_ = 0;
+        }
+
+        // calls f(key, value) for all stored entries
+        template <typename F>
+        void for_each(F && f)
+        {
+            for (std::size_t i = 0; i != used_.size(); ++i)
+            {
+                if (used_[i])
+                    f(keys_[i], values_[i]);
+            }
+        }
+
+    private:
+        void resize(std::size_t capacity)
+        {
+            std::vector<unsigned char> used(capacity, 0);
+            std::vector<std::uint64_t> hashes(capacity);
+            std::vector<Key> keys(capacity);
+            std::vector<Value> values(capacity);
+
+            std::size_t const mask = capacity - 1;
+            for (std::size_t i = 0; i != used_.size(); ++i)
+            {
+                if (!used_[i])
+                    continue;
+
+                std::size_t j = static_cast<std::size_t>(hashes_[i]) & mask;
+                while (used[j])
+                    j = (j + 1) & mask;
+
+                used[j] = 1;
+                hashes[j] = hashes_[i];
+                keys[j] = std::move(keys_[i]);
+                values[j] = std::move(values_[i]);
+            }
+
+            used_.swap(used);
+            hashes_.swap(hashes);
+            keys_.swap(keys);
+            values_.swap(values);
+        }
+
+        Hash hash_;
+        KeyEqual eq_;
+        std::size_t size_;
+        std::vector<unsigned char> used_;
+        std::vector<std::uint64_t> hashes_;
+        std::vector<Key> keys_;
+        std::vector<Value> values_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct histogram_bin_hash
+    {
+        std::uint64_t operator()(std::size_t bin) const
+        {
+            return bin;
+        }
+    };
+
+    struct histogram_bin_equal
+    {
+        bool operator()(std::size_t lhs, std::size_t rhs) const
+        {
+            return lhs == rhs;
+        }
+    };
+
+    struct histogram_bin_add
+    {
+        std::size_t operator()(std::size_t lhs, std::size_t rhs) const
+        {
+            return lhs + rhs;
+        }
+    };
+
+    typedef privatized_table<
+            std::size_t, std::size_t, histogram_bin_hash, histogram_bin_equal
+        > histogram_table;
+
+    // The bins counted by a single chunk, either in a dense array or as
+    // (bin, count) pairs ordered by the range of bins they belong to.
+    struct histogram_chunk
+    {
+        std::vector<std::size_t> dense;
+        std::vector<std::pair<std::size_t, std::size_t> > sparse;
+        std::vector<std::size_t> offsets;
+    };
+
+    // the bins in [first_bin(r), first_bin(r + 1)) are merged by task r
+    struct histogram_ranges
+    {
+        std::size_t first_bin(std::size_t r) const
+        {
+            return static_cast<std::size_t>(
+                static_cast<std::uint64_t>(r) * num_bins_ / num_ranges_);
+        }
+
+        // the range r for which first_bin(r) <= bin < first_bin(r + 1)
+        std::size_t range(std::size_t bin) const
+        {
+            return static_cast<std::size_t>(
+                ((static_cast<std::uint64_t>(bin) + 1) * num_ranges_ +
+                    num_bins_ - 1) / num_bins_) - 1;
+        }
+
+        std::size_t num_bins_;
+        std::size_t num_ranges_;
+    };
+
+    // the sparse entries are ordered by the range of bins they belong to
+    inline void histogram_sort_sparse(histogram_chunk& chunk,
+        histogram_table& table, histogram_ranges const& ranges)
+    {
+        std::size_t const num_ranges = ranges.num_ranges_;
+        chunk.offsets.assign(num_ranges + 1, 0);
+        table.for_each(
+            [&](std::size_t bin, std::size_t)
+            {
+                ++chunk.offsets[ranges.range(bin) + 1];
+            });
+        for (std::size_t r = 0; r != num_ranges; ++r)
+            chunk.offsets[r + 1] += chunk.offsets[r];
+
+        std::vector<std::size_t> pos(
+            chunk.offsets.begin(), chunk.offsets.end() - 1);
+        chunk.sparse.resize(table.size());
+        table.for_each(
+            [&](std::size_t bin, std::size_t count)
+            {
+                chunk.sparse[pos[ranges.range(bin)]++] =
+                    std::make_pair(bin, count);
+            });
+    }
+
+    // counts the elements of [first, last) per bin INVOKE(proj, *it)
+    template <typename Iter, typename Proj>
+    void histogram_count(Iter first, Iter last, std::size_t num_bins,
+        Proj const& proj, histogram_chunk& chunk,
+        histogram_ranges const& ranges)
+    {
+        std::size_t const count = std::size_t(std::distance(first, last));
+        if (num_bins <= histogram_dense_bins || num_bins <= count)
+        {
+            chunk.dense.assign(num_bins, 0);
+            std::size_t* bins = chunk.dense.data();
+            for (/**/; first != last; ++first)
+            {
+                std::size_t const bin = static_cast<std::size_t>(
+                    hpx::util::invoke(proj, *first));
+                if (bin < num_bins)
+                    ++bins[bin];
+            }
+            return;
+        }
+
+        histogram_table table{histogram_bin_hash(), histogram_bin_equal()};
+        for (/**/; first != last; ++first)
+        {
+            std::size_t const bin = static_cast<std::size_t>(
+                hpx::util::invoke(proj, *first));
+            if (bin < num_bins)
+                table.combine(bin, std::size_t(1), histogram_bin_add());
+        }
+        histogram_sort_sparse(chunk, table, ranges);
+    }
+
+    // adds the counts of the bins of range r from all chunks and assigns
+    // them to the corresponding output elements
+    template <typename FwdIter>
+    void histogram_merge(std::vector<histogram_chunk> const& chunks,
+        histogram_ranges const& ranges, std::size_t r, FwdIter dest)
+    {
+        std::size_t const begin = ranges.first_bin(r);
+        std::size_t const end = ranges.first_bin(r + 1);
+
+        std::vector<std::size_t> counts(end - begin, 0);
+        for (histogram_chunk const& chunk : chunks)
+        {
+            if (!chunk.dense.empty())
+            {
+                std::size_t const* bins = chunk.dense.data();
+                for (std::size_t b = begin; b != end; ++b)
+                    counts[b - begin] += bins[b];
+            }
+            else if (!chunk.offsets.empty())
+            {
+                for (std::size_t i = chunk.offsets[r];
+                     i != chunk.offsets[r + 1]; ++i)
+                {
+                    counts[chunk.sparse[i].first - begin] +=
+                        chunk.sparse[i].second;
+                }
+            }
+        }
+
+        std::advance(dest, begin);
+        for (std::size_t c : counts)
+        {
+            *dest = c;
+            ++dest;
+        }
+    }
+
+    template <typename FwdIter1, typename FwdIter2, typename Proj>
+    FwdIter2 histogram_sequential(FwdIter1 first, FwdIter1 last,
+        FwdIter2 dest, std::size_t num_bins, Proj const& proj)
+    {
+        if (num_bins == 0)
+            return dest;
+
+        histogram_ranges const ranges = { num_bins, 1 };
+        std::vector<histogram_chunk> chunks(1);
+        histogram_count(first, last, num_bins, proj, chunks[0], ranges);
+        histogram_merge(chunks, ranges, 0, dest);
+
+        return std::next(dest, num_bins);
+    }
+
+    template <typename ExPolicy, typename RandomIt, typename FwdIter,
+        typename Proj>
+    FwdIter histogram_parallel(ExPolicy const& policy, RandomIt first,
+        RandomIt last, FwdIter dest, std::size_t num_bins, Proj const& proj,
+        std::size_t num_chunks)
+    {
+        std::size_t const count = std::size_t(last - first);
+        if (count < histogram_limit || num_chunks < 2 || num_bins == 0)
+        {
+            return histogram_sequential(first, last, dest, num_bins, proj);
+        }
+
+        // count the elements of every chunk in its own set of bins
+        histogram_ranges const ranges = {
+            num_bins, (std::min)(num_chunks, num_bins) };
+        std::vector<histogram_chunk> chunks(num_chunks);
+
+        sample_sort_for_each(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t const begin = chunk * count / num_chunks;
+                std::size_t const end = (chunk + 1) * count / num_chunks;
+                histogram_count(first + begin, first + end, num_bins, proj,
+                    chunks[chunk], ranges);
+            });
+
+        // every task adds up the counts of a contiguous range of bins
+        sample_sort_for_each(policy, ranges.num_ranges_,
+            [&](std::size_t r)
+            {
+                histogram_merge(chunks, ranges, r, dest);
+            });
+
+        return std::next(dest, num_bins);
+    }
+
+    template <typename ExPolicy, typename RandomIt, typename FwdIter,
+        typename Proj>
+    hpx::future<FwdIter>
+    histogram_async(ExPolicy && policy, RandomIt first, RandomIt last,
+        FwdIter dest, std::size_t num_bins, Proj && proj)
+    {
+        typedef typename hpx::util::decay<Proj>::type proj_type;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.executor(), policy.parameters());
+        std::size_t const num_chunks = cores > 1 ? 4 * cores : 1;
+
+        proj_type p(std::forward<Proj>(proj));
+        return execution::async_execute(policy.executor(),
+            [=]() -> FwdIter
+            {
+                return histogram_parallel(policy, first, last, dest,
+                    num_bins, p, num_chunks);
+            });
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // aggregate_by_key
+    template <typename Table, typename KeyIter, typename ValueIter,
+        typename Op>
+    void aggregate_chunk(Table& table, KeyIter key_first, KeyIter key_last,
+        ValueIter values_first, Op const& op)
+    {
+        for (/**/; key_first != key_last; (void) ++key_first, ++values_first)
+        {
+            table.combine(*key_first, *values_first, op);
+        }
+    }
+
+    // writes the entries of [first, last) to the output sequences
+    template <typename Entry, typename OutIter1, typename OutIter2>
+    std::pair<OutIter1, OutIter2> aggregate_write(Entry* first, Entry* last,
+        OutIter1 keys_output, OutIter2 values_output)
+    {
+        for (/**/; first != last; ++first)
+        {
+            *keys_output = std::move(first->first);
+            *values_output = std::move(first->second);
+            ++keys_output;
+            ++values_output;
+        }
+        return std::make_pair(keys_output, values_output);
+    }
+
+    template <typename Key, typename Value, typename KeyIter,
+        typename ValueIter, typename OutIter1, typename OutIter2,
+        typename Op, typename Hash, typename KeyEqual>
+    std::pair<OutIter1, OutIter2> aggregate_by_key_sequential(
+        KeyIter key_first, KeyIter key_last, ValueIter values_first,
+        OutIter1 keys_output, OutIter2 values_output, Op const& op,
+        Hash const& hash, KeyEqual const& eq)
+    {
+        typedef privatized_table<Key, Value, Hash, KeyEqual> table_type;
+        typedef typename table_type::entry_type entry_type;
+
+        table_type table(hash, eq);
+        aggregate_chunk(table, key_first, key_last, values_first, op);
+
+        std::vector<entry_type> entries;
+        std::vector<std::size_t> offsets;
+        table.extract(entries, offsets, 1);
+
+        return aggregate_write(entries.data(),
+            entries.data() + entries.size(), keys_output, values_output);
+    }
+
+    template <typename Key, typename Value, typename ExPolicy,
+        typename KeyIter, typename ValueIter, typename OutIter1,
+        typename OutIter2, typename Op, typename Hash, typename KeyEqual>
+    std::pair<OutIter1, OutIter2> aggregate_by_key_parallel(
+        ExPolicy const& policy, KeyIter key_first, KeyIter key_last,
+        ValueIter values_first, OutIter1 keys_output, OutIter2 values_output,
+        Op const& op, Hash const& hash, KeyEqual const& eq,
+        std::size_t num_chunks)
+    {
+        typedef privatized_table<Key, Value, Hash, KeyEqual> table_type;
+        typedef typename table_type::entry_type entry_type;
+
+        std::size_t const count = std::size_t(key_last - key_first);
+        if (count < histogram_limit || num_chunks < 2)
+        {
+            return aggregate_by_key_sequential<Key, Value>(key_first,
+                key_last, values_first, keys_output, values_output, op,
+                hash, eq);
+        }
+
+        // aggregate every chunk in its own table, the resulting entries are
+        // grouped by shard
+        std::size_t const num_shards = num_chunks;
+        std::vector<std::vector<entry_type> > entries(num_chunks);
+        std::vector<std::vector<std::size_t> > offsets(num_chunks);
+
+        sample_sort_for_each(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t const begin = chunk * count / num_chunks;
+                std::size_t const end = (chunk + 1) * count / num_chunks;
+
+                table_type table(hash, eq);
+                aggregate_chunk(table, key_first + begin, key_first + end,
+                    values_first + begin, op);
+                table.extract(entries[chunk], offsets[chunk], num_shards);
+            });
+
+        // equal keys belong to the same shard in all chunks, every shard is
+        // merged by a single task
+        std::vector<std::vector<entry_type> > shards(num_shards);
+
+        sample_sort_for_each(policy, num_shards,
+            [&](std::size_t shard)
+            {
+                std::size_t size = 0;
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    size += offsets[chunk][shard + 1] - offsets[chunk][shard];
+                }
+
+                table_type table(hash, eq, 2 * size);
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    entry_type* p = entries[chunk].data();
+                    for (std::size_t i = offsets[chunk][shard];
+                         i != offsets[chunk][shard + 1]; ++i)
+                    {
+                        table.combine(std::move(p[i].first),
+                            std::move(p[i].second), op);
+                    }
+                }
+
+                std::vector<std::size_t> ignored;
+                table.extract(shards[shard], ignored, 1);
+            });
+
+        entries.clear();
+        offsets.clear();
+
+        // the shards are written to consecutive parts of the output
+        std::vector<std::size_t> shard_offsets(num_shards + 1, 0);
+        for (std::size_t s = 0; s != num_shards; ++s)
+            shard_offsets[s + 1] = shard_offsets[s] + shards[s].size();
+
+        sample_sort_for_each(policy, num_shards,
+            [&](std::size_t shard)
+            {
+                std::vector<entry_type>& s = shards[shard];
+                aggregate_write(s.data(), s.data() + s.size(),
+                    std::next(keys_output, shard_offsets[shard]),
+                    std::next(values_output, shard_offsets[shard]));
+            });
+
+        std::size_t const size = shard_offsets[num_shards];
+        return std::make_pair(std::next(keys_output, size),
+            std::next(values_output, size));
+    }
+
+    template <typename Key, typename Value, typename ExPolicy,
+        typename KeyIter, typename ValueIter, typename OutIter1,
+        typename OutIter2, typename Op, typename Hash, typename KeyEqual>
+    hpx::future<std::pair<OutIter1, OutIter2> >
+    aggregate_by_key_async(ExPolicy && policy, KeyIter key_first,
+        KeyIter key_last, ValueIter values_first, OutIter1 keys_output,
+        OutIter2 values_output, Op && op, Hash && hash, KeyEqual && eq)
+    {
+        typedef typename hpx::util::decay<Op>::type op_type;
+        typedef typename hpx::util::decay<Hash>::type hash_type;
+        typedef typename hpx::util::decay<KeyEqual>::type key_equal_type;
+        typedef std::pair<OutIter1, OutIter2> result_type;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.executor(), policy.parameters());
+        std::size_t const num_chunks = cores > 1 ? 4 * cores : 1;
+
+        op_type o(std::forward<Op>(op));
+        hash_type h(std::forward<Hash>(hash));
+        key_equal_type e(std::forward<KeyEqual>(eq));
+        return execution::async_execute(policy.executor(),
+            [=]() -> result_type
+            {
+                return aggregate_by_key_parallel<Key, Value>(policy,
+                    key_first, key_last, values_first, keys_output,
+                    values_output, o, h, e, num_chunks);
+            });
+    }
+
+    /// \endcond
+}}}}
+
+#endif
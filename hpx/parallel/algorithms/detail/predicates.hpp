@@ -9,7 +9,9 @@
 #include <hpx/config.hpp>
 #include <hpx/traits/is_iterator.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/invoke.hpp>
+#include <hpx/util/tuple.hpp>
 
 #include <hpx/parallel/algorithms/detail/is_negative.hpp>
 
@@ -310,6 +312,30 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail
         Value value_;
     };
 
+    // the same as compare_to, except that the element is the left operand
+    template <typename Value>
+    struct compare_with
+    {
+        HPX_HOST_DEVICE HPX_FORCEINLINE
+        compare_with(Value && val)
+          : value_(std::move(val))
+        {}
+        HPX_HOST_DEVICE HPX_FORCEINLINE
+        compare_with(Value const& val)
+          : value_(val)
+        {}
+
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE
+        auto operator()(T const& t) const
+        ->  decltype(t == std::declval<Value>())
+        {
+            return t == value_;
+        }
+
+        Value value_;
+    };
+
     ///////////////////////////////////////////////////////////////////////////
     struct less
     {
@@ -381,6 +407,66 @@ namespace hpx { namespace parallel { inline namespace v1 { namespace detail
             return t1 / t2;
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The predicate adaptors below are invoked with the value referred to by
+    // an iterator or, for vectorizing execution policies, with a vector pack.
+    // In the latter case the negation is applied to all elements of the
+    // returned mask.
+    template <typename F>
+    struct not_pred
+    {
+        typedef typename hpx::util::decay<F>::type pred_type;
+
+        pred_type& f_;
+
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE
+        auto operator()(T && t) const
+        ->  decltype(!hpx::util::invoke(
+                std::declval<pred_type&>(), std::forward<T>(t)))
+        {
+            return !hpx::util::invoke(f_, std::forward<T>(t));
+        }
+    };
+
+    // invokes a binary predicate with the elements of the pair of values
+    // referred to by a zip_iterator
+    template <typename F>
+    struct zip_pred
+    {
+        typedef typename hpx::util::decay<F>::type pred_type;
+
+        pred_type& f_;
+
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE
+        auto operator()(T && t) const
+        ->  decltype(hpx::util::invoke(std::declval<pred_type&>(),
+                hpx::util::get<0>(t), hpx::util::get<1>(t)))
+        {
+            return hpx::util::invoke(f_,
+                hpx::util::get<0>(t), hpx::util::get<1>(t));
+        }
+    };
+
+    template <typename F>
+    struct not_zip_pred
+    {
+        typedef typename hpx::util::decay<F>::type pred_type;
+
+        pred_type& f_;
+
+        template <typename T>
+        HPX_HOST_DEVICE HPX_FORCEINLINE
+        auto operator()(T && t) const
+        ->  decltype(!hpx::util::invoke(std::declval<pred_type&>(),
+                hpx::util::get<0>(t), hpx::util::get<1>(t)))
+        {
+            return !hpx::util::invoke(f_,
+                hpx::util::get<0>(t), hpx::util::get<1>(t));
+        }
+    };
 }}}}
 
 #endif
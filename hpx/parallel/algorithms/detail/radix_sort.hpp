@@ -0,0 +1,540 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_RADIX_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // the minimal number of elements distributed in parallel
+    static const std::size_t radix_sort_limit = 1ul << 16;
+
+    // ranges smaller than this are sorted using comparisons
+    static const std::size_t radix_sort_comparison_limit = 128;
+
+    // every pass distributes the elements by one byte of the keys
+    static const std::size_t radix_sort_digit_bits = 8;
+    static const std::size_t radix_sort_buckets =
+        std::size_t(1) << radix_sort_digit_bits;
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Maps arithmetic keys to unsigned integers such that the unsigned
+    // integers are ordered in the same way as the keys are by operator<.
+    template <typename T, typename Enable = void>
+    struct radix_sort_key
+      : std::false_type
+    {};
+
+    // the sign bit of signed integers is flipped
+    template <typename T>
+    struct radix_sort_key<T,
+            typename std::enable_if<
+                std::is_integral<T>::value && !std::is_same<T, bool>::value
+            >::type>
+      : std::true_type
+    {
+        typedef typename std::make_unsigned<T>::type type;
+
+        static type map(T key)
+        {
+            type const sign_bit = std::is_signed<T>::value ?
+                static_cast<type>(type(1) << (sizeof(T) * CHAR_BIT - 1)) :
+                type(0);
+            return static_cast<type>(static_cast<type>(key) ^ sign_bit);
+        }
+    };
+
+    template <>
+    struct radix_sort_key<bool>
+      : std::true_type
+    {
+        typedef unsigned char type;
+
+        static type map(bool key)
+        {
+            return key ? 1 : 0;
+        }
+    };
+
+    // positive IEEE 754 values are ordered like their bit patterns, the
+    // bits of negative values have to be inverted
+    template <typename T, typename Bits>
+    struct radix_sort_floating_point_key
+      : std::integral_constant<bool,
+            std::numeric_limits<T>::is_iec559 && sizeof(T) == sizeof(Bits)>
+    {
+        typedef Bits type;
+
+        static type map(T key)
+        {
+            type bits;
+            std::memcpy(&bits, &key, sizeof(type));
+
+            type const sign_bit = type(1) << (sizeof(type) * CHAR_BIT - 1);
+            return (bits & sign_bit) ? type(~bits) : type(bits | sign_bit);
+        }
+    };
+
+    template <>
+    struct radix_sort_key<float>
+      : radix_sort_floating_point_key<float, std::uint32_t>
+    {};
+
+    template <>
+    struct radix_sort_key<double>
+      : radix_sort_floating_point_key<double, std::uint64_t>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // the comparison has to be operator< on the projected keys
+    template <typename Compare, typename Key>
+    struct is_radix_sort_less
+      : std::false_type
+    {};
+
+    template <typename Key>
+    struct is_radix_sort_less<detail::less, Key>
+      : std::true_type
+    {};
+
+    template <typename Key>
+    struct is_radix_sort_less<std::less<Key>, Key>
+      : std::true_type
+    {};
+
+    // Sorting with the given comparison and projection can be performed by
+    // a radix sort.
+    template <typename RandomIt, typename Compare, typename Proj>
+    struct use_radix_sort
+    {
+        typedef typename hpx::util::decay<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type key_type;
+
+        static const bool value = radix_sort_key<key_type>::value &&
+            is_radix_sort_less<
+                typename hpx::util::decay<Compare>::type, key_type
+            >::value;
+
+        typedef std::integral_constant<bool, value> type;
+    };
+
+    // The parallel radix sort moves the elements through a temporary
+    // buffer, see supports_sort_buffer.
+    template <typename RandomIt, typename Compare, typename Proj>
+    struct use_parallel_radix_sort
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+
+        static const bool value =
+            use_radix_sort<RandomIt, Compare, Proj>::value &&
+            supports_sort_buffer<value_type>::value;
+
+        typedef std::integral_constant<bool, value> type;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Key, typename Proj>
+    struct radix_sort_digit
+    {
+        typedef typename radix_sort_key<Key>::type key_type;
+
+        template <typename T>
+        key_type key(T && t) const
+        {
+            return radix_sort_key<Key>::map(
+                hpx::util::invoke(proj_, std::forward<T>(t)));
+        }
+
+        template <typename T>
+        std::size_t operator()(T && t, std::size_t shift) const
+        {
+            return std::size_t(key(std::forward<T>(t)) >> shift) &
+                (radix_sort_buckets - 1);
+        }
+
+        Proj const& proj_;
+    };
+
+    // compares the elements by their mapped keys, this yields the same
+    // order as the radix sort
+    template <typename Digit>
+    struct radix_sort_less
+    {
+        template <typename T1, typename T2>
+        bool operator()(T1 && t1, T2 && t2) const
+        {
+            return digit_.key(std::forward<T1>(t1)) <
+                digit_.key(std::forward<T2>(t2));
+        }
+
+        Digit const& digit_;
+    };
+
+    // the position of the lowest bit of the most significant digit in which
+    // the keys differ
+    template <typename KeyType>
+    std::size_t radix_sort_first_shift(KeyType differing_bits)
+    {
+        std::size_t shift = 0;
+        while (shift + radix_sort_digit_bits < sizeof(KeyType) * CHAR_BIT &&
+            (differing_bits >> (shift + radix_sort_digit_bits)) != 0)
+        {
+            shift += radix_sort_digit_bits;
+        }
+        return shift;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // In-place most significant digit radix sort (American flag sort):
+    // the elements are counted per bucket and permuted into their buckets
+    // by following the cycles of the permutation. Each bucket is sorted by
+    // the next digit, small buckets are sorted using comparisons.
+    template <typename RandomIt, typename Digit>
+    void radix_sort_sequential(RandomIt first, RandomIt last,
+        Digit const& digit, std::size_t shift)
+    {
+        std::size_t const count = std::size_t(last - first);
+        if (count < radix_sort_comparison_limit)
+        {
+            radix_sort_less<Digit> const comp = { digit };
+            std::sort(first, last, comp);
+            return;
+        }
+
+        std::size_t counts[radix_sort_buckets] = { 0 };
+        for (RandomIt it = first; it != last; ++it)
+            ++counts[digit(*it, shift)];
+
+        std::size_t next[radix_sort_buckets];
+        std::size_t ends[radix_sort_buckets];
+
+        std::size_t position = 0;
+        for (std::size_t bucket = 0; bucket != radix_sort_buckets; ++bucket)
+        {
+            // all elements share this digit, there is nothing to permute
+            if (counts[bucket] == count)
+            {
+                if (shift != 0)
+                {
+                    radix_sort_sequential(first, last, digit,
+                        shift - radix_sort_digit_bits);
+                }
+                return;
+            }
+
+            next[bucket] = position;
+            position += counts[bucket];
+            ends[bucket] = position;
+        }
+
+        for (std::size_t bucket = 0; bucket != radix_sort_buckets; ++bucket)
+        {
+            while (next[bucket] != ends[bucket])
+            {
+                std::size_t const d = digit(first[next[bucket]], shift);
+                if (d == bucket)
+                    ++next[bucket];
+                else
+                    std::iter_swap(first + next[bucket], first + next[d]++);
+            }
+        }
+
+        if (shift == 0)
+            return;
+
+        std::size_t begin = 0;
+        for (std::size_t bucket = 0; bucket != radix_sort_buckets; ++bucket)
+        {
+            if (ends[bucket] - begin > 1)
+            {
+                radix_sort_sequential(first + begin, first + ends[bucket],
+                    digit, shift - radix_sort_digit_bits);
+            }
+            begin = ends[bucket];
+        }
+    }
+
+    // sort the elements by the keys INVOKE(proj, *it) using a single thread
+    template <typename RandomIt, typename Proj>
+    RandomIt radix_sort_sequential(RandomIt first, RandomIt last,
+        Proj const& proj)
+    {
+        typedef typename hpx::util::decay<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type key_type;
+        typedef radix_sort_digit<key_type, Proj> digit_type;
+        typedef typename digit_type::key_type mapped_key_type;
+
+        // skip the leading digits all keys have in common
+        digit_type const digit = { proj };
+        if (std::size_t(last - first) < radix_sort_comparison_limit)
+        {
+            radix_sort_less<digit_type> const comp = { digit };
+            std::sort(first, last, comp);
+            return last;
+        }
+
+        mapped_key_type const first_key = digit.key(*first);
+        mapped_key_type differing_bits = 0;
+        for (RandomIt it = first + 1; it != last; ++it)
+            differing_bits |= digit.key(*it) ^ first_key;
+
+        if (differing_bits != 0)
+        {
+            radix_sort_sequential(first, last, digit,
+                radix_sort_first_shift(differing_bits));
+        }
+        return last;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Parallel most significant digit radix sort: the range is split into
+    // chunks which are processed in parallel. In a first pass every chunk
+    // determines the bits in which its keys differ and whether it is sorted
+    // already. The second pass counts the elements of every chunk per
+    // bucket of the most significant differing digit, which gives the
+    // position of each chunk's part of every bucket. The elements are
+    // moved to their bucket in a temporary buffer and back in parallel.
+    // Afterwards, all buckets are sorted independently by the remaining
+    // digits, large buckets are distributed in parallel again.
+    template <typename ExPolicy, typename RandomIt, typename Digit>
+    void radix_sort_parallel(ExPolicy const& policy, RandomIt first,
+        RandomIt last, Digit const& digit, std::size_t num_chunks,
+        std::size_t shift)
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+
+        std::size_t const count = std::size_t(last - first);
+        if (count < radix_sort_limit || num_chunks < 2)
+        {
+            radix_sort_sequential(first, last, digit, shift);
+            return;
+        }
+
+        auto chunk_begin =
+            [count, num_chunks](std::size_t chunk) -> std::size_t
+            {
+                return chunk * count / num_chunks;
+            };
+
+        // count the elements of every chunk per bucket, counts[chunk][bucket]
+        std::vector<std::size_t> counts(num_chunks * radix_sort_buckets, 0);
+        sample_sort_for_each(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t* chunk_counts = &counts[chunk * radix_sort_buckets];
+                for (std::size_t i = chunk_begin(chunk);
+                     i != chunk_begin(chunk + 1); ++i)
+                {
+                    ++chunk_counts[digit(first[i], shift)];
+                }
+            });
+
+        // the position of each chunk's part of every bucket, offsets[bucket]
+        // is the start of the bucket
+        std::vector<std::size_t> offsets(radix_sort_buckets + 1, 0);
+        std::vector<std::size_t> positions(num_chunks * radix_sort_buckets);
+
+        std::size_t position = 0;
+        for (std::size_t bucket = 0; bucket != radix_sort_buckets; ++bucket)
+        {
+            offsets[bucket] = position;
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                positions[chunk * radix_sort_buckets + bucket] = position;
+                position += counts[chunk * radix_sort_buckets + bucket];
+            }
+
+            // all elements share this digit, there is nothing to move
+            if (position - offsets[bucket] == count)
+            {
+                if (shift != 0)
+                {
+                    radix_sort_parallel(policy, first, last, digit,
+                        num_chunks, shift - radix_sort_digit_bits);
+                }
+                return;
+            }
+        }
+        offsets[radix_sort_buckets] = position;
+        HPX_ASSERT(position == count);
+
+        // move the elements to their buckets in parallel
+        {
+            sample_sort_buffer<value_type> buffer(count);
+            value_type* data = buffer.data_;
+
+            sample_sort_for_each(policy, num_chunks,
+                [&](std::size_t chunk)
+                {
+                    std::size_t* pos = &positions[chunk * radix_sort_buckets];
+                    for (std::size_t i = chunk_begin(chunk);
+                         i != chunk_begin(chunk + 1); ++i)
+                    {
+                        ::new (data + pos[digit(first[i], shift)]++)
+                            value_type(std::move(first[i]));
+                    }
+                });
+
+            // move them back in parallel
+            sample_sort_for_each(policy, num_chunks,
+                [&](std::size_t chunk)
+                {
+                    value_type* const begin = data + chunk_begin(chunk);
+                    value_type* const end = data + chunk_begin(chunk + 1);
+                    sample_sort_bucket_guard<value_type> guard = {
+                        begin, end };
+
+                    std::move(begin, end, first + chunk_begin(chunk));
+                });
+        }
+
+        if (shift == 0)
+            return;
+
+        // sort the buckets by the remaining digits in parallel
+        sample_sort_for_each(policy, radix_sort_buckets,
+            [&](std::size_t bucket)
+            {
+                RandomIt const begin = first + offsets[bucket];
+                RandomIt const end = first + offsets[bucket + 1];
+
+                if (end - begin > 1)
+                {
+                    radix_sort_parallel(policy, begin, end, digit,
+                        num_chunks, shift - radix_sort_digit_bits);
+                }
+            });
+    }
+
+    // sort the elements by the keys INVOKE(proj, *it) in parallel
+    template <typename ExPolicy, typename RandomIt, typename Proj>
+    RandomIt radix_sort_parallel(ExPolicy const& policy, RandomIt first,
+        RandomIt last, Proj const& proj, std::size_t num_chunks)
+    {
+        typedef typename hpx::util::decay<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type key_type;
+        typedef radix_sort_digit<key_type, Proj> digit_type;
+        typedef typename digit_type::key_type mapped_key_type;
+
+        std::size_t const count = std::size_t(last - first);
+        if (count < radix_sort_limit || num_chunks < 2)
+        {
+            return radix_sort_sequential(first, last, proj);
+        }
+
+        // determine the bits in which the keys differ and check for sorted
+        // chunks in parallel
+        digit_type const digit = { proj };
+        mapped_key_type const first_key = digit.key(*first);
+
+        std::vector<mapped_key_type> differing_bits(num_chunks, 0);
+        std::unique_ptr<char[]> chunk_sorted(new char[num_chunks]);
+
+        sample_sort_for_each(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t const begin = chunk * count / num_chunks;
+                std::size_t const end = (chunk + 1) * count / num_chunks;
+
+                // include the last element of the previous chunk
+                mapped_key_type previous =
+                    digit.key(first[begin == 0 ? 0 : begin - 1]);
+
+                mapped_key_type bits = 0;
+                bool sorted = true;
+                for (std::size_t i = begin; i != end; ++i)
+                {
+                    mapped_key_type const key = digit.key(first[i]);
+                    bits |= key ^ first_key;
+                    sorted = sorted && !(key < previous);
+                    previous = key;
+                }
+
+                differing_bits[chunk] = bits;
+                chunk_sorted[chunk] = sorted;
+            });
+
+        mapped_key_type bits = 0;
+        for (mapped_key_type b : differing_bits)
+            bits |= b;
+
+        if (bits == 0 ||
+            std::all_of(chunk_sorted.get(), chunk_sorted.get() + num_chunks,
+                [](char sorted) { return sorted != 0; }))
+        {
+            return last;
+        }
+
+        radix_sort_parallel(policy, first, last, digit, num_chunks,
+            radix_sort_first_shift(bits));
+        return last;
+    }
+
+    //------------------------------------------------------------------------
+    //  function : radix_sort_async
+    //------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt, typename Proj>
+    hpx::future<RandomIt>
+    radix_sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
+        Proj && proj)
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+        typedef typename hpx::util::decay<Proj>::type proj_type;
+
+        std::size_t const cores = execution::processing_units_count(
+            policy.executor(), policy.parameters());
+
+        // without a temporary buffer the elements are distributed by a
+        // single thread
+        std::size_t const num_chunks =
+            (cores > 1 && supports_sort_buffer<value_type>::value) ?
+                4 * cores : 1;
+
+        proj_type p(std::forward<Proj>(proj));
+        return execution::async_execute(policy.executor(),
+            [=]() -> RandomIt
+            {
+                return radix_sort_parallel(policy, first, last, p,
+                    num_chunks);
+            });
+    }
+
+    /// \endcond
+}}}}
+
+#endif
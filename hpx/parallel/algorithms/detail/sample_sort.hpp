@@ -0,0 +1,332 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_DETAIL_SAMPLE_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_DETAIL_SAMPLE_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail
+{
+    /// \cond NOINTERNAL
+
+    // the minimal number of elements sorted using the sample sort
+    static const std::size_t sample_sort_limit = 1ul << 20;
+
+    // the number of samples drawn per bucket
+    static const std::size_t sample_sort_oversampling = 32;
+
+    // the bucket of each element is stored in a single byte
+    static const std::size_t sample_sort_max_buckets = 256;
+
+    // The elements are moved to a temporary buffer which is not initialized
+    // beforehand, this requires move constructors which do not throw.
+    template <typename T>
+    struct supports_sort_buffer
+      : std::integral_constant<bool,
+            std::is_nothrow_move_constructible<T>::value &&
+            std::is_move_assignable<T>::value>
+    {};
+
+    // the splitters are copies of some of the elements
+    template <typename T>
+    struct supports_sample_sort
+      : std::integral_constant<bool,
+            supports_sort_buffer<T>::value &&
+            std::is_copy_constructible<T>::value>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Run f(0) ... f(count - 1) as separate tasks and wait for all of them,
+    // even if some fail.
+    template <typename ExPolicy, typename F>
+    void sample_sort_for_each(ExPolicy const& policy, std::size_t count,
+        F const& f)
+    {
+        std::vector<hpx::future<void> > tasks;
+        tasks.reserve(count);
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            tasks.push_back(
+                execution::async_execute(policy.executor(), f, i));
+        }
+        hpx::wait_all(tasks);
+
+        std::list<std::exception_ptr> errors;
+        util::detail::handle_local_exceptions<ExPolicy>::call(tasks, errors);
+    }
+
+    // uninitialized storage for the elements of all buckets
+    template <typename T>
+    struct sample_sort_buffer
+    {
+        explicit sample_sort_buffer(std::size_t size)
+          : data_(static_cast<T*>(::operator new(size * sizeof(T))))
+        {}
+
+        ~sample_sort_buffer()
+        {
+            ::operator delete(data_);
+        }
+
+        sample_sort_buffer(sample_sort_buffer const&) = delete;
+        sample_sort_buffer& operator=(sample_sort_buffer const&) = delete;
+
+        T* data_;
+    };
+
+    // destroys the elements of a bucket in the temporary buffer, even if
+    // sorting the bucket failed
+    template <typename T>
+    struct sample_sort_bucket_guard
+    {
+        ~sample_sort_bucket_guard()
+        {
+            for (T* it = first_; it != last_; ++it)
+                it->~T();
+        }
+
+        T* first_;
+        T* last_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Sample sort: the range is split into one chunk per bucket. In
+    // parallel, every chunk is checked for being sorted already and a
+    // number of samples is drawn from it. The sorted samples determine the
+    // splitters separating the buckets. Afterwards, every chunk classifies
+    // its elements in parallel and counts the elements per bucket, which
+    // gives the position of each chunk's part of every bucket. The elements
+    // are moved to their bucket in a temporary buffer, all buckets are
+    // sorted independently, and moved back.
+    //
+    // Every element is compared O(log(buckets)) times for the
+    // classification and moved twice, no pass over the whole range is
+    // performed by a single thread. A key drawn as more than one splitter
+    // gets a bucket of its own, which is sorted already. Other buckets which
+    // are much larger than expected are sample sorted again.
+    template <typename ExPolicy, typename RandomIt, typename Compare>
+    RandomIt sample_sort(ExPolicy const& policy, RandomIt first,
+        RandomIt last, Compare const& comp, std::size_t num_buckets)
+    {
+        typedef typename std::iterator_traits<RandomIt>::value_type
+            value_type;
+
+        std::size_t const count = std::size_t(last - first);
+        if (count < sample_sort_limit || num_buckets < 2)
+        {
+            std::sort(first, last, comp);
+            return last;
+        }
+
+        HPX_ASSERT(num_buckets <= sample_sort_max_buckets);
+        std::size_t const num_chunks = num_buckets;
+
+        auto chunk_begin =
+            [count, num_chunks](std::size_t chunk) -> std::size_t
+            {
+                return chunk * count / num_chunks;
+            };
+
+        // check for sorted chunks and draw samples in parallel
+        std::vector<std::vector<value_type> > chunk_samples(num_chunks);
+        std::unique_ptr<char[]> chunk_sorted(new char[num_chunks]);
+
+        sample_sort_for_each(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t const begin = chunk_begin(chunk);
+                std::size_t const size = chunk_begin(chunk + 1) - begin;
+
+                // include the last element of the previous chunk
+                chunk_sorted[chunk] = std::is_sorted(
+                    first + (begin == 0 ? 0 : begin - 1), first + begin + size,
+                    comp);
+
+                std::minstd_rand gen(static_cast<unsigned>(chunk + 1));
+                std::size_t const stride = size / sample_sort_oversampling;
+
+                std::vector<value_type>& samples = chunk_samples[chunk];
+                samples.reserve(sample_sort_oversampling);
+                for (std::size_t i = 0; i != sample_sort_oversampling; ++i)
+                {
+                    samples.push_back(
+                        first[begin + i * stride + gen() % stride]);
+                }
+            });
+
+        if (std::all_of(chunk_sorted.get(), chunk_sorted.get() + num_chunks,
+                [](char sorted) { return sorted != 0; }))
+        {
+            return last;
+        }
+
+        // select the splitters from the sorted samples
+        std::vector<value_type> samples;
+        samples.reserve(num_chunks * sample_sort_oversampling);
+        for (std::vector<value_type>& s : chunk_samples)
+        {
+            samples.insert(samples.end(), std::make_move_iterator(s.begin()),
+                std::make_move_iterator(s.end()));
+        }
+        chunk_samples.clear();
+
+        std::sort(samples.begin(), samples.end(), comp);
+
+        std::vector<value_type> splitters;
+        splitters.reserve(num_buckets - 1);
+        for (std::size_t i = 1; i != num_buckets; ++i)
+        {
+            splitters.push_back(
+                std::move(samples[i * samples.size() / num_buckets]));
+        }
+        samples.clear();
+
+        // keep at most two copies of equal splitters, the otherwise empty
+        // bucket between them receives all elements equal to the key
+        std::size_t num_splitters = 0;
+        for (std::size_t i = 0; i != splitters.size(); /**/)
+        {
+            std::size_t j = i + 1;
+            while (j != splitters.size() && !comp(splitters[i], splitters[j]))
+                ++j;
+
+            if (num_splitters != i)
+                splitters[num_splitters] = std::move(splitters[i]);
+            ++num_splitters;
+
+            if (j - i > 1)
+            {
+                if (num_splitters != j - 1)
+                    splitters[num_splitters] = std::move(splitters[j - 1]);
+                ++num_splitters;
+            }
+            i = j;
+        }
+        splitters.erase(splitters.begin() + num_splitters, splitters.end());
+
+        std::size_t const buckets = num_splitters + 1;
+        std::unique_ptr<char[]> equal_keys(new char[buckets]);
+        for (std::size_t bucket = 0; bucket != buckets; ++bucket)
+        {
+            equal_keys[bucket] = bucket != 0 && bucket != num_splitters &&
+                !comp(splitters[bucket - 1], splitters[bucket]);
+        }
+
+        // classify the elements in parallel, count[chunk][bucket]
+        std::unique_ptr<std::uint8_t[]> bucket_of(new std::uint8_t[count]);
+        std::vector<std::size_t> counts(num_chunks * buckets, 0);
+
+        sample_sort_for_each(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t* chunk_counts = &counts[chunk * buckets];
+                for (std::size_t i = chunk_begin(chunk);
+                     i != chunk_begin(chunk + 1); ++i)
+                {
+                    std::size_t bucket = std::upper_bound(
+                        splitters.begin(), splitters.end(), first[i], comp) -
+                        splitters.begin();
+
+                    // the element is not less than splitters[bucket - 1]
+                    if (bucket != 0 && equal_keys[bucket - 1] &&
+                        !comp(splitters[bucket - 1], first[i]))
+                    {
+                        --bucket;
+                    }
+
+                    bucket_of[i] = static_cast<std::uint8_t>(bucket);
+                    ++chunk_counts[bucket];
+                }
+            });
+
+        // the position of each chunk's part of every bucket, offsets[bucket]
+        // is the start of the bucket
+        std::vector<std::size_t> offsets(buckets + 1, 0);
+        std::vector<std::size_t> positions(num_chunks * buckets);
+
+        std::size_t position = 0;
+        for (std::size_t bucket = 0; bucket != buckets; ++bucket)
+        {
+            offsets[bucket] = position;
+            for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+            {
+                positions[chunk * buckets + bucket] = position;
+                position += counts[chunk * buckets + bucket];
+            }
+        }
+        offsets[buckets] = position;
+        HPX_ASSERT(position == count);
+
+        // move the elements to their buckets in parallel
+        sample_sort_buffer<value_type> buffer(count);
+        value_type* data = buffer.data_;
+
+        sample_sort_for_each(policy, num_chunks,
+            [&](std::size_t chunk)
+            {
+                std::size_t* pos = &positions[chunk * buckets];
+                for (std::size_t i = chunk_begin(chunk);
+                     i != chunk_begin(chunk + 1); ++i)
+                {
+                    ::new (data + pos[bucket_of[i]]++)
+                        value_type(std::move(first[i]));
+                }
+            });
+
+        bucket_of.reset();
+
+        // sort the buckets in parallel and move them back
+        std::size_t const expected_size = count / num_buckets;
+
+        sample_sort_for_each(policy, buckets,
+            [&](std::size_t bucket)
+            {
+                value_type* const begin = data + offsets[bucket];
+                value_type* const end = data + offsets[bucket + 1];
+                sample_sort_bucket_guard<value_type> guard = { begin, end };
+
+                // the elements of a bucket of equal keys are sorted already,
+                // a bucket holding all elements would be split the same way
+                // again
+                std::size_t const size = std::size_t(end - begin);
+                if (!equal_keys[bucket])
+                {
+                    if (size > 4 * expected_size && size != count)
+                        sample_sort(policy, begin, end, comp, num_buckets);
+                    else
+                        std::sort(begin, end, comp);
+                }
+
+                std::move(begin, end, first + offsets[bucket]);
+            });
+
+        return last;
+    }
+
+    /// \endcond
+}}}}
+
+#endif
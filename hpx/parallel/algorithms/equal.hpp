@@ -10,7 +10,6 @@
 
 #include <hpx/config.hpp>
 #include <hpx/traits/is_iterator.hpp>
-#include <hpx/util/range.hpp>
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
@@ -107,40 +106,30 @@ namespace hpx { namespace parallel { inline namespace v1
                 }
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
-                util::cancellation_token<> tok;
+                // the token records the position of the first mismatch, this
+                // allows to search each partition with the (possibly
+                // vectorized) early exit loop
+                std::size_t const size = static_cast<std::size_t>(count1);
+                util::cancellation_token<std::size_t> tok(size);
+
                 auto f1 =
                     [f, tok](
-                        zip_iterator it, std::size_t part_count
-                    ) mutable -> bool
+                        zip_iterator it, std::size_t part_count,
+                        std::size_t base_idx
+                    ) mutable -> void
                     {
-                        util::loop_n<ExPolicy>(
-                            it, part_count, tok,
-                            [&f, &tok](zip_iterator const& curr)
-                            {
-                                reference t = *curr;
-                                if (!hpx::util::invoke(f, hpx::util::get<0>(t),
-                                        hpx::util::get<1>(t)))
-                                {
-                                    tok.cancel();
-                                }
-                            });
-                        return !tok.was_cancelled();
+                        util::find_first_n<ExPolicy>(base_idx, it, part_count,
+                            tok, detail::not_zip_pred<F>{f});
                     };
 
-                return util::partitioner<ExPolicy, bool>::call(
+                return util::partitioner<ExPolicy, bool, void>::call_with_index(
                     std::forward<ExPolicy>(policy),
-                    hpx::util::make_zip_iterator(first1, first2), count1,
+                    hpx::util::make_zip_iterator(first1, first2), count1, 1,
                     std::move(f1),
-                    [](std::vector<hpx::future<bool> > && results)
+                    [tok, size](std::vector<hpx::future<void> > &&) -> bool
                     {
-                        return std::all_of(
-                            hpx::util::begin(results), hpx::util::end(results),
-                            [](hpx::future<bool>& val)
-                            {
-                                return val.get();
-                            });
+                        return tok.get_data() == size;
                     });
             }
         };
@@ -280,40 +269,30 @@ namespace hpx { namespace parallel { inline namespace v1
                 difference_type count = std::distance(first1, last1);
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
-                util::cancellation_token<> tok;
+                // the token records the position of the first mismatch, this
+                // allows to search each partition with the (possibly
+                // vectorized) early exit loop
+                std::size_t const size = static_cast<std::size_t>(count);
+                util::cancellation_token<std::size_t> tok(size);
+
                 auto f1 =
                     [f, tok](
-                        zip_iterator it, std::size_t part_count
-                    ) mutable -> bool
+                        zip_iterator it, std::size_t part_count,
+                        std::size_t base_idx
+                    ) mutable -> void
                     {
-                        util::loop_n<ExPolicy>(
-                            it, part_count, tok,
-                            [&f, &tok](zip_iterator const& curr)
-                            {
-                                reference t = *curr;
-                                if (!hpx::util::invoke(f, hpx::util::get<0>(t),
-                                        hpx::util::get<1>(t)))
-                                {
-                                    tok.cancel();
-                                }
-                            });
-                        return !tok.was_cancelled();
+                        util::find_first_n<ExPolicy>(base_idx, it, part_count,
+                            tok, detail::not_zip_pred<F>{f});
                     };
 
-                return util::partitioner<ExPolicy, bool>::call(
+                return util::partitioner<ExPolicy, bool, void>::call_with_index(
                     std::forward<ExPolicy>(policy),
-                    hpx::util::make_zip_iterator(first1, first2), count,
+                    hpx::util::make_zip_iterator(first1, first2), count, 1,
                     std::move(f1),
-                    [](std::vector<hpx::future<bool> > && results)
+                    [tok, size](std::vector<hpx::future<void> > &&) -> bool
                     {
-                        return std::all_of(
-                            hpx::util::begin(results), hpx::util::end(results),
-                            [](hpx::future<bool>& val)
-                            {
-                                return val.get();
-                            });
+                        return tok.get_data() == size;
                     });
             }
         };
@@ -59,7 +59,6 @@ namespace hpx { namespace parallel { inline namespace v1
                 T const& val)
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter> result;
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
                 typedef typename std::iterator_traits<FwdIter>::difference_type
                     difference_type;
 
@@ -71,11 +70,8 @@ namespace hpx { namespace parallel { inline namespace v1
 
                 auto f1 = [val, tok](FwdIter it, std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&val, &tok](type& v, std::size_t i) -> void {
-                            if (v == val)
-                                tok.cancel(i);
-                        });
+                    util::find_first_n<ExPolicy>(base_idx, it, part_size, tok,
+                        detail::compare_with<T>(val));
                 };
 
                 auto f2 =
@@ -205,7 +201,6 @@ namespace hpx { namespace parallel { inline namespace v1
             parallel(ExPolicy && policy, FwdIter first, FwdIter last, F && f)
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -218,11 +213,8 @@ namespace hpx { namespace parallel { inline namespace v1
                 auto f1 = [HPX_CAPTURE_FORWARD(f), tok](FwdIter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &tok](type& v, std::size_t i) -> void {
-                            if (hpx::util::invoke(f, v))
-                                tok.cancel(i);
-                        });
+                    util::find_first_n<ExPolicy>(base_idx, it, part_size, tok,
+                        f);
                 };
 
                 auto f2 =
@@ -371,7 +363,6 @@ namespace hpx { namespace parallel { inline namespace v1
             parallel(ExPolicy && policy, FwdIter first, FwdIter last, F && f)
             {
                 typedef util::detail::algorithm_result<ExPolicy, FwdIter> result;
-                typedef typename std::iterator_traits<Iter>::value_type type;
                 typedef typename std::iterator_traits<Iter>::difference_type
                     difference_type;
 
@@ -384,11 +375,8 @@ namespace hpx { namespace parallel { inline namespace v1
                 auto f1 = [HPX_CAPTURE_FORWARD(f), tok](FwdIter it,
                               std::size_t part_size,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_size, tok,
-                        [&f, &tok](type& v, std::size_t i) -> void {
-                            if (!hpx::util::invoke(f, v))
-                                tok.cancel(i);
-                        });
+                    util::find_first_n<ExPolicy>(base_idx, it, part_size, tok,
+                        detail::not_pred<F>{f});
                 };
 
                 auto f2 =
@@ -0,0 +1,803 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/for_loop_tiled.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_FOR_LOOP_TILED_HPP)
+#define HPX_PARALLEL_ALGORITHMS_FOR_LOOP_TILED_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/wait_all.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/threads/executors/default_executor.hpp>
+#include <hpx/runtime/threads/thread_enums.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/detail/pack.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/tuple.hpp>
+#include <hpx/util/unused.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/executors/parallel_executor.hpp>
+#include <hpx/parallel/executors/thread_execution.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_local_exceptions.hpp>
+#include <hpx/parallel/util/partitioner.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <list>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v2
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// An N-dimensional box of integral indices, the index i is part of the
+    /// box if lower()[d] <= i[d] < upper()[d] for all dimensions d.
+    template <std::size_t N>
+    class index_box
+    {
+        static_assert(N != 0, "index_box requires at least one dimension");
+
+    public:
+        typedef std::array<std::ptrdiff_t, N> index_type;
+
+        /// Creates an empty box.
+        index_box()
+        {
+            lower_.fill(0);
+            upper_.fill(0);
+        }
+
+        // The constructors taking an index_type are templates, which keeps
+        // them from being considered for braced lists (an std::array
+        // initialized from {n, m} triggers -Wmissing-braces).
+
+        /// Creates the box [0, upper).
+        template <typename Index, HPX_CONCEPT_REQUIRES_(
+            std::is_same<Index, index_type>::value)>
+        explicit index_box(Index const& upper)
+          : upper_(upper)
+        {
+            lower_.fill(0);
+        }
+
+        /// Creates the box [lower, upper).
+        template <typename Index, HPX_CONCEPT_REQUIRES_(
+            std::is_same<Index, index_type>::value)>
+        index_box(Index const& lower, Index const& upper)
+          : lower_(lower), upper_(upper)
+        {}
+
+        /// Creates the box [0, upper), for instance index_box<2>({n, m}).
+        explicit index_box(std::initializer_list<std::ptrdiff_t> upper)
+        {
+            lower_.fill(0);
+            assign(upper_, upper);
+        }
+
+        /// Creates the box [lower, upper), for instance
+        /// index_box<2>({0, 1}, {n, m}).
+        index_box(std::initializer_list<std::ptrdiff_t> lower,
+            std::initializer_list<std::ptrdiff_t> upper)
+        {
+            assign(lower_, lower);
+            assign(upper_, upper);
+        }
+
+        index_type const& lower() const
+        {
+            return lower_;
+        }
+
+        index_type const& upper() const
+        {
+            return upper_;
+        }
+
+        /// Returns the number of indices of the box in dimension d.
+        std::size_t extent(std::size_t d) const
+        {
+            return upper_[d] > lower_[d] ?
+                std::size_t(upper_[d] - lower_[d]) : 0;
+        }
+
+        /// Returns the number of indices of the box.
+        std::size_t size() const
+        {
+            std::size_t size = 1;
+            for (std::size_t d = 0; d != N; ++d)
+                size *= extent(d);
+            return size;
+        }
+
+    private:
+        static void assign(index_type& dest,
+            std::initializer_list<std::ptrdiff_t> values)
+        {
+            HPX_ASSERT(values.size() == N);
+            dest.fill(0);
+            std::copy_n(values.begin(), (std::min)(values.size(), N),
+                dest.begin());
+        }
+
+        index_type lower_;
+        index_type upper_;
+    };
+
+    /// The order in which the tiles of an \a index_box are enumerated.
+    enum class tile_order
+    {
+        row_major,          ///< the last dimension varies fastest
+        morton              ///< tiles follow a Z-order (Morton) curve
+    };
+
+    /// Describes how the indices of an \a index_box are partitioned into
+    /// tiles by the multi-dimensional \a for_loop.
+    template <std::size_t N>
+    struct tiling
+    {
+        typedef std::array<std::size_t, N> shape_type;
+
+        /// The tile shape is chosen automatically, the tiles are enumerated
+        /// in row-major order.
+        tiling()
+          : order(tile_order::row_major), affinity(false)
+        {
+            shape.fill(0);
+        }
+
+        /// \param shape    The number of indices of a tile in every dimension,
+        ///                 a value of zero lets the algorithm choose the
+        ///                 extent of the tiles in that dimension.
+        /// \param order    The order in which the tiles are enumerated.
+        /// \param affinity If true, the tiles are assigned to the worker
+        ///                 threads in a deterministic way (see \a for_loop).
+        template <typename Shape, HPX_CONCEPT_REQUIRES_(
+            std::is_same<Shape, shape_type>::value)>
+        explicit tiling(Shape const& shape,
+                tile_order order = tile_order::row_major,
+                bool affinity = false)
+          : shape(shape), order(order), affinity(affinity)
+        {}
+
+        /// Same as above, for instance tiling<2>({16, 64}).
+        explicit tiling(std::initializer_list<std::size_t> shape,
+                tile_order order = tile_order::row_major,
+                bool affinity = false)
+          : order(order), affinity(affinity)
+        {
+            HPX_ASSERT(shape.size() == N);
+            this->shape.fill(0);
+            std::copy_n(shape.begin(), (std::min)(shape.size(), N),
+                this->shape.begin());
+        }
+
+        shape_type shape;
+        tile_order order;
+        bool affinity;
+    };
+
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // the number of iterations an automatically shaped tile aims for
+        static const std::size_t tile_target_size = 1ul << 14;
+
+        // the maximal extent of an automatically shaped tile in the last
+        // (contiguous) dimension
+        static const std::size_t tile_max_row_size = 512;
+
+        template <std::size_t N>
+        std::array<std::size_t, N> tile_shape(index_box<N> const& box,
+            tiling<N> const& t, std::size_t cores)
+        {
+            std::array<std::size_t, N> shape;
+            for (std::size_t d = 0; d != N; ++d)
+            {
+                shape[d] = t.shape[d] != 0 ? t.shape[d] :
+                    (std::max)(box.extent(d), std::size_t(1));
+            }
+
+            // the rows of a tile are kept long for the inner loop to
+            // vectorize, the remaining iterations are spread evenly over
+            // the other dimensions
+            std::size_t const last = N - 1;
+            if (t.shape[last] == 0)
+                shape[last] = (std::min)(shape[last], tile_max_row_size);
+
+            std::size_t free_dims = 0;
+            std::size_t fixed_size = shape[last];
+            for (std::size_t d = 0; d != last; ++d)
+            {
+                if (t.shape[d] == 0)
+                    ++free_dims;
+                else
+                    fixed_size *= shape[d];
+            }
+
+            if (free_dims != 0)
+            {
+                double const remaining = (std::max)(1.0,
+                    double(tile_target_size) / double(fixed_size));
+                std::size_t const extent = (std::max)(std::size_t(1),
+                    static_cast<std::size_t>(std::pow(
+                        remaining, 1.0 / double(free_dims))));
+
+                for (std::size_t d = 0; d != last; ++d)
+                {
+                    if (t.shape[d] == 0)
+                        shape[d] = (std::min)(shape[d], extent);
+                }
+            }
+
+            // make sure there are enough tiles to keep all cores busy
+            std::size_t const min_tiles = 4 * cores;
+            while (true)
+            {
+                std::size_t num_tiles = 1;
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    num_tiles *= (box.extent(d) + shape[d] - 1) / shape[d];
+                }
+                if (num_tiles >= min_tiles)
+                    break;
+
+                // split the largest automatically shaped dimension, the
+                // last dimension only if there is no other one
+                std::size_t split = N;
+                for (std::size_t d = 0; d != last; ++d)
+                {
+                    if (t.shape[d] == 0 && shape[d] > 1 &&
+                        (split == N || shape[d] > shape[split]))
+                    {
+                        split = d;
+                    }
+                }
+                if (split == N && t.shape[last] == 0 && shape[last] > 1)
+                    split = last;
+                if (split == N)
+                    break;
+
+                shape[split] = (shape[split] + 1) / 2;
+            }
+            return shape;
+        }
+
+        // interleaves the bits of the coordinates of a tile
+        template <std::size_t N>
+        std::uint64_t morton_code(std::array<std::size_t, N> const& coords)
+        {
+            std::size_t const bits = 64 / N;
+
+            std::uint64_t code = 0;
+            for (std::size_t b = 0; b != bits; ++b)
+            {
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    code |= std::uint64_t((coords[d] >> b) & 1) <<
+                        (b * N + (N - 1 - d));
+                }
+            }
+            return code;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The tiles of an index box in the order they are executed.
+        template <std::size_t N>
+        class tile_space
+        {
+        public:
+            typedef typename index_box<N>::index_type index_type;
+
+            tile_space(index_box<N> const& box, tiling<N> const& t,
+                    std::size_t cores)
+              : box_(box), shape_(tile_shape(box, t, cores)), num_tiles_(1)
+            {
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    tiles_[d] = (box.extent(d) + shape_[d] - 1) / shape_[d];
+                    num_tiles_ *= tiles_[d];
+                }
+
+                strides_[N - 1] = 1;
+                for (std::size_t d = N - 1; d != 0; --d)
+                    strides_[d - 1] = strides_[d] * box.extent(d);
+
+                if (t.order == tile_order::morton && N > 1 &&
+                    num_tiles_ > 1)
+                {
+                    std::vector<std::pair<std::uint64_t, std::size_t> > codes;
+                    codes.reserve(num_tiles_);
+                    for (std::size_t i = 0; i != num_tiles_; ++i)
+                    {
+                        codes.push_back(std::make_pair(
+                            morton_code<N>(coordinates(i)), i));
+                    }
+                    std::sort(codes.begin(), codes.end());
+
+                    order_.reserve(num_tiles_);
+                    for (auto const& c : codes)
+                        order_.push_back(c.second);
+                }
+            }
+
+            std::size_t size() const
+            {
+                return num_tiles_;
+            }
+
+            // the position of the index in row-major order of the box,
+            // used as the ordinal position by the induction objects
+            std::size_t linear_index(index_type const& idx) const
+            {
+                std::size_t pos = 0;
+                for (std::size_t d = 0; d != N; ++d)
+                    pos += std::size_t(idx[d] - box_.lower()[d]) * strides_[d];
+                return pos;
+            }
+
+            // the bounds of the n-th tile to execute
+            void bounds(std::size_t n, index_type& lower,
+                index_type& upper) const
+            {
+                std::array<std::size_t, N> const c =
+                    coordinates(order_.empty() ? n : order_[n]);
+
+                for (std::size_t d = 0; d != N; ++d)
+                {
+                    lower[d] = box_.lower()[d] +
+                        std::ptrdiff_t(c[d] * shape_[d]);
+                    upper[d] = (std::min)(
+                        lower[d] + std::ptrdiff_t(shape_[d]),
+                        box_.upper()[d]);
+                }
+            }
+
+        private:
+            // the coordinates of a tile given its row-major position
+            std::array<std::size_t, N> coordinates(std::size_t i) const
+            {
+                std::array<std::size_t, N> c;
+                for (std::size_t d = N; d != 0; --d)
+                {
+                    c[d - 1] = i % tiles_[d - 1];
+                    i /= tiles_[d - 1];
+                }
+                return c;
+            }
+
+            index_box<N> box_;
+            std::array<std::size_t, N> shape_;
+            std::array<std::size_t, N> tiles_;
+            std::array<std::size_t, N> strides_;
+            std::size_t num_tiles_;
+            std::vector<std::size_t> order_;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Executes the iterations of the tiles [first, last) of a tile
+        // space, the inductions are initialized at the beginning of every
+        // row of a tile.
+        template <std::size_t N, typename F, typename Args>
+        class tile_iterations;
+
+        template <std::size_t N, typename F, typename ... Ts>
+        class tile_iterations<N, F, hpx::util::tuple<Ts...> >
+        {
+            typedef typename index_box<N>::index_type index_type;
+            typedef typename hpx::util::detail::make_index_pack<
+                    N - 1
+                >::type outer_pack;
+            typedef typename hpx::util::detail::make_index_pack<
+                    sizeof...(Ts)
+                >::type args_pack;
+
+        public:
+            tile_iterations(tile_space<N> const& space, F& f,
+                    hpx::util::tuple<Ts...>& args)
+              : space_(space), f_(f), args_(args)
+            {}
+
+            void execute(std::size_t first, std::size_t last)
+            {
+                index_type lower, upper, idx;
+                for (/**/; first != last; ++first)
+                {
+                    space_.bounds(first, lower, upper);
+                    execute_tile(lower, upper, idx,
+                        std::integral_constant<std::size_t, 0>());
+                }
+            }
+
+        private:
+            template <std::size_t D>
+            void execute_tile(index_type const& lower,
+                index_type const& upper, index_type& idx,
+                std::integral_constant<std::size_t, D>)
+            {
+                for (idx[D] = lower[D]; idx[D] < upper[D]; ++idx[D])
+                {
+                    execute_tile(lower, upper, idx,
+                        std::integral_constant<std::size_t, D + 1>());
+                }
+            }
+
+            void execute_tile(index_type const& lower,
+                index_type const& upper, index_type& idx,
+                std::integral_constant<std::size_t, N - 1>)
+            {
+                std::size_t const last = N - 1;
+                if (lower[last] >= upper[last])
+                    return;
+
+                idx[last] = lower[last];
+                std::size_t pos = space_.linear_index(idx);
+                detail::init_iteration(args_, args_pack(), pos);
+
+                for (std::ptrdiff_t i = lower[last]; i != upper[last]; ++i)
+                {
+                    invoke_iteration(idx, i, outer_pack(), args_pack());
+                    detail::next_iteration(args_, args_pack(), ++pos);
+                }
+            }
+
+            template <std::size_t ... Is, std::size_t ... Js>
+            HPX_FORCEINLINE void invoke_iteration(index_type const& idx,
+                std::ptrdiff_t i,
+                hpx::util::detail::pack_c<std::size_t, Is...>,
+                hpx::util::detail::pack_c<std::size_t, Js...>)
+            {
+                hpx::util::invoke(f_, idx[Is]..., i,
+                    hpx::util::get<Js>(args_).iteration_value()...);
+            }
+
+            tile_space<N> const& space_;
+            F& f_;
+            hpx::util::tuple<Ts...>& args_;
+        };
+
+        template <std::size_t N, typename F, typename Args>
+        void execute_tiles(tile_space<N> const& space, F& f, Args& args,
+            std::size_t first, std::size_t last)
+        {
+            tile_iterations<N, F, Args>(space, f, args).execute(first, last);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The tiles are assigned to the worker threads in a deterministic
+        // way only if the tasks are run by the default thread pool.
+        template <typename Executor>
+        struct supports_tile_affinity
+          : std::is_same<
+                typename hpx::util::decay<Executor>::type,
+                execution::parallel_executor>
+        {};
+
+        // Runs the contiguous block of tiles k on worker thread k, repeated
+        // invocations with the same box and tiling touch the same data from
+        // the same workers (and therefore from the same NUMA domains).
+        template <typename ExPolicy, std::size_t N, typename F, typename Args>
+        void for_loop_tiled_affinity(ExPolicy const& policy,
+            tile_space<N> const& space, F const& f, Args const& args)
+        {
+            std::size_t const num_workers = (std::min)(
+                hpx::get_os_thread_count(), space.size());
+
+            std::vector<hpx::future<void> > tasks;
+            tasks.reserve(num_workers);
+            for (std::size_t k = 0; k != num_workers; ++k)
+            {
+                hpx::threads::executors::default_executor exec(
+                    hpx::threads::thread_schedule_hint(
+                        static_cast<std::int16_t>(k)));
+
+                tasks.push_back(execution::async_execute(exec,
+                    [&space, &f, &args, k, num_workers]()
+                    {
+                        std::size_t const count = space.size();
+                        F func(f);
+                        Args local_args(args);
+                        execute_tiles(space, func, local_args,
+                            k * count / num_workers,
+                            (k + 1) * count / num_workers);
+                    }));
+            }
+            hpx::wait_all(tasks);
+
+            std::list<std::exception_ptr> errors;
+            util::detail::handle_local_exceptions<ExPolicy>::call(
+                tasks, errors);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <std::size_t N>
+        struct for_loop_tiled_algo
+          : public v1::detail::algorithm<for_loop_tiled_algo<N> >
+        {
+            for_loop_tiled_algo()
+              : for_loop_tiled_algo::algorithm("for_loop_tiled")
+            {}
+
+            template <typename ExPolicy, typename F, typename... Ts>
+            static hpx::util::unused_type
+            sequential(ExPolicy, index_box<N> const& box,
+                tiling<N> const& t, F && f, Ts &&... ts)
+            {
+                typedef hpx::util::tuple<Ts&...> args_type;
+
+                std::size_t const size = box.size();
+                if (size == 0)
+                    return hpx::util::unused_type();
+
+                // the tiles are not split any further for parallelism
+                tile_space<N> const space(box, t, 0);
+                args_type args(ts...);
+                execute_tiles(space, f, args, 0, space.size());
+
+                // make sure live-out variables are properly set on return
+                detail::exit_iteration(args,
+                    typename hpx::util::detail::make_index_pack<
+                        sizeof...(Ts)>::type(), size);
+
+                return hpx::util::unused_type();
+            }
+
+            template <typename ExPolicy, typename F, typename... Ts>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy && policy, index_box<N> const& box,
+                tiling<N> const& t, F && f, Ts &&... ts)
+            {
+                typedef util::detail::algorithm_result<ExPolicy> result;
+                typedef typename hpx::util::decay<ExPolicy>::type policy_type;
+                typedef typename hpx::util::decay<F>::type fun_type;
+                typedef hpx::util::tuple<
+                        typename hpx::util::decay<Ts>::type...
+                    > args_type;
+                typedef typename hpx::util::detail::make_index_pack<
+                        sizeof...(Ts)
+                    >::type args_pack;
+
+                std::size_t const size = box.size();
+                if (size == 0)
+                    return result::get();
+
+                std::size_t const cores = execution::processing_units_count(
+                    policy.executor(), policy.parameters());
+
+                std::shared_ptr<tile_space<N> > space =
+                    std::make_shared<tile_space<N> >(box, t, cores);
+                fun_type func(std::forward<F>(f));
+                args_type args(std::forward<Ts>(ts)...);
+
+                if (t.affinity &&
+                    supports_tile_affinity<
+                        typename policy_type::executor_type
+                    >::value)
+                {
+                    return result::get(execution::async_execute(
+                        policy.executor(),
+                        [=]() mutable
+                        {
+                            for_loop_tiled_affinity(policy, *space, func,
+                                args);
+
+                            // make sure live-out variables are properly set
+                            // on return
+                            detail::exit_iteration(args, args_pack(), size);
+                        }));
+                }
+
+                return util::partitioner<ExPolicy>::call_with_index(
+                    std::forward<ExPolicy>(policy), std::size_t(0),
+                    space->size(), 1,
+                    [space, func, args](std::size_t part_begin,
+                        std::size_t part_steps, std::size_t)
+                    {
+                        fun_type f(func);
+                        args_type local_args(args);
+                        execute_tiles(*space, f, local_args, part_begin,
+                            part_begin + part_steps);
+                    },
+                    [=](std::vector<hpx::future<void> > &&) mutable -> void
+                    {
+                        // make sure live-out variables are properly set on
+                        // return
+                        detail::exit_iteration(args, args_pack(), size);
+                    });
+            }
+        };
+
+        // reshuffle arguments, last argument is function object, will go first
+        template <typename ExPolicy, std::size_t N, std::size_t... Is,
+            typename... Args>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        for_loop_tiled(ExPolicy && policy, index_box<N> const& box,
+            tiling<N> const& t, hpx::util::detail::pack_c<std::size_t, Is...>,
+            Args &&... args)
+        {
+            typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+            auto && a = hpx::util::forward_as_tuple(std::forward<Args>(args)...);
+
+            return for_loop_tiled_algo<N>().call(
+                std::forward<ExPolicy>(policy), is_seq(), box, t,
+                hpx::util::get<sizeof...(Args)-1>(a), hpx::util::get<Is>(a)...);
+        }
+        /// \endcond
+    }
+
+    /// The multi-dimensional for_loop implements loop functionality over the
+    /// indices of an N-dimensional box. The box is partitioned into tiles
+    /// which are executed as a whole by a single task, the iterations of a
+    /// tile are executed in row-major order (the last dimension varies
+    /// fastest).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam N           The number of dimensions of the box (deduced).
+    /// \tparam Args        A parameter pack, it's last element is a function
+    ///                     object to be invoked for each iteration, the others
+    ///                     have to be either conforming to the induction or
+    ///                     reduction concept.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param box          The box of indices the loop iterates over.
+    /// \param t            Describes the shape and order of the tiles.
+    /// \param args         The last element of this parameter pack is the
+    ///                     function (object) to invoke, while the remaining
+    ///                     elements of the parameter pack are instances of
+    ///                     either induction or reduction objects.
+    ///                     The function (or function object) which will be
+    ///                     invoked for each of the indices of the box
+    ///                     should expose a signature equivalent to:
+    ///                     \code
+    ///                     <ignored> pred(std::ptrdiff_t i0, ...,
+    ///                         std::ptrdiff_t iN_1, ...);
+    ///                     \endcode \n
+    ///                     It will receive the N components of the current
+    ///                     index and one argument for each of the induction or
+    ///                     reduction objects passed to the algorithms,
+    ///                     representing their current values.
+    ///
+    /// The induction values correspond to the position of the index in
+    /// row-major order of the box, independently of the tiling.
+    ///
+    /// Dimensions of the tile shape given as zero are chosen by the
+    /// algorithm: a tile spans up to 512 indices in the last dimension and
+    /// about 16384 indices in total, tiles are split further until there are
+    /// at least four tiles per core.
+    ///
+    /// If the tiling requests tile affinity and the execution policy uses
+    /// the default \a parallel_executor, the tiles (in the order given by
+    /// the tiling) are divided into one contiguous block per worker thread
+    /// and every block is scheduled on its worker thread. Repeated calls
+    /// with the same box and tiling access the same data from the same
+    /// worker threads, which keeps the memory first touched by a worker
+    /// local to its NUMA domain. Together with \a tile_order::morton the
+    /// blocks are compact in all dimensions. Otherwise the tiles are
+    /// distributed by the partitioner of the execution policy, honoring
+    /// its executor parameters.
+    ///
+    /// Complexity: Applies \a f exactly once for each index of the box.
+    ///
+    /// Remarks: If \a f returns a result, the result is ignored.
+    ///
+    /// \returns  The \a for_loop algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, std::size_t N, typename... Args,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value)>
+    typename util::detail::algorithm_result<ExPolicy>::type
+    for_loop(ExPolicy && policy, index_box<N> const& box, tiling<N> t,
+        Args &&... args)
+    {
+        static_assert(sizeof...(Args) >= 1,
+            "for_loop must be called with at least a function object");
+
+        using hpx::util::detail::make_index_pack;
+        return detail::for_loop_tiled(
+            std::forward<ExPolicy>(policy), box, t,
+            typename make_index_pack<sizeof...(Args)-1>::type(),
+            std::forward<Args>(args)...);
+    }
+
+    /// The multi-dimensional for_loop implements loop functionality over the
+    /// indices of an N-dimensional box, using automatically shaped tiles in
+    /// row-major order. See the overload taking a \a tiling for details.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam N           The number of dimensions of the box (deduced).
+    /// \tparam Args        A parameter pack, it's last element is a function
+    ///                     object to be invoked for each iteration, the others
+    ///                     have to be either conforming to the induction or
+    ///                     reduction concept.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param box          The box of indices the loop iterates over.
+    /// \param args         The last element of this parameter pack is the
+    ///                     function (object) to invoke, while the remaining
+    ///                     elements of the parameter pack are instances of
+    ///                     either induction or reduction objects.
+    ///
+    /// \returns  The \a for_loop algorithm returns a
+    ///           \a hpx::future<void> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a void
+    ///           otherwise.
+    ///
+    template <typename ExPolicy, std::size_t N, typename... Args,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value)>
+    typename util::detail::algorithm_result<ExPolicy>::type
+    for_loop(ExPolicy && policy, index_box<N> const& box, Args &&... args)
+    {
+        static_assert(sizeof...(Args) >= 1,
+            "for_loop must be called with at least a function object");
+
+        using hpx::util::detail::make_index_pack;
+        return detail::for_loop_tiled(
+            std::forward<ExPolicy>(policy), box, tiling<N>(),
+            typename make_index_pack<sizeof...(Args)-1>::type(),
+            std::forward<Args>(args)...);
+    }
+
+    /// The multi-dimensional for_loop implements loop functionality over the
+    /// indices of an N-dimensional box. The iterations are executed
+    /// sequentially in the calling thread.
+    ///
+    /// \tparam N           The number of dimensions of the box (deduced).
+    /// \tparam Args        A parameter pack, it's last element is a function
+    ///                     object to be invoked for each iteration, the others
+    ///                     have to be either conforming to the induction or
+    ///                     reduction concept. It may start with a \a tiling.
+    ///
+    /// \param box          The box of indices the loop iterates over.
+    /// \param args         The last element of this parameter pack is the
+    ///                     function (object) to invoke, while the remaining
+    ///                     elements of the parameter pack are instances of
+    ///                     either induction or reduction objects.
+    ///
+    template <std::size_t N, typename... Args>
+    void for_loop(index_box<N> const& box, Args &&... args)
+    {
+        static_assert(sizeof...(Args) >= 1,
+            "for_loop must be called with at least a function object");
+
+        return for_loop(parallel::execution::seq, box,
+            std::forward<Args>(args)...);
+    }
+}}}
+
+#endif
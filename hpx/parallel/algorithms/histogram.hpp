@@ -0,0 +1,383 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/histogram.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_HISTOGRAM_HPP)
+#define HPX_PARALLEL_ALGORITHMS_HISTOGRAM_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/histogram.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // histogram
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename FwdIter>
+        struct histogram
+          : public detail::algorithm<histogram<FwdIter>, FwdIter>
+        {
+            histogram()
+              : histogram::algorithm("histogram")
+            {}
+
+            template <typename ExPolicy, typename RandomIt, typename Proj>
+            static FwdIter
+            sequential(ExPolicy, RandomIt first, RandomIt last, FwdIter dest,
+                std::size_t num_bins, Proj && proj)
+            {
+                return histogram_sequential(first, last, dest, num_bins,
+                    proj);
+            }
+
+            template <typename ExPolicy, typename RandomIt, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, FwdIter
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                FwdIter dest, std::size_t num_bins, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, FwdIter
+                > algorithm_result;
+
+                try {
+                    return algorithm_result::get(
+                        histogram_async(std::forward<ExPolicy>(policy),
+                            first, last, dest, num_bins,
+                            std::forward<Proj>(proj)));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, FwdIter>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Counts the elements in the range [first, last) per bin, the bin of an
+    /// element is given by INVOKE(proj, *it). The number of elements in bin
+    /// b is assigned to *(dest + b) for every b in [0, num_bins). Elements
+    /// whose bin is not in [0, num_bins) are not counted.
+    ///
+    /// \note   Complexity: O(N + B), where N = std::distance(first, last)
+    ///                     and B = num_bins.
+    ///
+    /// The parallel versions count the elements of every chunk of the input
+    /// sequence in private bins, no synchronization is required while
+    /// counting. The bins of a chunk are kept in a dense array if num_bins is
+    /// small compared to the size of the chunk and in an open addressing
+    /// hash table otherwise. Afterwards, the counts of contiguous ranges of
+    /// bins are added up and written to the output sequence in parallel.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter     The type of the iterator representing the
+    ///                     destination range (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator. std::size_t has to be assignable
+    ///                     to its value type.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity. The
+    ///                     projected type has to be an integral type.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param dest         Refers to the beginning of the destination range
+    ///                     of the counts.
+    /// \param num_bins     The number of bins to count.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each element to obtain its
+    ///                     bin.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a histogram algorithm returns a
+    ///           \a hpx::future<FwdIter> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a FwdIter
+    ///           otherwise.
+    ///           The algorithm returns the iterator dest + num_bins.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt, typename FwdIter,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        hpx::traits::is_iterator<FwdIter>::value &&
+        traits::is_projected<Proj, RandomIt>::value)>
+    typename util::detail::algorithm_result<ExPolicy, FwdIter>::type
+    histogram(ExPolicy && policy, RandomIt first, RandomIt last, FwdIter dest,
+        std::size_t num_bins, Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value) &&
+            (hpx::traits::is_forward_iterator<FwdIter>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        typedef typename hpx::util::decay<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type bin_type;
+        static_assert(std::is_integral<bin_type>::value,
+            "Requires an integral bin.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::histogram<FwdIter>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last, dest,
+            num_bins, std::forward<Proj>(proj));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // aggregate_by_key
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename Key, typename Value, typename FwdIter1,
+            typename FwdIter2>
+        struct aggregate_by_key
+          : public detail::algorithm<
+                aggregate_by_key<Key, Value, FwdIter1, FwdIter2>,
+                std::pair<FwdIter1, FwdIter2> >
+        {
+            aggregate_by_key()
+              : aggregate_by_key::algorithm("aggregate_by_key")
+            {}
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Func, typename Hash, typename KeyEqual>
+            static std::pair<FwdIter1, FwdIter2>
+            sequential(ExPolicy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Func && func, Hash && hash,
+                KeyEqual && eq)
+            {
+                return aggregate_by_key_sequential<Key, Value>(key_first,
+                    key_last, values_first, keys_output, values_output,
+                    func, hash, eq);
+            }
+
+            template <typename ExPolicy, typename RanIter, typename RanIter2,
+                typename Func, typename Hash, typename KeyEqual>
+            static typename util::detail::algorithm_result<
+                ExPolicy, std::pair<FwdIter1, FwdIter2>
+            >::type
+            parallel(ExPolicy && policy, RanIter key_first, RanIter key_last,
+                RanIter2 values_first, FwdIter1 keys_output,
+                FwdIter2 values_output, Func && func, Hash && hash,
+                KeyEqual && eq)
+            {
+                typedef std::pair<FwdIter1, FwdIter2> result_type;
+                typedef util::detail::algorithm_result<
+                    ExPolicy, result_type
+                > algorithm_result;
+
+                try {
+                    return algorithm_result::get(
+                        aggregate_by_key_async<Key, Value>(
+                            std::forward<ExPolicy>(policy), key_first,
+                            key_last, values_first, keys_output,
+                            values_output, std::forward<Func>(func),
+                            std::forward<Hash>(hash),
+                            std::forward<KeyEqual>(eq)));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, result_type>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Combines the values of all elements with equal keys. For every
+    /// distinct key in the range [key_first, key_last) the key and the
+    /// generalized sum (using \a func) of the corresponding elements of the
+    /// range starting at values_first are written to the output sequences.
+    /// Unlike \a reduce_by_key, the keys don't have to be sorted and equal
+    /// keys don't have to be adjacent.
+    ///
+    /// \note   Complexity: O(N) applications of \a hash and expected O(N)
+    ///                     applications of \a func and \a eq, where
+    ///                     N = std::distance(key_first, key_last).
+    ///
+    /// The parallel versions aggregate every chunk of the input sequence in
+    /// a private open addressing hash table, no synchronization is required
+    /// while aggregating. The entries of these tables are distributed by
+    /// their hash values to shards which are merged and written to the
+    /// output sequences in parallel. The order of the output elements is
+    /// unspecified.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RanIter     The type of the key iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam RanIter2    The type of the value iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam FwdIter1    The type of the iterator representing the
+    ///                     destination key range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam FwdIter2    The type of the iterator representing the
+    ///                     destination value range (deduced).
+    ///                     This iterator type must meet the requirements of an
+    ///                     forward iterator.
+    /// \tparam Func        The type of the function/function object used to
+    ///                     combine values (deduced). Assumed to be std::plus
+    ///                     otherwise.
+    /// \tparam Hash        The type of the function/function object used to
+    ///                     hash keys (deduced). Assumed to be std::hash
+    ///                     otherwise.
+    /// \tparam KeyEqual    The type of the function/function object used to
+    ///                     compare keys (deduced). Assumed to be
+    ///                     std::equal_to otherwise.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param key_first    Refers to the beginning of the sequence of key elements
+    ///                     the algorithm will be applied to.
+    /// \param key_last     Refers to the end of the sequence of key elements the
+    ///                     algorithm will be applied to.
+    /// \param values_first Refers to the beginning of the sequence of value elements
+    ///                     the algorithm will be applied to.
+    /// \param keys_output  Refers to the start output location for the keys
+    ///                     produced by the algorithm.
+    /// \param values_output Refers to the start output location for the values
+    ///                     produced by the algorithm.
+    /// \param func         Specifies the function (or function object) which
+    ///                     combines two values. It has to be associative and
+    ///                     commutative, the values are combined in an
+    ///                     unspecified order.
+    /// \param hash         Specifies the function (or function object) which
+    ///                     computes the hash value of a key.
+    /// \param eq           Specifies the function (or function object) which
+    ///                     returns true if two keys are equal. Equal keys
+    ///                     must have equal hash values.
+    ///
+    /// The key and value types of the input sequences have to be default
+    /// constructible and move assignable.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a aggregate_by_key algorithm returns a
+    ///           \a hpx::future<pair<Iter1,Iter2>> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a pair<Iter1,Iter2>
+    ///           otherwise. The iterators point past the last key and value
+    ///           written.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RanIter, typename RanIter2,
+        typename FwdIter1, typename FwdIter2,
+        typename Func = std::plus<
+            typename std::iterator_traits<RanIter2>::value_type>,
+        typename Hash = std::hash<
+            typename std::iterator_traits<RanIter>::value_type>,
+        typename KeyEqual = std::equal_to<
+            typename std::iterator_traits<RanIter>::value_type>,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RanIter>::value &&
+        hpx::traits::is_iterator<RanIter2>::value &&
+        hpx::traits::is_iterator<FwdIter1>::value &&
+        hpx::traits::is_iterator<FwdIter2>::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy, std::pair<FwdIter1, FwdIter2>
+    >::type
+    aggregate_by_key(ExPolicy && policy, RanIter key_first, RanIter key_last,
+        RanIter2 values_first, FwdIter1 keys_output, FwdIter2 values_output,
+        Func && func = Func(), Hash && hash = Hash(),
+        KeyEqual && eq = KeyEqual())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RanIter>::value) &&
+            (hpx::traits::is_random_access_iterator<RanIter2>::value) &&
+            (hpx::traits::is_forward_iterator<FwdIter1>::value) &&
+            (hpx::traits::is_forward_iterator<FwdIter2>::value),
+            "iterators : Random_access for inputs and forward for outputs.");
+
+        typedef typename std::iterator_traits<RanIter>::value_type key_type;
+        typedef typename std::iterator_traits<RanIter2>::value_type
+            value_type;
+
+        // the keys and values are aggregated in pre-allocated tables
+        static_assert(
+            std::is_default_constructible<key_type>::value &&
+            std::is_move_assignable<key_type>::value,
+            "Requires default constructible and move assignable keys.");
+        static_assert(
+            std::is_default_constructible<value_type>::value &&
+            std::is_move_assignable<value_type>::value,
+            "Requires default constructible and move assignable values.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::aggregate_by_key<
+                key_type, value_type, FwdIter1, FwdIter2
+            >().call(
+                std::forward<ExPolicy>(policy), is_seq(), key_first, key_last,
+                values_first, keys_output, values_output,
+                std::forward<Func>(func), std::forward<Hash>(hash),
+                std::forward<KeyEqual>(eq));
+    }
+}}}
+
+#endif
@@ -42,13 +42,55 @@ namespace hpx { namespace parallel { inline namespace v1
     namespace detail
     {
         /// \cond NOINTERNAL
+
+        // Moves best to the next element in [it, it + count) matching pred
+        // until there is none left. The predicate compares the elements with
+        // the one best refers to. For vector pack execution policies each of
+        // the searches is vectorized, which is much faster than comparing the
+        // elements one by one as long as best changes rarely.
+        template <typename ExPolicy, typename FwdIter, typename Pred>
+        void sequential_find_record(FwdIter& best, FwdIter it,
+            std::size_t count, Pred const& pred)
+        {
+            while (count != 0)
+            {
+                FwdIter next = util::find_first_n<ExPolicy>(it, count, pred);
+
+                std::size_t skipped =
+                    static_cast<std::size_t>(std::distance(it, next));
+                if (skipped == count)
+                    break;
+
+                best = next;
+                it = ++next;
+                count -= skipped + 1;
+            }
+        }
+
+        // matches the elements which are smaller than the current minimum
+        template <typename F, typename Proj, typename FwdIter>
+        struct smaller_than_min
+        {
+            F const& f_;
+            Proj const& proj_;
+            FwdIter const& smallest_;
+
+            template <typename T>
+            auto operator()(T const& t) const
+            ->  decltype(hpx::util::invoke(std::declval<F const&>(),
+                    hpx::util::invoke(std::declval<Proj const&>(), t),
+                    hpx::util::invoke(std::declval<Proj const&>(),
+                        *std::declval<FwdIter const&>())))
+            {
+                return hpx::util::invoke(f_, hpx::util::invoke(proj_, t),
+                    hpx::util::invoke(proj_, *smallest_));
+            }
+        };
+
         template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
         FwdIter sequential_min_element(ExPolicy && policy, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
+            std::size_t count, F const& f, Proj const& proj, std::false_type)
         {
-            if (count == 0 || count == 1)
-                return it;
-
             FwdIter smallest = it;
             util::loop_n<ExPolicy>(
                 ++it, count-1,
@@ -65,6 +107,30 @@ namespace hpx { namespace parallel { inline namespace v1
             return smallest;
         }
 
+        template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+        FwdIter sequential_min_element(ExPolicy && policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj, std::true_type)
+        {
+            FwdIter smallest = it;
+            sequential_find_record<ExPolicy>(smallest, ++it, count - 1,
+                smaller_than_min<F, Proj, FwdIter>{f, proj, smallest});
+            return smallest;
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+        FwdIter sequential_min_element(ExPolicy && policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            typedef execution::is_vectorpack_execution_policy<ExPolicy>
+                is_vectorpack;
+
+            return sequential_min_element(std::forward<ExPolicy>(policy), it,
+                count, f, proj, is_vectorpack());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct min_element
@@ -83,7 +149,8 @@ namespace hpx { namespace parallel { inline namespace v1
                     return *it;
 
                 typename std::iterator_traits<FwdIter>::value_type smallest = *it;
-                util::loop_n<ExPolicy>(
+                // the partition results are not suitable for vectorization
+                util::loop_n<execution::sequenced_policy>(
                     ++it, count-1,
                     [&f, &smallest, &proj](FwdIter const& curr) -> void
                     {
@@ -273,13 +340,32 @@ namespace hpx { namespace parallel { inline namespace v1
     namespace detail
     {
         /// \cond NOINTERNAL
+
+        // matches the elements which are greater than the current maximum
+        template <typename F, typename Proj, typename FwdIter>
+        struct greater_than_max
+        {
+            F const& f_;
+            Proj const& proj_;
+            FwdIter const& greatest_;
+
+            template <typename T>
+            auto operator()(T const& t) const
+            ->  decltype(hpx::util::invoke(std::declval<F const&>(),
+                    hpx::util::invoke(std::declval<Proj const&>(),
+                        *std::declval<FwdIter const&>()),
+                    hpx::util::invoke(std::declval<Proj const&>(), t)))
+            {
+                return hpx::util::invoke(f_,
+                    hpx::util::invoke(proj_, *greatest_),
+                    hpx::util::invoke(proj_, t));
+            }
+        };
+
         template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
         FwdIter sequential_max_element(ExPolicy && policy, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
+            std::size_t count, F const& f, Proj const& proj, std::false_type)
         {
-            if (count == 0 || count == 1)
-                return it;
-
             FwdIter greatest = it;
             util::loop_n<ExPolicy>(
                 ++it, count-1,
@@ -296,6 +382,30 @@ namespace hpx { namespace parallel { inline namespace v1
             return greatest;
         }
 
+        template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+        FwdIter sequential_max_element(ExPolicy && policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj, std::true_type)
+        {
+            FwdIter greatest = it;
+            sequential_find_record<ExPolicy>(greatest, ++it, count - 1,
+                greater_than_max<F, Proj, FwdIter>{f, proj, greatest});
+            return greatest;
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+        FwdIter sequential_max_element(ExPolicy && policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return it;
+
+            typedef execution::is_vectorpack_execution_policy<ExPolicy>
+                is_vectorpack;
+
+            return sequential_max_element(std::forward<ExPolicy>(policy), it,
+                count, f, proj, is_vectorpack());
+        }
+
         ///////////////////////////////////////////////////////////////////////
         template <typename Iter>
         struct max_element
@@ -314,7 +424,8 @@ namespace hpx { namespace parallel { inline namespace v1
                     return *it;
 
                 typename std::iterator_traits<FwdIter>::value_type greatest = *it;
-                util::loop_n<ExPolicy>(
+                // the partition results are not suitable for vectorization
+                util::loop_n<execution::sequenced_policy>(
                     ++it, count-1,
                     [&f, &greatest, &proj](FwdIter const& curr) -> void
                     {
@@ -508,16 +619,35 @@ namespace hpx { namespace parallel { inline namespace v1
     namespace detail
     {
         /// \cond NOINTERNAL
+
+        // matches the elements which are not smaller than the current maximum,
+        // minmax_element returns the last of the greatest elements
+        template <typename F, typename Proj, typename FwdIter>
+        struct not_smaller_than_max
+        {
+            F const& f_;
+            Proj const& proj_;
+            FwdIter const& greatest_;
+
+            template <typename T>
+            auto operator()(T const& t) const
+            ->  decltype(!hpx::util::invoke(std::declval<F const&>(),
+                    hpx::util::invoke(std::declval<Proj const&>(), t),
+                    hpx::util::invoke(std::declval<Proj const&>(),
+                        *std::declval<FwdIter const&>())))
+            {
+                return !hpx::util::invoke(f_, hpx::util::invoke(proj_, t),
+                    hpx::util::invoke(proj_, *greatest_));
+            }
+        };
+
         template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
         std::pair<FwdIter, FwdIter>
         sequential_minmax_element(ExPolicy && policy, FwdIter it,
-            std::size_t count, F const& f, Proj const& proj)
+            std::size_t count, F const& f, Proj const& proj, std::false_type)
         {
             std::pair<FwdIter, FwdIter> result(it, it);
 
-            if (count == 0 || count == 1)
-                return result;
-
             util::loop_n<ExPolicy>(
                 ++it, count-1,
                 [&f, &result, &proj](FwdIter const& curr) -> void
@@ -540,6 +670,40 @@ namespace hpx { namespace parallel { inline namespace v1
             return result;
         }
 
+        // vector pack execution policies search for the minimum and the
+        // maximum separately, each of the searches is vectorized
+        template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+        std::pair<FwdIter, FwdIter>
+        sequential_minmax_element(ExPolicy && policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj, std::true_type)
+        {
+            std::pair<FwdIter, FwdIter> result(it, it);
+
+            ++it;
+            sequential_find_record<ExPolicy>(result.first, it, count - 1,
+                smaller_than_min<F, Proj, FwdIter>{f, proj, result.first});
+            sequential_find_record<ExPolicy>(result.second, it, count - 1,
+                not_smaller_than_max<F, Proj, FwdIter>{
+                    f, proj, result.second});
+
+            return result;
+        }
+
+        template <typename ExPolicy, typename FwdIter, typename F, typename Proj>
+        std::pair<FwdIter, FwdIter>
+        sequential_minmax_element(ExPolicy && policy, FwdIter it,
+            std::size_t count, F const& f, Proj const& proj)
+        {
+            if (count == 0 || count == 1)
+                return std::pair<FwdIter, FwdIter>(it, it);
+
+            typedef execution::is_vectorpack_execution_policy<ExPolicy>
+                is_vectorpack;
+
+            return sequential_minmax_element(std::forward<ExPolicy>(policy),
+                it, count, f, proj, is_vectorpack());
+        }
+
         template <typename Iter>
         struct minmax_element
           : public detail::algorithm<
@@ -559,7 +723,8 @@ namespace hpx { namespace parallel { inline namespace v1
                     return *it;
 
                 typename std::iterator_traits<PairIter>::value_type result = *it;
-                util::loop_n<ExPolicy>(
+                // the partition results are not suitable for vectorization
+                util::loop_n<execution::sequenced_policy>(
                     ++it, count-1,
                     [&f, &result, &proj](PairIter const& curr) -> void
                     {
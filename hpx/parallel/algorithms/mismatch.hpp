@@ -97,22 +97,14 @@ namespace hpx { namespace parallel { inline namespace v1
                 }
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count1);
 
                 auto f1 = [tok, HPX_CAPTURE_FORWARD(f)](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::get<0>(t),
-                                    hpx::util::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    util::find_first_n<ExPolicy>(base_idx, it, part_count, tok,
+                        detail::not_zip_pred<F>{f});
                 };
 
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
@@ -280,22 +272,14 @@ namespace hpx { namespace parallel { inline namespace v1
                 difference_type count = std::distance(first1, last1);
 
                 typedef hpx::util::zip_iterator<FwdIter1, FwdIter2> zip_iterator;
-                typedef typename zip_iterator::reference reference;
 
                 util::cancellation_token<std::size_t> tok(count);
 
                 auto f1 = [tok, HPX_CAPTURE_FORWARD(f)](zip_iterator it,
                               std::size_t part_count,
                               std::size_t base_idx) mutable -> void {
-                    util::loop_idx_n(base_idx, it, part_count, tok,
-                        [&f, &tok](reference t, std::size_t i) {
-                            if (!hpx::util::invoke(f,
-                                    hpx::util::get<0>(t),
-                                    hpx::util::get<1>(t)))
-                            {
-                                tok.cancel(i);
-                            }
-                        });
+                    util::find_first_n<ExPolicy>(base_idx, it, part_count, tok,
+                        detail::not_zip_pred<F>{f});
                 };
                 auto f2 = [=](std::vector<hpx::future<void>>&&) mutable
                     -> std::pair<FwdIter1, FwdIter2> {
@@ -0,0 +1,391 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/nth_element.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_NTH_ELEMENT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_NTH_ELEMENT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // nth_element
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // the minimal number of elements partitioned in parallel
+        static const std::size_t nth_element_limit = 65536ul;
+
+        // Parallel selection: two pivots close to the rank of nth amongst a
+        // random sample divide the range into the elements less than the
+        // lower pivot, the elements between the pivots and the elements
+        // greater than the upper pivot. The elements are classified and
+        // moved to their part through a temporary buffer in parallel (like
+        // in the sample sort). The selection continues within the part
+        // holding nth, which is expected to be small.
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        void parallel_nth_element(ExPolicy const& policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare const& comp, std::true_type)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+
+            std::size_t const size = std::size_t(last - first);
+            if (size < nth_element_limit)
+            {
+                std::nth_element(first, nth, last, comp);
+                return;
+            }
+
+            sample_sort_buffer<value_type> buffer(size);
+            value_type* data = buffer.data_;
+
+            std::unique_ptr<std::uint8_t[]> part_of(new std::uint8_t[size]);
+            std::minstd_rand gen(static_cast<unsigned>(size));
+
+            while (nth != last)
+            {
+                std::size_t const count = std::size_t(last - first);
+                std::size_t const num_chunks = (std::min)(4 * cores,
+                    count / (nth_element_limit / 16));
+
+                if (count < nth_element_limit || num_chunks < 2)
+                {
+                    std::nth_element(first, nth, last, comp);
+                    return;
+                }
+
+                // select the pivots from the sorted samples
+                std::size_t const num_samples =
+                    num_chunks * sample_sort_oversampling;
+
+                std::uniform_int_distribution<std::size_t> dist(0, count - 1);
+
+                std::vector<value_type> samples;
+                samples.reserve(num_samples);
+                for (std::size_t i = 0; i != num_samples; ++i)
+                    samples.push_back(first[dist(gen)]);
+
+                std::sort(samples.begin(), samples.end(), comp);
+
+                std::size_t const rank =
+                    std::size_t(nth - first) * num_samples / count;
+                std::size_t const delta =
+                    std::size_t(std::sqrt(double(num_samples)));
+
+                value_type const& lower =
+                    samples[rank > delta ? rank - delta : 0];
+                value_type const& upper =
+                    samples[(std::min)(rank + delta, num_samples - 1)];
+
+                // classify the elements in parallel, counts[chunk][part]
+                auto chunk_begin =
+                    [count, num_chunks](std::size_t chunk) -> std::size_t
+                    {
+                        return chunk * count / num_chunks;
+                    };
+
+                std::vector<std::size_t> counts(3 * num_chunks, 0);
+                sample_sort_for_each(policy, num_chunks,
+                    [&](std::size_t chunk)
+                    {
+                        std::size_t* chunk_counts = &counts[3 * chunk];
+                        for (std::size_t i = chunk_begin(chunk);
+                             i != chunk_begin(chunk + 1); ++i)
+                        {
+                            std::uint8_t part = 1;
+                            if (comp(first[i], lower))
+                                part = 0;
+                            else if (comp(upper, first[i]))
+                                part = 2;
+
+                            part_of[i] = part;
+                            ++chunk_counts[part];
+                        }
+                    });
+
+                std::size_t sizes[3] = { 0, 0, 0 };
+                std::vector<std::size_t> positions(3 * num_chunks);
+
+                std::size_t position = 0;
+                for (std::size_t part = 0; part != 3; ++part)
+                {
+                    for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                    {
+                        positions[3 * chunk + part] = position;
+                        position += counts[3 * chunk + part];
+                        sizes[part] += counts[3 * chunk + part];
+                    }
+                }
+                HPX_ASSERT(position == count);
+
+                // move the elements to their parts and back in parallel
+                sample_sort_for_each(policy, num_chunks,
+                    [&](std::size_t chunk)
+                    {
+                        std::size_t* pos = &positions[3 * chunk];
+                        for (std::size_t i = chunk_begin(chunk);
+                             i != chunk_begin(chunk + 1); ++i)
+                        {
+                            ::new (data + pos[part_of[i]]++)
+                                value_type(std::move(first[i]));
+                        }
+                    });
+
+                sample_sort_for_each(policy, num_chunks,
+                    [&](std::size_t chunk)
+                    {
+                        value_type* const begin = data + chunk_begin(chunk);
+                        value_type* const end = data + chunk_begin(chunk + 1);
+                        sample_sort_bucket_guard<value_type> guard = {
+                            begin, end };
+
+                        std::move(begin, end, first + chunk_begin(chunk));
+                    });
+
+                // continue with the part holding nth
+                std::size_t const pos = std::size_t(nth - first);
+                if (pos < sizes[0])
+                {
+                    last = first + sizes[0];
+                }
+                else if (pos < sizes[0] + sizes[1])
+                {
+                    // all elements between equivalent pivots are equivalent
+                    if (!comp(lower, upper))
+                        return;
+
+                    last = first + sizes[0] + sizes[1];
+                    first += sizes[0];
+                }
+                else
+                {
+                    first += sizes[0] + sizes[1];
+                }
+
+                // no progress, e.g. for many equivalent elements
+                if (std::size_t(last - first) == count)
+                {
+                    std::nth_element(first, nth, last, comp);
+                    return;
+                }
+            }
+        }
+
+        // the pivots are copies of some of the elements
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        void parallel_nth_element(ExPolicy const&, RandomIt first,
+            RandomIt nth, RandomIt last, Compare const& comp, std::false_type)
+        {
+            std::nth_element(first, nth, last, comp);
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        void parallel_nth_element(ExPolicy const& policy, RandomIt first,
+            RandomIt nth, RandomIt last, Compare const& comp)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            parallel_nth_element(policy, first, nth, last, comp,
+                supports_sample_sort<value_type>());
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename RandomIt>
+        struct nth_element
+          : public detail::algorithm<nth_element<RandomIt>, RandomIt>
+        {
+            nth_element()
+              : nth_element::algorithm("nth_element")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt nth, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::nth_element(first, nth, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt nth,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandomIt
+                > algorithm_result;
+                typedef util::compare_projected<
+                        typename hpx::util::decay<Compare>::type,
+                        typename hpx::util::decay<Proj>::type
+                    > compare_type;
+
+                try {
+                    compare_type compare(std::forward<Compare>(comp),
+                        std::forward<Proj>(proj));
+
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [=]() -> RandomIt
+                        {
+                            parallel_nth_element(policy, first, nth, last,
+                                compare);
+                            return last;
+                        }));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the
+    /// element pointed to by \a nth is the element which would occur in
+    /// this position if the range was sorted. All elements before \a nth
+    /// are less than or equal to the elements after \a nth. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(N) on average, where
+    ///                     N = std::distance(first, last) applications of
+    ///                     the predicate.
+    ///
+    /// The parallel versions select the element by repeatedly partitioning
+    /// the range around pivots drawn from a random sample in parallel,
+    /// moving the elements through a temporary buffer of the size of the
+    /// input sequence. This requires the value type to be copy
+    /// constructible and nothrow move constructible, otherwise the element
+    /// is selected sequentially.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param nth          Refers to the position of the element to select.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a nth_element algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    nth_element(ExPolicy && policy, RandomIt first, RandomIt nth,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::nth_element<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, nth, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
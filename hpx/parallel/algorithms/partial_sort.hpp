@@ -0,0 +1,513 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/partial_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_PARTIAL_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_PARTIAL_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/algorithms/nth_element.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // the elements before middle are selected in parallel (see
+        // parallel_nth_element) and sorted in parallel afterwards
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        RandomIt parallel_partial_sort(ExPolicy const& policy,
+            RandomIt first, RandomIt middle, RandomIt last,
+            Compare const& comp, Proj const& proj)
+        {
+            typedef typename use_parallel_radix_sort<
+                    RandomIt, Compare, Proj
+                >::type use_radix_sort;
+
+            if (middle == first)
+                return last;
+
+            util::compare_projected<Compare const&, Proj const&> const
+                compare(comp, proj);
+
+            parallel_nth_element(policy, first, middle, last, compare);
+            sort_async(policy, first, middle, comp, proj,
+                use_radix_sort()).get();
+
+            return last;
+        }
+
+        template <typename RandomIt>
+        struct partial_sort
+          : public detail::algorithm<partial_sort<RandomIt>, RandomIt>
+        {
+            partial_sort()
+              : partial_sort::algorithm("partial_sort")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                std::partial_sort(first, middle, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt middle,
+                RandomIt last, Compare && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandomIt
+                > algorithm_result;
+                typedef typename hpx::util::decay<Compare>::type compare_type;
+                typedef typename hpx::util::decay<Proj>::type proj_type;
+
+                try {
+                    compare_type c(std::forward<Compare>(comp));
+                    proj_type p(std::forward<Proj>(proj));
+
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [=]() -> RandomIt
+                        {
+                            return parallel_partial_sort(policy, first,
+                                middle, last, c, p);
+                        }));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Rearranges the elements in the range [first, last) such that the
+    /// range [first, middle) contains the middle - first smallest elements
+    /// in ascending order. The order of equal elements is not guaranteed to
+    /// be preserved, the order of the remaining elements in [middle, last)
+    /// is unspecified. The function uses the given comparison function
+    /// object comp (defaults to using operator<()).
+    ///
+    /// \note   Complexity: Approximately N * log(M) comparisons, where
+    ///                     N = std::distance(first, last) and
+    ///                     M = std::distance(first, middle).
+    ///
+    /// The parallel versions select the smallest elements in parallel (see
+    /// \a nth_element) and sort them in parallel (see \a sort).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param middle       Refers to the end of the sequence of elements
+    ///                     which will be sorted.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort(ExPolicy && policy, RandomIt first, RandomIt middle,
+        RandomIt last, Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, middle, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // partial_sort_copy
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // the minimal number of elements processed by a single task
+        static const std::size_t partial_sort_copy_limit_per_task = 65536ul;
+
+        // Every chunk of the input selects its smallest elements in
+        // parallel, keeping at most k of them in a heap. The smallest of the
+        // selected elements are copied to the destination and sorted there
+        // in parallel.
+        template <typename ExPolicy, typename FwdIter, typename RandomIt,
+            typename Compare, typename Proj>
+        RandomIt parallel_partial_sort_copy(ExPolicy const& policy,
+            FwdIter first, FwdIter last, RandomIt d_first, RandomIt d_last,
+            Compare const& comp, Proj const& proj)
+        {
+            typedef typename std::iterator_traits<FwdIter>::value_type
+                value_type;
+            typedef typename use_parallel_radix_sort<
+                    RandomIt, Compare, Proj
+                >::type use_radix_sort;
+
+            util::compare_projected<Compare const&, Proj const&> const
+                compare(comp, proj);
+
+            std::size_t const count = std::size_t(std::distance(first, last));
+            std::size_t const k =
+                (std::min)(count, std::size_t(d_last - d_first));
+
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+            std::size_t const num_chunks = (std::min)(cores,
+                count / partial_sort_copy_limit_per_task);
+
+            if (k == 0 || num_chunks < 2)
+            {
+                return std::partial_sort_copy(first, last, d_first, d_last,
+                    compare);
+            }
+
+            std::vector<FwdIter> chunk_first(num_chunks + 1, first);
+            for (std::size_t chunk = 1; chunk <= num_chunks; ++chunk)
+            {
+                chunk_first[chunk] = chunk_first[chunk - 1];
+                std::advance(chunk_first[chunk],
+                    chunk * count / num_chunks -
+                        (chunk - 1) * count / num_chunks);
+            }
+
+            // select the smallest k elements of every chunk in parallel,
+            // the largest selected element is at the top of the heap
+            std::vector<std::vector<value_type> > selected(num_chunks);
+            sample_sort_for_each(policy, num_chunks,
+                [&](std::size_t chunk)
+                {
+                    std::vector<value_type>& s = selected[chunk];
+                    FwdIter it = chunk_first[chunk];
+                    FwdIter const end = chunk_first[chunk + 1];
+
+                    s.reserve((std::min)(k,
+                        (chunk + 1) * count / num_chunks -
+                            chunk * count / num_chunks));
+                    for (/**/; it != end && s.size() != k; ++it)
+                        s.push_back(*it);
+
+                    std::make_heap(s.begin(), s.end(), compare);
+                    for (/**/; it != end; ++it)
+                    {
+                        if (compare(*it, s.front()))
+                        {
+                            std::pop_heap(s.begin(), s.end(), compare);
+                            s.back() = *it;
+                            std::push_heap(s.begin(), s.end(), compare);
+                        }
+                    }
+                });
+
+            std::vector<value_type> candidates;
+            for (std::vector<value_type>& s : selected)
+            {
+                if (candidates.empty())
+                    candidates = std::move(s);
+                else
+                {
+                    candidates.insert(candidates.end(),
+                        std::make_move_iterator(s.begin()),
+                        std::make_move_iterator(s.end()));
+                }
+            }
+            selected.clear();
+
+            if (candidates.size() > k)
+            {
+                parallel_nth_element(policy, candidates.begin(),
+                    candidates.begin() + k, candidates.end(), compare);
+            }
+
+            // copy the smallest elements to the destination in parallel
+            std::size_t const num_copies = (std::min)(num_chunks,
+                (k + partial_sort_copy_limit_per_task - 1) /
+                    partial_sort_copy_limit_per_task);
+
+            sample_sort_for_each(policy, num_copies,
+                [&](std::size_t chunk)
+                {
+                    std::size_t const begin = chunk * k / num_copies;
+                    std::size_t const end = (chunk + 1) * k / num_copies;
+                    std::move(candidates.begin() + begin,
+                        candidates.begin() + end, d_first + begin);
+                });
+
+            RandomIt const d_end = d_first + k;
+            sort_async(policy, d_first, d_end, comp, proj,
+                use_radix_sort()).get();
+
+            return d_end;
+        }
+
+        template <typename RandomIt>
+        struct partial_sort_copy
+          : public detail::algorithm<partial_sort_copy<RandomIt>, RandomIt>
+        {
+            partial_sort_copy()
+              : partial_sort_copy::algorithm("partial_sort_copy")
+            {}
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static RandomIt
+            sequential(ExPolicy, FwdIter first, FwdIter last,
+                RandomIt d_first, RandomIt d_last, Compare && comp,
+                Proj && proj)
+            {
+                return std::partial_sort_copy(first, last, d_first, d_last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename Compare,
+                typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, FwdIter first, FwdIter last,
+                RandomIt d_first, RandomIt d_last, Compare && comp,
+                Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandomIt
+                > algorithm_result;
+                typedef typename hpx::util::decay<Compare>::type compare_type;
+                typedef typename hpx::util::decay<Proj>::type proj_type;
+
+                try {
+                    compare_type c(std::forward<Compare>(comp));
+                    proj_type p(std::forward<Proj>(proj));
+
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [=]() -> RandomIt
+                        {
+                            return parallel_partial_sort_copy(policy, first,
+                                last, d_first, d_last, c, p);
+                        }));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Copies the smallest elements of the range [first, last) in ascending
+    /// order to the range [d_first, d_last). The number of elements copied
+    /// is the size of the smaller one of both ranges. The order of equal
+    /// elements is not guaranteed to be preserved. The function uses the
+    /// given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: Approximately N * log(min(N, M)) comparisons,
+    ///                     where N = std::distance(first, last) and
+    ///                     M = std::distance(d_first, d_last).
+    ///
+    /// The parallel versions select the smallest elements of all chunks of
+    /// the input sequence in parallel, select the smallest ones of those
+    /// (see \a nth_element) and sort them in parallel (see \a sort).
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam FwdIter     The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     forward iterator.
+    /// \tparam RandomIt    The type of the destination iterators used
+    ///                     (deduced). This iterator type must meet the
+    ///                     requirements of a random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param d_first      Refers to the beginning of the destination range.
+    /// \param d_last       Refers to the end of the destination range.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a partial_sort_copy algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element copied to the destination
+    ///           range.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename FwdIter, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<FwdIter>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, FwdIter>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    partial_sort_copy(ExPolicy && policy, FwdIter first, FwdIter last,
+        RandomIt d_first, RandomIt d_last, Compare && comp = Compare(),
+        Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_forward_iterator<FwdIter>::value),
+            "Requires at least forward iterator.");
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::partial_sort_copy<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            d_first, d_last, std::forward<Compare>(comp),
+            std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
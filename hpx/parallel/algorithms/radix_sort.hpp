@@ -0,0 +1,164 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/radix_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_RADIX_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_RADIX_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/decay.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // radix_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+        template <typename RandomIt>
+        struct radix_sort
+          : public detail::algorithm<radix_sort<RandomIt>, RandomIt>
+        {
+            radix_sort()
+              : radix_sort::algorithm("radix_sort")
+            {}
+
+            template <typename ExPolicy, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt last, Proj && proj)
+            {
+                return radix_sort_sequential(first, last, proj);
+            }
+
+            template <typename ExPolicy, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandomIt
+                > algorithm_result;
+
+                try {
+                    return algorithm_result::get(
+                        radix_sort_async(std::forward<ExPolicy>(policy),
+                            first, last, std::forward<Proj>(proj)));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order of
+    /// the arithmetic keys INVOKE(proj, *it), as if compared using
+    /// operator<(). The order of elements with equal keys is not guaranteed
+    /// to be preserved.
+    ///
+    /// \note   Complexity: O(N * K), where N = std::distance(first, last)
+    ///                     and K is the number of bytes of the keys. No
+    ///                     comparisons are performed, except for sorting
+    ///                     small subranges.
+    ///
+    /// The elements are distributed by one byte of their keys at a time,
+    /// starting with the most significant byte in which the keys differ.
+    /// The parallel versions count the elements per byte value in parallel
+    /// and move them through a temporary buffer of the size of the input
+    /// sequence, if the value type is nothrow move constructible. Signed
+    /// integers and IEEE 754 floating point keys are mapped to unsigned
+    /// integers with the same order, -0.0 is sorted before +0.0.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity. The
+    ///                     projected type has to be an integral type, float
+    ///                     or double.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each element to obtain its
+    ///                     key.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a radix_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    radix_sort(ExPolicy && policy, RandomIt first, RandomIt last,
+        Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef typename hpx::util::decay<
+                typename traits::projected_result_of<Proj, RandomIt>::type
+            >::type key_type;
+        static_assert(detail::radix_sort_key<key_type>::value,
+            "Requires an integral or floating point key.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::radix_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
@@ -68,8 +68,8 @@ namespace hpx { namespace parallel { inline namespace v1
                     [r](FwdIterB part_begin, std::size_t part_size) -> T
                     {
                         T val = *part_begin;
-                        return util::accumulate_n(++part_begin, --part_size,
-                            std::move(val), r);
+                        return util::reduce_n<ExPolicy>(++part_begin,
+                            --part_size, std::move(val), r);
                     };
 
                 return util::partitioner<ExPolicy, T>::call(
@@ -194,7 +194,8 @@ namespace hpx { namespace parallel { inline namespace v1
     template <typename ExPolicy, typename FwdIterB, typename FwdIterE,
         typename T, typename F>
     inline typename std::enable_if<
-        execution::is_execution_policy<ExPolicy>::value,
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<FwdIterB>::value,
         typename util::detail::algorithm_result<ExPolicy, T>::type
     >::type
     reduce(ExPolicy&& policy, FwdIterB first, FwdIterE last, T init, F&& f)
@@ -265,7 +266,8 @@ namespace hpx { namespace parallel { inline namespace v1
     template <typename ExPolicy, typename FwdIterB, typename FwdIterE,
         typename T>
     inline typename std::enable_if<
-        execution::is_execution_policy<ExPolicy>::value,
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<FwdIterB>::value,
         typename util::detail::algorithm_result<ExPolicy, T>::type
     >::type
     reduce(ExPolicy&& policy, FwdIterB first, FwdIterE last, T init)
@@ -336,7 +338,8 @@ namespace hpx { namespace parallel { inline namespace v1
     ///
     template <typename ExPolicy, typename FwdIterB, typename FwdIterE>
     inline typename std::enable_if<
-        execution::is_execution_policy<ExPolicy>::value,
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<FwdIterB>::value,
         typename util::detail::algorithm_result<ExPolicy,
             typename std::iterator_traits<FwdIterB>::value_type
         >::type
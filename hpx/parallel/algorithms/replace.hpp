@@ -11,6 +11,7 @@
 #include <hpx/config.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/invoke.hpp>
 #include <hpx/util/tagged_pair.hpp>
 #include <hpx/util/unused.hpp>
@@ -20,6 +21,7 @@
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/tagspec.hpp>
 #include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/traits/vector_pack_conditionals.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
 #include <hpx/parallel/util/zip_iterator.hpp>
@@ -53,6 +55,23 @@ namespace hpx { namespace parallel { inline namespace v1
             return first;
         }
 
+        // The element is passed as a vector pack for vectorizing execution
+        // policies, only the lanes which compare equal are replaced.
+        template <typename T1, typename T2, typename Proj>
+        struct replace_iteration
+        {
+            T1 old_value_;
+            T2 new_value_;
+            Proj proj_;
+
+            template <typename T>
+            HPX_FORCEINLINE void operator()(T& t) const
+            {
+                traits::mask_assign(
+                    hpx::util::invoke(proj_, t) == old_value_, t, new_value_);
+            }
+        };
+
         template <typename Iter>
         struct replace : public detail::algorithm<replace<Iter>, Iter>
         {
@@ -78,20 +97,15 @@ namespace hpx { namespace parallel { inline namespace v1
             parallel(ExPolicy && policy, FwdIter first, FwdIter last,
                 T1 const& old_value, T2 const& new_value, Proj && proj)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                typedef replace_iteration<T1, T2,
+                        typename hpx::util::decay<Proj>::type
+                    > replace_type;
 
                 return for_each_n<FwdIter>().call(
                     std::forward<ExPolicy>(policy), std::false_type(),
                     first, std::distance(first, last),
-                    [old_value, new_value,
-                        HPX_CAPTURE_FORWARD(proj)
-                    ](type& t) -> void
-                    {
-                        if (hpx::util::invoke(proj, t) == old_value)
-                        {
-                            t = new_value;
-                        }
-                    },
+                    replace_type{old_value, new_value,
+                        std::forward<Proj>(proj)},
                     util::projection_identity());
             }
         };
@@ -198,6 +212,21 @@ namespace hpx { namespace parallel { inline namespace v1
             return first;
         }
 
+        template <typename F, typename T, typename Proj>
+        struct replace_if_iteration
+        {
+            F f_;
+            T new_value_;
+            Proj proj_;
+
+            template <typename U>
+            HPX_FORCEINLINE void operator()(U& t) const
+            {
+                using hpx::util::invoke;
+                traits::mask_assign(invoke(f_, invoke(proj_, t)), t, new_value_);
+            }
+        };
+
         template <typename Iter>
         struct replace_if : public detail::algorithm<replace_if<Iter>, Iter>
         {
@@ -223,20 +252,16 @@ namespace hpx { namespace parallel { inline namespace v1
             parallel(ExPolicy && policy, FwdIter first, FwdIter last,
                 F && f, T const& new_value, Proj && proj)
             {
-                typedef typename std::iterator_traits<FwdIter>::value_type type;
+                typedef replace_if_iteration<
+                        typename hpx::util::decay<F>::type, T,
+                        typename hpx::util::decay<Proj>::type
+                    > replace_if_type;
 
                 return for_each_n<FwdIter>().call(
                     std::forward<ExPolicy>(policy), std::false_type(),
                     first, std::distance(first, last),
-                    [new_value,
-                        HPX_CAPTURE_FORWARD(f),
-                        HPX_CAPTURE_FORWARD(proj)
-                    ](type& t) -> void
-                    {
-                        using hpx::util::invoke;
-                        if (invoke(f, invoke(proj, t)))
-                            t = new_value;
-                    },
+                    replace_if_type{std::forward<F>(f), new_value,
+                        std::forward<Proj>(proj)},
                     util::projection_identity());
             }
         };
@@ -19,6 +19,8 @@
 
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
 #include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/radix_sort.hpp>
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
 #include <hpx/parallel/exception_list.hpp>
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/executors/execution.hpp>
@@ -168,6 +170,52 @@ namespace hpx { namespace parallel { inline namespace v1
                 std::move(left), std::move(right));
         }
 
+        //------------------------------------------------------------------------
+        //  function : quick_sort_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        quick_sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare comp, std::size_t chunk_size)
+        {
+            // check if already sorted
+            if (detail::is_sorted_sequential(first, last, comp))
+                return hpx::make_ready_future(last);
+
+            return execution::async_execute(policy.executor(),
+                &sort_thread<typename std::decay<ExPolicy>::type, RandomIt,
+                    Compare>,
+                std::forward<ExPolicy>(policy), first, last, comp, chunk_size);
+        }
+
+        //------------------------------------------------------------------------
+        //  function : sample_sort_async
+        //------------------------------------------------------------------------
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        sample_sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare comp, std::size_t, std::size_t num_buckets,
+            std::true_type)
+        {
+            return execution::async_execute(policy.executor(),
+                [=]() -> RandomIt
+                {
+                    return sample_sort(policy, first, last, comp,
+                        num_buckets);
+                });
+        }
+
+        // the value type does not support sorting in a temporary buffer
+        template <typename ExPolicy, typename RandomIt, typename Compare>
+        hpx::future<RandomIt>
+        sample_sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare comp, std::size_t chunk_size, std::size_t,
+            std::false_type)
+        {
+            return quick_sort_async(std::forward<ExPolicy>(policy), first,
+                last, std::move(comp), chunk_size);
+        }
+
         //------------------------------------------------------------------------
         //  function : parallel_sort_async
         //------------------------------------------------------------------------
@@ -217,14 +265,66 @@ namespace hpx { namespace parallel { inline namespace v1
                 return hpx::make_ready_future(last);
             }
 
-            // check if already sorted
-            if (detail::is_sorted_sequential(first, last, comp))
-                return hpx::make_ready_future(last);
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
 
-            return execution::async_execute(policy.executor(),
-                &sort_thread<typename std::decay<ExPolicy>::type, RandomIt,
-                    Compare>,
-                std::forward<ExPolicy>(policy), first, last, comp, chunk_size);
+            // large ranges are sorted using a sample sort, which does not
+            // perform any pass over the whole range on a single thread
+            if (count >= sample_sort_limit && cores > 1)
+            {
+                return sample_sort_async(std::forward<ExPolicy>(policy),
+                    first, last, std::move(comp), chunk_size,
+                    (std::min)(4 * cores, sample_sort_max_buckets),
+                    supports_sample_sort<value_type>());
+            }
+
+            return quick_sort_async(std::forward<ExPolicy>(policy), first,
+                last, std::move(comp), chunk_size);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // arithmetic keys compared using operator< are sorted by their digits
+        template <typename RandomIt, typename Compare, typename Proj>
+        RandomIt sequential_sort(RandomIt first, RandomIt last,
+            Compare &&, Proj && proj, std::true_type)
+        {
+            return radix_sort_sequential(first, last, proj);
+        }
+
+        template <typename RandomIt, typename Compare, typename Proj>
+        RandomIt sequential_sort(RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type)
+        {
+            std::sort(first, last,
+                util::compare_projected<Compare, Proj>(
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)
+                    ));
+            return last;
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<RandomIt>
+        sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare &&, Proj && proj, std::true_type)
+        {
+            return radix_sort_async(std::forward<ExPolicy>(policy), first,
+                last, std::forward<Proj>(proj));
+        }
+
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        hpx::future<RandomIt>
+        sort_async(ExPolicy && policy, RandomIt first, RandomIt last,
+            Compare && comp, Proj && proj, std::false_type)
+        {
+            return parallel_sort_async(std::forward<ExPolicy>(policy),
+                first, last,
+                util::compare_projected<Compare, Proj>(
+                    std::forward<Compare>(comp),
+                    std::forward<Proj>(proj)
+                ));
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -241,12 +341,13 @@ namespace hpx { namespace parallel { inline namespace v1
             sequential(ExPolicy, RandomIt first, RandomIt last,
                 Compare && comp, Proj && proj)
             {
-                std::sort(first, last,
-                    util::compare_projected<Compare, Proj>(
-                            std::forward<Compare>(comp),
-                            std::forward<Proj>(proj)
-                        ));
-                return last;
+                typedef typename use_radix_sort<
+                        RandomIt, Compare, Proj
+                    >::type use_radix_sort;
+
+                return sequential_sort(first, last,
+                    std::forward<Compare>(comp), std::forward<Proj>(proj),
+                    use_radix_sort());
             }
 
             template <typename ExPolicy, typename Compare, typename Proj>
@@ -259,17 +360,17 @@ namespace hpx { namespace parallel { inline namespace v1
                 typedef util::detail::algorithm_result<
                     ExPolicy, RandomIt
                 > algorithm_result;
+                typedef typename use_parallel_radix_sort<
+                        RandomIt, Compare, Proj
+                    >::type use_radix_sort;
 
                 try {
                     // call the sort routine and return the right type,
                     // depending on execution policy
                     return algorithm_result::get(
-                        parallel_sort_async(std::forward<ExPolicy>(policy),
-                            first, last,
-                            util::compare_projected<Compare, Proj>(
-                                std::forward<Compare>(comp),
-                                std::forward<Proj>(proj)
-                            )));
+                        sort_async(std::forward<ExPolicy>(policy),
+                            first, last, std::forward<Compare>(comp),
+                            std::forward<Proj>(proj), use_radix_sort()));
                 }
                 catch (...) {
                     return algorithm_result::get(
@@ -290,6 +391,10 @@ namespace hpx { namespace parallel { inline namespace v1
     /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
     ///                     comparisons.
     ///
+    /// If the projected values are arithmetic and \a comp is the default
+    /// comparison or std::less of the projected type, the elements are
+    /// sorted using a radix sort (see \a radix_sort) instead.
+    ///
     /// A sequence is sorted with respect to a comparator \a comp and a
     /// projection \a proj if for every iterator i pointing to the sequence and
     /// every non-negative integer n such that i + n is a valid iterator
@@ -0,0 +1,376 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/algorithms/stable_sort.hpp
+
+#if !defined(HPX_PARALLEL_ALGORITHMS_STABLE_SORT_HPP)
+#define HPX_PARALLEL_ALGORITHMS_STABLE_SORT_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_iterator.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/result_of.hpp>
+
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/detail/sample_sort.hpp>
+#include <hpx/parallel/algorithms/merge.hpp>
+#include <hpx/parallel/execution_policy.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
+#include <hpx/parallel/traits/projected.hpp>
+#include <hpx/parallel/util/compare_projected.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // stable_sort
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // the minimal number of elements sorted by a single task
+        static const std::size_t stable_sort_limit_per_task = 65536ul;
+
+        // The runs are merged through move iterators, the projection is
+        // always invoked on lvalues to avoid moving from the elements
+        // while comparing them.
+        template <typename Proj>
+        struct stable_sort_lvalue_projection
+        {
+            template <typename T>
+            typename hpx::util::invoke_result<
+                Proj const&, typename std::remove_reference<T>::type&
+            >::type
+            operator()(T && t) const
+            {
+                typename std::remove_reference<T>::type& value = t;
+                return hpx::util::invoke(proj_, value);
+            }
+
+            Proj const& proj_;
+        };
+
+        // Merge all pairs of adjacent runs from src to dst in parallel, the
+        // runs are given by their boundaries. A trailing run without a
+        // partner is moved as is.
+        template <typename ExPolicy, typename SrcIter, typename DstIter,
+            typename Compare, typename Proj>
+        std::vector<std::size_t> stable_sort_merge_runs(ExPolicy const& policy,
+            SrcIter src, DstIter dst, std::vector<std::size_t> const& runs,
+            Compare const& comp, Proj const& proj)
+        {
+            stable_sort_lvalue_projection<Proj> const lvalue_proj = { proj };
+
+            std::size_t const num_runs = runs.size() - 1;
+            std::size_t const num_pairs = (num_runs + 1) / 2;
+
+            sample_sort_for_each(policy, num_pairs,
+                [&](std::size_t pair)
+                {
+                    std::size_t const begin = runs[2 * pair];
+                    std::size_t const middle = runs[2 * pair + 1];
+
+                    if (2 * pair + 1 == num_runs)
+                    {
+                        std::move(src + begin, src + middle, dst + begin);
+                        return;
+                    }
+
+                    std::size_t const end = runs[2 * pair + 2];
+                    parallel_merge_helper(policy,
+                        std::make_move_iterator(src + begin),
+                        std::make_move_iterator(src + middle),
+                        std::make_move_iterator(src + middle),
+                        std::make_move_iterator(src + end),
+                        dst + begin, comp, lvalue_proj, lvalue_proj, false,
+                        lower_bound_helper());
+                });
+
+            std::vector<std::size_t> merged;
+            merged.reserve(num_pairs + 1);
+            for (std::size_t i = 0; i < runs.size(); i += 2)
+                merged.push_back(runs[i]);
+            if (merged.back() != runs.back())
+                merged.push_back(runs.back());
+            return merged;
+        }
+
+        // Parallel merge sort: the chunks of the range are sorted using
+        // std::stable_sort in parallel. The sorted runs are merged pairwise
+        // in rounds, alternating between the range and a temporary buffer.
+        // Every merge is split into independent parts by binary searches
+        // (see parallel_merge_helper), which keeps all cores busy during
+        // the last rounds as well.
+        template <typename ExPolicy, typename RandomIt, typename Compare,
+            typename Proj>
+        RandomIt parallel_stable_sort(ExPolicy const& policy, RandomIt first,
+            RandomIt last, Compare const& comp, Proj const& proj)
+        {
+            typedef typename std::iterator_traits<RandomIt>::value_type
+                value_type;
+
+            std::size_t const count = std::size_t(last - first);
+            std::size_t const cores = execution::processing_units_count(
+                policy.executor(), policy.parameters());
+
+            std::size_t const num_chunks = (std::min)(cores,
+                count / stable_sort_limit_per_task);
+
+            util::compare_projected<Compare const&, Proj const&> const
+                compare(comp, proj);
+
+            if (num_chunks < 2)
+            {
+                std::stable_sort(first, last, compare);
+                return last;
+            }
+
+            std::vector<std::size_t> runs(num_chunks + 1);
+            for (std::size_t chunk = 0; chunk <= num_chunks; ++chunk)
+                runs[chunk] = chunk * count / num_chunks;
+
+            sample_sort_for_each(policy, num_chunks,
+                [&](std::size_t chunk)
+                {
+                    std::stable_sort(first + runs[chunk],
+                        first + runs[chunk + 1], compare);
+                });
+
+            // the buffer is initialized by moving the elements, which allows
+            // to merge by move assignments in both directions
+            sample_sort_buffer<value_type> buffer(count);
+            value_type* data = buffer.data_;
+
+            sample_sort_for_each(policy, num_chunks,
+                [&](std::size_t chunk)
+                {
+                    for (std::size_t i = runs[chunk]; i != runs[chunk + 1];
+                         ++i)
+                    {
+                        ::new (data + i) value_type(std::move(first[i]));
+                    }
+                });
+
+            sample_sort_bucket_guard<value_type> guard = {
+                data, data + count };
+
+            bool in_buffer = true;
+            while (runs.size() > 2)
+            {
+                if (in_buffer)
+                {
+                    runs = stable_sort_merge_runs(policy, data, first, runs,
+                        comp, proj);
+                }
+                else
+                {
+                    runs = stable_sort_merge_runs(policy, first, data, runs,
+                        comp, proj);
+                }
+                in_buffer = !in_buffer;
+            }
+
+            if (in_buffer)
+            {
+                sample_sort_for_each(policy, num_chunks,
+                    [&](std::size_t chunk)
+                    {
+                        std::size_t const begin = chunk * count / num_chunks;
+                        std::size_t const end =
+                            (chunk + 1) * count / num_chunks;
+                        std::move(data + begin, data + end, first + begin);
+                    });
+            }
+
+            return last;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename RandomIt>
+        struct stable_sort
+          : public detail::algorithm<stable_sort<RandomIt>, RandomIt>
+        {
+            stable_sort()
+              : stable_sort::algorithm("stable_sort")
+            {}
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static RandomIt
+            sequential(ExPolicy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                std::stable_sort(first, last,
+                    util::compare_projected<Compare, Proj>(
+                            std::forward<Compare>(comp),
+                            std::forward<Proj>(proj)
+                        ));
+                return last;
+            }
+
+            template <typename ExPolicy, typename Compare, typename Proj>
+            static typename util::detail::algorithm_result<
+                ExPolicy, RandomIt
+            >::type
+            parallel(ExPolicy && policy, RandomIt first, RandomIt last,
+                Compare && comp, Proj && proj)
+            {
+                typedef util::detail::algorithm_result<
+                    ExPolicy, RandomIt
+                > algorithm_result;
+                typedef typename std::iterator_traits<RandomIt>::value_type
+                    value_type;
+                typedef typename hpx::util::decay<Compare>::type compare_type;
+                typedef typename hpx::util::decay<Proj>::type proj_type;
+
+                // the value type does not support merging through a
+                // temporary buffer
+                if (!supports_sort_buffer<value_type>::value)
+                {
+                    return algorithm_result::get(sequential(
+                        std::forward<ExPolicy>(policy), first, last,
+                        std::forward<Compare>(comp),
+                        std::forward<Proj>(proj)));
+                }
+
+                try {
+                    compare_type c(std::forward<Compare>(comp));
+                    proj_type p(std::forward<Proj>(proj));
+
+                    return algorithm_result::get(execution::async_execute(
+                        policy.executor(),
+                        [=]() -> RandomIt
+                        {
+                            return parallel_stable_sort(policy, first, last,
+                                c, p);
+                        }));
+                }
+                catch (...) {
+                    return algorithm_result::get(
+                        detail::handle_exception<ExPolicy, RandomIt>::call(
+                            std::current_exception()));
+                }
+            }
+        };
+        /// \endcond
+    }
+
+    //-----------------------------------------------------------------------------
+    /// Sorts the elements in the range [first, last) in ascending order. The
+    /// order of equal elements is guaranteed to be preserved. The function
+    /// uses the given comparison function object comp (defaults to using
+    /// operator<()).
+    ///
+    /// \note   Complexity: O(Nlog(N)), where N = std::distance(first, last)
+    ///                     comparisons.
+    ///
+    /// The parallel versions sort chunks of the range independently and
+    /// merge the sorted chunks in parallel through a temporary buffer of
+    /// the size of the input sequence, which requires the value type to be
+    /// nothrow move constructible. Otherwise the elements are sorted
+    /// sequentially.
+    ///
+    /// A sequence is sorted with respect to a comparator \a comp and a
+    /// projection \a proj if for every iterator i pointing to the sequence and
+    /// every non-negative integer n such that i + n is a valid iterator
+    /// pointing to an element of the sequence, and
+    /// INVOKE(comp, INVOKE(proj, *(i + n)), INVOKE(proj, *i)) == false.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it applies user-provided function objects.
+    /// \tparam RandomIt    The type of the source iterators used (deduced).
+    ///                     This iterator type must meet the requirements of a
+    ///                     random access iterator.
+    /// \tparam Comp        The type of the function/function object to use
+    ///                     (deduced).
+    /// \tparam Proj        The type of an optional projection function. This
+    ///                     defaults to \a util::projection_identity
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param first        Refers to the beginning of the sequence of elements
+    ///                     the algorithm will be applied to.
+    /// \param last         Refers to the end of the sequence of elements the
+    ///                     algorithm will be applied to.
+    /// \param comp         comp is a callable object. The return value of the
+    ///                     INVOKE operation applied to an object of type Comp,
+    ///                     when contextually converted to bool, yields true if
+    ///                     the first argument of the call is less than the
+    ///                     second, and false otherwise. It is assumed that comp
+    ///                     will not apply any non-constant function through the
+    ///                     dereferenced iterator.
+    /// \param proj         Specifies the function (or function object) which
+    ///                     will be invoked for each pair of elements as a
+    ///                     projection operation before the actual predicate
+    ///                     \a comp is invoked.
+    ///
+    /// \a comp has to induce a strict weak ordering on the values.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a sequenced_policy execute in sequential order in the
+    /// calling thread.
+    ///
+    /// The application of function objects in parallel algorithm
+    /// invoked with an execution policy object of type
+    /// \a parallel_policy or \a parallel_task_policy are
+    /// permitted to execute in an unordered fashion in unspecified
+    /// threads, and indeterminately sequenced within each thread.
+    ///
+    /// \returns  The \a stable_sort algorithm returns a
+    ///           \a hpx::future<RandomIt> if the execution policy is of
+    ///           type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a RandomIt
+    ///           otherwise.
+    ///           The algorithm returns an iterator pointing to the first
+    ///           element after the last element in the input sequence.
+    //-----------------------------------------------------------------------------
+    template <typename ExPolicy, typename RandomIt,
+        typename Proj = util::projection_identity,
+        typename Compare = detail::less,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_iterator<RandomIt>::value &&
+        traits::is_projected<Proj, RandomIt>::value &&
+        traits::is_indirect_callable<
+            ExPolicy, Compare,
+                traits::projected<Proj, RandomIt>,
+                traits::projected<Proj, RandomIt>
+        >::value)>
+    typename util::detail::algorithm_result<ExPolicy, RandomIt>::type
+    stable_sort(ExPolicy && policy, RandomIt first, RandomIt last,
+        Compare && comp = Compare(), Proj && proj = Proj())
+    {
+        static_assert(
+            (hpx::traits::is_random_access_iterator<RandomIt>::value),
+            "Requires a random access iterator.");
+
+        typedef execution::is_sequenced_execution_policy<ExPolicy> is_seq;
+
+        return detail::stable_sort<RandomIt>().call(
+            std::forward<ExPolicy>(policy), is_seq(), first, last,
+            std::forward<Compare>(comp), std::forward<Proj>(proj));
+    }
+}}}
+
+#endif
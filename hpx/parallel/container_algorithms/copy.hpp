@@ -12,12 +12,16 @@
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_iterator.hpp>
 #include <hpx/traits/is_range.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/range.hpp>
 #include <hpx/util/tagged_pair.hpp>
 
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/traits/projected.hpp>
 #include <hpx/parallel/traits/projected_range.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/view.hpp>
 
 #include <type_traits>
 #include <utility>
@@ -72,6 +76,7 @@ namespace hpx { namespace parallel { inline namespace v1
     HPX_CONCEPT_REQUIRES_(
         execution::is_execution_policy<ExPolicy>::value &&
         hpx::traits::is_range<Rng>::value &&
+        !view::is_filtered_range<Rng>::value &&
         hpx::traits::is_iterator<OutIter>::value)>
     typename util::detail::algorithm_result<
         ExPolicy,
@@ -163,6 +168,7 @@ namespace hpx { namespace parallel { inline namespace v1
     HPX_CONCEPT_REQUIRES_(
         execution::is_execution_policy<ExPolicy>::value &&
         hpx::traits::is_range<Rng>::value &&
+        !view::is_filtered_range<Rng>::value &&
         traits::is_projected_range<Proj, Rng>::value &&
         hpx::traits::is_iterator<OutIter>::value &&
         traits::is_indirect_callable<
@@ -182,6 +188,62 @@ namespace hpx { namespace parallel { inline namespace v1
             hpx::util::begin(rng), hpx::util::end(rng), dest, std::forward<F>(f),
             std::forward<Proj>(proj));
     }
+
+    /// \cond NOINTERNAL
+    // Copying (some of) the elements of a filtered range is performed as a
+    // single copy_if over the underlying range.
+    template <typename ExPolicy, typename Rng, typename OutIter,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        view::is_filtered_range<Rng>::value &&
+        hpx::traits::is_iterator<OutIter>::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy,
+        hpx::util::tagged_pair<
+            tag::in(typename hpx::traits::range_traits<Rng>::iterator_type),
+            tag::out(OutIter)
+        >
+    >::type
+    copy(ExPolicy && policy, Rng && rng, OutIter dest)
+    {
+        typedef typename hpx::util::decay<Rng>::type range_type;
+
+        return util::detail::convert_to_result(
+            copy_if(std::forward<ExPolicy>(policy),
+                rng.base_begin(), rng.base_end(), dest, rng.predicate()),
+            view::detail::filtered_iterator_conv<range_type>{rng});
+    }
+
+    template <typename ExPolicy, typename Rng, typename OutIter, typename F,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        view::is_filtered_range<Rng>::value &&
+        hpx::traits::is_iterator<OutIter>::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy,
+        hpx::util::tagged_pair<
+            tag::in(typename hpx::traits::range_traits<Rng>::iterator_type),
+            tag::out(OutIter)
+        >
+    >::type
+    copy_if(ExPolicy && policy, Rng && rng, OutIter dest, F && f,
+        Proj && proj = Proj())
+    {
+        typedef typename hpx::util::decay<Rng>::type range_type;
+        typedef view::detail::filtered_predicate<
+                typename range_type::predicate_type,
+                typename hpx::util::decay<F>::type,
+                typename hpx::util::decay<Proj>::type
+            > predicate_type;
+
+        return util::detail::convert_to_result(
+            copy_if(std::forward<ExPolicy>(policy),
+                rng.base_begin(), rng.base_end(), dest,
+                predicate_type{rng.predicate(), std::forward<F>(f),
+                    std::forward<Proj>(proj)}),
+            view::detail::filtered_iterator_conv<range_type>{rng});
+    }
     /// \endcond
 }}}
 
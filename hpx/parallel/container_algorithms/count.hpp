@@ -11,11 +11,14 @@
 #include <hpx/config.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_range.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/range.hpp>
 
 #include <hpx/parallel/algorithms/count.hpp>
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
 #include <hpx/parallel/traits/projected_range.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/view.hpp>
 
 #include <type_traits>
 #include <utility>
@@ -77,7 +80,8 @@ namespace hpx { namespace parallel { inline namespace v1
     HPX_CONCEPT_REQUIRES_(
         execution::is_execution_policy<ExPolicy>::value &&
         traits::is_projected_range<Proj, Rng>::value &&
-        hpx::traits::is_range<Rng>::value)>
+        hpx::traits::is_range<Rng>::value &&
+        !view::is_filtered_range<Rng>::value)>
     typename util::detail::algorithm_result<
         ExPolicy, typename std::iterator_traits<
         typename hpx::traits::range_traits<Rng>::iterator_type
@@ -158,6 +162,7 @@ namespace hpx { namespace parallel { inline namespace v1
     HPX_CONCEPT_REQUIRES_(
         execution::is_execution_policy<ExPolicy>::value &&
         hpx::traits::is_range<Rng>::value &&
+        !view::is_filtered_range<Rng>::value &&
         traits::is_projected_range<Proj, Rng>::value &&
         traits::is_indirect_callable<
             ExPolicy, F, traits::projected_range<Proj, Rng>
@@ -173,6 +178,61 @@ namespace hpx { namespace parallel { inline namespace v1
         return count_if(policy, hpx::util::begin(rng), hpx::util::end(rng),
             std::forward<F>(f), std::forward<Proj>(proj));
     }
+
+    /// \cond NOINTERNAL
+    // Counting the elements of a filtered range is performed as a single
+    // count_if over the underlying range.
+    template <typename ExPolicy, typename Rng, typename T,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        view::is_filtered_range<Rng>::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy, typename std::iterator_traits<
+        typename hpx::traits::range_traits<Rng>::iterator_type
+        >::difference_type
+    >::type
+    count(ExPolicy && policy, Rng && rng, T const& value,
+        Proj && proj = Proj())
+    {
+        typedef typename hpx::util::decay<Rng>::type range_type;
+        typedef view::detail::filtered_predicate<
+                typename range_type::predicate_type, detail::compare_to<T>,
+                typename hpx::util::decay<Proj>::type
+            > predicate_type;
+
+        return count_if(std::forward<ExPolicy>(policy),
+            rng.base_begin(), rng.base_end(),
+            predicate_type{rng.predicate(), detail::compare_to<T>(value),
+                std::forward<Proj>(proj)});
+    }
+
+    template <typename ExPolicy, typename Rng, typename F,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        view::is_filtered_range<Rng>::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy, typename std::iterator_traits<
+        typename hpx::traits::range_traits<Rng>::iterator_type
+        >::difference_type
+    >::type
+    count_if(ExPolicy && policy, Rng && rng, F && f,
+        Proj && proj = Proj())
+    {
+        typedef typename hpx::util::decay<Rng>::type range_type;
+        typedef view::detail::filtered_predicate<
+                typename range_type::predicate_type,
+                typename hpx::util::decay<F>::type,
+                typename hpx::util::decay<Proj>::type
+            > predicate_type;
+
+        return count_if(std::forward<ExPolicy>(policy),
+            rng.base_begin(), rng.base_end(),
+            predicate_type{rng.predicate(), std::forward<F>(f),
+                std::forward<Proj>(proj)});
+    }
+    /// \endcond
 }}}
 
 #endif
@@ -11,11 +11,14 @@
 #include <hpx/config.hpp>
 #include <hpx/traits/concepts.hpp>
 #include <hpx/traits/is_range.hpp>
+#include <hpx/util/decay.hpp>
 #include <hpx/util/range.hpp>
 
 #include <hpx/parallel/algorithms/for_each.hpp>
 #include <hpx/parallel/traits/projected_range.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/projection_identity.hpp>
+#include <hpx/parallel/view.hpp>
 
 #include <type_traits>
 #include <utility>
@@ -97,6 +100,7 @@ namespace hpx { namespace parallel { inline namespace v1
     HPX_CONCEPT_REQUIRES_(
         execution::is_execution_policy<ExPolicy>::value &&
         hpx::traits::is_range<Rng>::value &&
+        !view::is_filtered_range<Rng>::value &&
         traits::is_projected_range<Proj, Rng>::value &&
         traits::is_indirect_callable<
             ExPolicy, F, traits::projected_range<Proj, Rng>
@@ -110,6 +114,35 @@ namespace hpx { namespace parallel { inline namespace v1
             hpx::util::begin(rng), hpx::util::end(rng), std::forward<F>(f),
             std::forward<Proj>(proj));
     }
+
+    /// \cond NOINTERNAL
+    // A filtered range is processed by partitioning the underlying range,
+    // the filter is applied to the elements while iterating.
+    template <typename ExPolicy, typename Rng, typename F,
+        typename Proj = util::projection_identity,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        view::is_filtered_range<Rng>::value)>
+    typename util::detail::algorithm_result<
+        ExPolicy, typename hpx::traits::range_iterator<Rng>::type
+    >::type
+    for_each(ExPolicy && policy, Rng && rng, F && f, Proj && proj = Proj())
+    {
+        typedef typename hpx::util::decay<Rng>::type range_type;
+        typedef view::detail::filtered_function<
+                typename range_type::predicate_type,
+                typename hpx::util::decay<F>::type,
+                typename hpx::util::decay<Proj>::type
+            > function_type;
+
+        return util::detail::convert_to_result(
+            for_each(std::forward<ExPolicy>(policy),
+                rng.base_begin(), rng.base_end(),
+                function_type{rng.predicate(), std::forward<F>(f),
+                    std::forward<Proj>(proj)}),
+            view::detail::filtered_iterator_conv<range_type>{rng});
+    }
+    /// \endcond
 }}}
 
 #endif
@@ -0,0 +1,215 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/container_algorithms/reduce.hpp
+
+#if !defined(HPX_PARALLEL_CONTAINER_ALGORITHMS_REDUCE_HPP)
+#define HPX_PARALLEL_CONTAINER_ALGORITHMS_REDUCE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/concepts.hpp>
+#include <hpx/traits/is_range.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/optional.hpp>
+#include <hpx/util/range.hpp>
+
+#include <hpx/parallel/algorithms/detail/predicates.hpp>
+#include <hpx/parallel/algorithms/reduce.hpp>
+#include <hpx/parallel/algorithms/transform_reduce.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/view.hpp>
+
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace hpx { namespace parallel { inline namespace v1
+{
+    /// Returns GENERALIZED_SUM(f, init, *first, ..., *(first + (last - first) - 1))
+    /// for the elements of the range \a rng.
+    ///
+    /// \note   Complexity: O(N) applications of the predicate \a f, where N is
+    ///         the number of elements in \a rng.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced).
+    /// \tparam F           The type of the function/function object to use
+    ///                     (deduced). Unlike its sequential form, the parallel
+    ///                     overload of \a reduce requires \a F to meet the
+    ///                     requirements of \a CopyConstructible.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param init         The initial value for the generalized sum.
+    /// \param f            Specifies the function (or function object) which
+    ///                     will be invoked for each of the elements in the
+    ///                     sequence. This is a binary predicate.
+    ///
+    /// The reduce operations in the parallel \a reduce algorithm invoked
+    /// with an execution policy object of type \a sequenced_policy
+    /// execute in sequential order in the calling thread.
+    ///
+    /// The reduce operations in the parallel \a reduce algorithm invoked
+    /// with an execution policy object of type \a parallel_policy
+    /// or \a parallel_task_policy are permitted to execute in an unordered
+    /// fashion in unspecified threads, and indeterminately sequenced
+    /// within each thread.
+    ///
+    /// \returns  The \a reduce algorithm returns a \a hpx::future<T> if the
+    ///           execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a T otherwise.
+    ///           The \a reduce algorithm returns the result of the
+    ///           generalized sum over the elements of \a rng.
+    ///
+    /// \note   If \a rng is a view created by \a view::filter, the algorithm
+    ///         is applied to the underlying range and the elements which
+    ///         don't pass the filter are skipped while reducing, no
+    ///         intermediate sequence is created.
+    ///
+    template <typename ExPolicy, typename Rng, typename T, typename F,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_range<Rng>::value &&
+        !view::is_filtered_range<Rng>::value)>
+    typename util::detail::algorithm_result<ExPolicy, T>::type
+    reduce(ExPolicy && policy, Rng && rng, T init, F && f)
+    {
+        return reduce(std::forward<ExPolicy>(policy), hpx::util::begin(rng),
+            hpx::util::end(rng), std::move(init), std::forward<F>(f));
+    }
+
+    /// \cond NOINTERNAL
+    // Reducing a filtered range is performed as a single transform_reduce
+    // over the underlying range, the elements which don't pass the filter are
+    // mapped to empty values which are ignored by the reduction.
+    template <typename ExPolicy, typename Rng, typename T, typename F,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        view::is_filtered_range<Rng>::value)>
+    typename util::detail::algorithm_result<ExPolicy, T>::type
+    reduce(ExPolicy && policy, Rng && rng, T init, F && f)
+    {
+        typedef typename hpx::util::decay<Rng>::type range_type;
+        typedef view::detail::filtered_value<
+                typename range_type::predicate_type, T
+            > convert_type;
+        typedef view::detail::filtered_reduction<
+                typename hpx::util::decay<F>::type, T
+            > reduce_type;
+
+        return util::detail::convert_to_result(
+            transform_reduce(std::forward<ExPolicy>(policy),
+                rng.base_begin(), rng.base_end(),
+                hpx::util::optional<T>(std::move(init)),
+                reduce_type{std::forward<F>(f)},
+                convert_type{rng.predicate()}),
+            view::detail::filtered_reduction_result<T>());
+    }
+    /// \endcond
+
+    /// Returns GENERALIZED_SUM(+, init, *first, ..., *(first + (last - first) - 1))
+    /// for the elements of the range \a rng.
+    ///
+    /// \note   Complexity: O(N) applications of the operator+(), where N is
+    ///         the number of elements in \a rng.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    /// \tparam T           The type of the value to be used as initial (and
+    ///                     intermediate) values (deduced).
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    /// \param init         The initial value for the generalized sum.
+    ///
+    /// \returns  The \a reduce algorithm returns a \a hpx::future<T> if the
+    ///           execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns \a T otherwise.
+    ///           The \a reduce algorithm returns the result of the
+    ///           generalized sum (applying operator+()) over the elements of
+    ///           \a rng.
+    ///
+    template <typename ExPolicy, typename Rng, typename T,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_range<Rng>::value)>
+    typename util::detail::algorithm_result<ExPolicy, T>::type
+    reduce(ExPolicy && policy, Rng && rng, T init)
+    {
+        return reduce(std::forward<ExPolicy>(policy), std::forward<Rng>(rng),
+            std::move(init), std::plus<T>());
+    }
+
+    /// Returns GENERALIZED_SUM(+, T(), *first, ..., *(first + (last - first) - 1))
+    /// for the elements of the range \a rng.
+    ///
+    /// \note   Complexity: O(N) applications of the operator+(), where N is
+    ///         the number of elements in \a rng.
+    ///
+    /// \tparam ExPolicy    The type of the execution policy to use (deduced).
+    ///                     It describes the manner in which the execution
+    ///                     of the algorithm may be parallelized and the manner
+    ///                     in which it executes the assignments.
+    /// \tparam Rng         The type of the source range used (deduced).
+    ///                     The iterators extracted from this range type must
+    ///                     meet the requirements of a forward iterator.
+    ///
+    /// \param policy       The execution policy to use for the scheduling of
+    ///                     the iterations.
+    /// \param rng          Refers to the sequence of elements the algorithm
+    ///                     will be applied to.
+    ///
+    /// \returns  The \a reduce algorithm returns a \a hpx::future<T> if the
+    ///           execution policy is of type
+    ///           \a sequenced_task_policy or
+    ///           \a parallel_task_policy and
+    ///           returns T otherwise (where T is the value_type of the
+    ///           iterators of \a rng).
+    ///           The \a reduce algorithm returns the result of the
+    ///           generalized sum (applying operator+()) over the elements of
+    ///           \a rng.
+    ///
+    template <typename ExPolicy, typename Rng,
+    HPX_CONCEPT_REQUIRES_(
+        execution::is_execution_policy<ExPolicy>::value &&
+        hpx::traits::is_range<Rng>::value)>
+    typename util::detail::algorithm_result<ExPolicy,
+        typename std::iterator_traits<
+            typename hpx::traits::range_traits<Rng>::iterator_type
+        >::value_type
+    >::type
+    reduce(ExPolicy && policy, Rng && rng)
+    {
+        typedef typename std::iterator_traits<
+                typename hpx::traits::range_traits<Rng>::iterator_type
+            >::value_type value_type;
+
+        return reduce(std::forward<ExPolicy>(policy), std::forward<Rng>(rng),
+            value_type(), detail::plus());
+    }
+}}}
+
+#endif
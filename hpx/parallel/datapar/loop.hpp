@@ -13,15 +13,20 @@
 #include <hpx/parallel/datapar/execution_policy_fwd.hpp>
 #include <hpx/parallel/datapar/iterator_helpers.hpp>
 #include <hpx/parallel/traits/vector_pack_alignment_size.hpp>
+#include <hpx/parallel/traits/vector_pack_find.hpp>
 #include <hpx/parallel/traits/vector_pack_load_store.hpp>
 #include <hpx/parallel/traits/vector_pack_type.hpp>
+#include <hpx/parallel/util/cancellation_token.hpp>
 #include <hpx/parallel/util/loop.hpp>
 #include <hpx/traits/is_execution_policy.hpp>
+#include <hpx/util/always_void.hpp>
 #include <hpx/util/decay.hpp>
+#include <hpx/util/invoke.hpp>
 
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -133,7 +138,7 @@ namespace hpx { namespace parallel { namespace util
             >::type
             call(Begin first, End last, F && f)
             {
-                while (is_data_aligned(first) && first != last)
+                while (first != last && is_data_aligned(first))
                 {
                     datapar_loop_step<Begin>::call1(f, first);
                 }
@@ -141,10 +146,16 @@ namespace hpx { namespace parallel { namespace util
                 static std::size_t HPX_CONSTEXPR_OR_CONST size =
                     traits::vector_pack_size<V>::value;
 
-                End const lastV = last - (size + 1);
-                while (first < lastV)
+                // the range may be shorter than a vector pack
+                std::ptrdiff_t const lenV =
+                    std::distance(first, last) - std::ptrdiff_t(size + 1);
+                if (lenV > 0)
                 {
-                    datapar_loop_step<Begin>::callv(f, first);
+                    End const lastV = first + lenV;
+                    while (first < lastV)
+                    {
+                        datapar_loop_step<Begin>::callv(f, first);
+                    }
                 }
 
                 while (first != last)
@@ -203,10 +214,15 @@ namespace hpx { namespace parallel { namespace util
                 static std::size_t HPX_CONSTEXPR_OR_CONST size =
                     traits::vector_pack_size<V>::value;
 
-                InIter1 const last1V = last1 - (size + 1);
-                while (it1 < last1V)
+                std::ptrdiff_t const len1V =
+                    std::distance(it1, last1) - std::ptrdiff_t(size + 1);
+                if (len1V > 0)
                 {
-                    datapar_loop_step2<InIter1, InIter2>::callv(f, it1, it2);
+                    InIter1 const last1V = it1 + len1V;
+                    while (it1 < last1V)
+                    {
+                        datapar_loop_step2<InIter1, InIter2>::callv(f, it1, it2);
+                    }
                 }
 
                 return std::make_pair(std::move(it1), std::move(it2));
@@ -261,7 +277,7 @@ namespace hpx { namespace parallel { namespace util
             {
                 std::size_t len = count;
 
-                for (/* */; detail::is_data_aligned(first) && len != 0; --len)
+                for (/* */; len != 0 && detail::is_data_aligned(first); --len)
                 {
                     datapar_loop_step<InIter>::call1(f, first);
                 }
@@ -269,7 +285,7 @@ namespace hpx { namespace parallel { namespace util
                 static std::size_t HPX_CONSTEXPR_OR_CONST size =
                     traits::vector_pack_size<V>::value;
 
-                for (std::int64_t lenV = std::int64_t(count - (size + 1));
+                for (std::int64_t lenV = std::int64_t(len) - std::int64_t(size + 1);
                         lenV > 0; lenV -= size, len -= size)
                 {
                     datapar_loop_step<InIter>::callv(f, first);
@@ -297,6 +313,321 @@ namespace hpx { namespace parallel { namespace util
                 return first;
             }
         };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Load a vector pack, the iterators of a zip_iterator might never be
+        // aligned at the same time.
+        template <typename V, typename Iter>
+        HPX_HOST_DEVICE HPX_FORCEINLINE
+        V datapar_load(Iter const& it, bool aligned)
+        {
+            typedef typename std::iterator_traits<Iter>::value_type value_type;
+            return aligned ?
+                V(traits::vector_pack_load<V, value_type>::aligned(it)) :
+                V(traits::vector_pack_load<V, value_type>::unaligned(it));
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // A predicate is vectorizable if it returns a mask for vector packs.
+        template <typename F, typename V, typename Enable = void>
+        struct is_vectorizable_predicate
+          : std::false_type
+        {};
+
+        template <typename F, typename V>
+        struct is_vectorizable_predicate<F, V,
+            typename hpx::util::always_void<
+                decltype(traits::find_first_of(hpx::util::invoke(
+                    std::declval<F&>(), std::declval<V const&>())))
+            >::type>
+          : std::true_type
+        {};
+
+        // A search can be vectorized if the predicate can be applied to
+        // vector packs of any size.
+        template <typename Iter, typename F, typename Enable = void>
+        struct is_vectorizable_search
+          : std::false_type
+        {};
+
+        template <typename Iter, typename F>
+        struct is_vectorizable_search<Iter, F,
+            typename std::enable_if<
+                iterator_datapar_compatible<Iter>::value
+            >::type>
+          : std::integral_constant<bool,
+                is_vectorizable_predicate<F,
+                    typename traits::vector_pack_type<
+                        typename std::iterator_traits<Iter>::value_type, 1
+                    >::type
+                >::value &&
+                is_vectorizable_predicate<F,
+                    typename traits::vector_pack_type<
+                        typename std::iterator_traits<Iter>::value_type
+                    >::type
+                >::value>
+        {};
+
+        template <typename Iterator>
+        struct find_first_n;
+
+        // Helper class to find the first element for which a predicate
+        // returns true. The predicate is applied to whole vector packs, the
+        // search stops at the first pack containing a match.
+        template <typename Iterator>
+        struct datapar_find_first_n
+        {
+            template <typename InIter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static bool call1(std::size_t base_idx, InIter const& it,
+                CancelToken& tok, F && f)
+            {
+                typedef typename std::iterator_traits<InIter>::value_type
+                    value_type;
+                typedef typename traits::vector_pack_type<value_type, 1>::type
+                    V1;
+
+                V1 tmp(traits::vector_pack_load<V1, value_type>::unaligned(it));
+                if (traits::find_first_of(hpx::util::invoke(f, tmp)) != -1)
+                {
+                    tok.cancel(base_idx);
+                    return true;
+                }
+                return false;
+            }
+
+            template <typename InIter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static typename std::enable_if<
+                is_vectorizable_search<InIter, F>::value, InIter
+            >::type
+            call(std::size_t base_idx, InIter first, std::size_t count,
+                CancelToken& tok, F && f)
+            {
+                typedef typename std::iterator_traits<InIter>::value_type
+                    value_type;
+                typedef typename traits::vector_pack_type<value_type>::type V;
+
+                static std::size_t HPX_CONSTEXPR_OR_CONST size =
+                    traits::vector_pack_size<V>::value;
+
+                std::size_t len = count;
+
+                // handle the elements up to the first aligned position
+                // one by one
+                for (std::size_t i = 0;
+                     i != size && len != 0 && detail::is_data_aligned(first);
+                     (void) ++i, --len, ++first, ++base_idx)
+                {
+                    if (tok.was_cancelled(base_idx) ||
+                        call1(base_idx, first, tok, f))
+                    {
+                        return first;
+                    }
+                }
+
+                if (len >= size)
+                {
+                    bool const aligned = !detail::is_data_aligned(first);
+                    for (/* */; len >= size; len -= size, base_idx += size)
+                    {
+                        if (tok.was_cancelled(base_idx))
+                            return first;
+
+                        V tmp(datapar_load<V>(first, aligned));
+                        int const offset =
+                            traits::find_first_of(hpx::util::invoke(f, tmp));
+                        if (offset != -1)
+                        {
+                            tok.cancel(base_idx + offset);
+                            return first + offset;
+                        }
+
+                        std::advance(first, size);
+                    }
+                }
+
+                for (/* */; len != 0; (void) --len, ++first, ++base_idx)
+                {
+                    if (tok.was_cancelled(base_idx) ||
+                        call1(base_idx, first, tok, f))
+                    {
+                        return first;
+                    }
+                }
+                return first;
+            }
+
+            // fall back to the scalar search if the predicate can't be applied
+            // to vector packs
+            template <typename InIter, typename CancelToken, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static typename std::enable_if<
+                !is_vectorizable_search<InIter, F>::value, InIter
+            >::type
+            call(std::size_t base_idx, InIter first, std::size_t count,
+                CancelToken& tok, F && f)
+            {
+                return util::detail::find_first_n<InIter>::call(
+                    base_idx, first, count, tok, std::forward<F>(f));
+            }
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // A reduction is vectorizable if it combines two vector packs into
+        // a vector pack.
+        template <typename F, typename V, typename Enable = void>
+        struct is_vectorizable_reduction
+          : std::false_type
+        {};
+
+        template <typename F, typename V>
+        struct is_vectorizable_reduction<F, V,
+            typename std::enable_if<
+                std::is_convertible<
+                    decltype(hpx::util::invoke(std::declval<F&>(),
+                        std::declval<V const&>(), std::declval<V const&>())),
+                    V
+                >::value
+            >::type>
+          : std::true_type
+        {};
+
+        // The function objects of the standard library are bound to the
+        // type of their arguments, the packs are combined by the equivalent
+        // generic function objects instead.
+        template <typename F>
+        struct datapar_reduction
+        {
+            typedef F type;
+
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static F& get(F& f)
+            {
+                return f;
+            }
+        };
+
+        template <typename T>
+        struct datapar_reduction<std::plus<T> >
+        {
+            typedef parallel::v1::detail::plus type;
+
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static type get(std::plus<T> const&)
+            {
+                return type();
+            }
+        };
+
+        template <typename T>
+        struct datapar_reduction<std::multiplies<T> >
+        {
+            typedef parallel::v1::detail::multiplies type;
+
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static type get(std::multiplies<T> const&)
+            {
+                return type();
+            }
+        };
+
+        template <typename Iter, typename F, typename Enable = void>
+        struct is_vectorizable_reduce
+          : std::false_type
+        {};
+
+        template <typename Iter, typename F>
+        struct is_vectorizable_reduce<Iter, F,
+            typename std::enable_if<
+                iterator_datapar_compatible<Iter>::value
+            >::type>
+          : is_vectorizable_reduction<
+                typename datapar_reduction<
+                    typename hpx::util::decay<F>::type
+                >::type,
+                typename traits::vector_pack_type<
+                    typename std::iterator_traits<Iter>::value_type
+                >::type>
+        {};
+
+        // Helper class to reduce a sequence. The elements are combined
+        // pack-wise first, the lanes of the result are reduced at the end.
+        template <typename Iterator>
+        struct datapar_reduce_n
+        {
+            template <typename InIter, typename T, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static typename std::enable_if<
+                is_vectorizable_reduce<InIter, F>::value, T
+            >::type
+            call(InIter first, std::size_t count, T init, F && f)
+            {
+                typedef typename std::iterator_traits<InIter>::value_type
+                    value_type;
+                typedef typename traits::vector_pack_type<value_type>::type V;
+
+                static std::size_t HPX_CONSTEXPR_OR_CONST size =
+                    traits::vector_pack_size<V>::value;
+
+                std::size_t len = count;
+
+                // handle the elements up to the first aligned position
+                // one by one
+                for (std::size_t i = 0;
+                     i != size && len != 0 && detail::is_data_aligned(first);
+                     (void) ++i, --len, ++first)
+                {
+                    init = hpx::util::invoke(f, init, *first);
+                }
+
+                if (len >= 2 * size)
+                {
+                    typedef datapar_reduction<
+                            typename hpx::util::decay<F>::type
+                        > reduction;
+                    auto&& pack_f = reduction::get(f);
+
+                    bool const aligned = !detail::is_data_aligned(first);
+
+                    V accum(datapar_load<V>(first, aligned));
+                    std::advance(first, size);
+                    len -= size;
+
+                    for (/* */; len >= size; len -= size)
+                    {
+                        accum = hpx::util::invoke(
+                            pack_f, accum, datapar_load<V>(first, aligned));
+                        std::advance(first, size);
+                    }
+
+                    for (std::size_t i = 0; i != size; ++i)
+                    {
+                        init = hpx::util::invoke(f, init, value_type(accum[i]));
+                    }
+                }
+
+                for (/* */; len != 0; (void) --len, ++first)
+                {
+                    init = hpx::util::invoke(f, init, *first);
+                }
+                return init;
+            }
+
+            template <typename InIter, typename T, typename F>
+            HPX_HOST_DEVICE HPX_FORCEINLINE
+            static typename std::enable_if<
+                !is_vectorizable_reduce<InIter, F>::value, T
+            >::type
+            call(InIter first, std::size_t count, T init, F && f)
+            {
+                for (/* */; count != 0; (void) --count, ++first)
+                {
+                    init = hpx::util::invoke(f, init, *first);
+                }
+                return init;
+            }
+        };
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -382,6 +713,44 @@ namespace hpx { namespace parallel { namespace util
     {
         return detail::datapar_loop_n<Iter>::call(it, count, std::forward<F>(f));
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    typename std::enable_if<
+        execution::is_vectorpack_execution_policy<ExPolicy>::value, Iter
+    >::type
+    find_first_n(std::size_t base_idx, Iter it, std::size_t count,
+        CancelToken& tok, F && f)
+    {
+        return detail::datapar_find_first_n<Iter>::call(base_idx, it, count,
+            tok, std::forward<F>(f));
+    }
+
+    template <typename ExPolicy, typename Iter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    typename std::enable_if<
+        execution::is_vectorpack_execution_policy<ExPolicy>::value, Iter
+    >::type
+    find_first_n(Iter it, std::size_t count, F && f)
+    {
+        detail::no_cancellation tok;
+        return detail::datapar_find_first_n<Iter>::call(std::size_t(0), it,
+            count, tok, std::forward<F>(f));
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    typename std::enable_if<
+        execution::is_vectorpack_execution_policy<ExPolicy>::value, T
+    >::type
+    reduce_n(Iter it, std::size_t count, T init, Reduce && r)
+    {
+        return detail::datapar_reduce_n<Iter>::call(it, count, std::move(init),
+            std::forward<Reduce>(r));
+    }
 }}}
 
 #endif
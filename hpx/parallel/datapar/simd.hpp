@@ -0,0 +1,676 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/datapar/simd.hpp
+
+#if !defined(HPX_PARALLEL_DATAPAR_SIMD_JUL_16_2019_0945AM)
+#define HPX_PARALLEL_DATAPAR_SIMD_JUL_16_2019_0945AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+// The built-in vector packs are implemented on top of the vector extensions
+// of GCC and Clang. Element types which are not supported by those (bool and
+// long double) and all element types on other compilers use a plain array
+// of lanes instead.
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__CUDACC__)
+#define HPX_DATAPAR_BUILTIN_VECTOR_EXTENSIONS
+#endif
+
+// The width of the native vector registers in bytes, separately for floating
+// point and integral element types. Zero means that no vector registers are
+// available and the native vector packs hold a single element.
+#if defined(HPX_DATAPAR_BUILTIN_VECTOR_EXTENSIONS)
+#  if defined(__AVX512F__)
+#    define HPX_DATAPAR_BUILTIN_FLOAT_REGISTER_SIZE 64
+#  elif defined(__AVX__)
+#    define HPX_DATAPAR_BUILTIN_FLOAT_REGISTER_SIZE 32
+#  elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+#    define HPX_DATAPAR_BUILTIN_FLOAT_REGISTER_SIZE 16
+#  else
+#    define HPX_DATAPAR_BUILTIN_FLOAT_REGISTER_SIZE 0
+#  endif
+#  if defined(__AVX512BW__)
+#    define HPX_DATAPAR_BUILTIN_INT_REGISTER_SIZE 64
+#  elif defined(__AVX2__)
+#    define HPX_DATAPAR_BUILTIN_INT_REGISTER_SIZE 32
+#  elif defined(__SSE2__) || defined(__ARM_NEON) || defined(__ALTIVEC__)
+#    define HPX_DATAPAR_BUILTIN_INT_REGISTER_SIZE 16
+#  else
+#    define HPX_DATAPAR_BUILTIN_INT_REGISTER_SIZE 0
+#  endif
+#else
+#  define HPX_DATAPAR_BUILTIN_FLOAT_REGISTER_SIZE 0
+#  define HPX_DATAPAR_BUILTIN_INT_REGISTER_SIZE 0
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace simd
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// Tags selecting aligned and unaligned loads and stores of vector packs.
+    struct vector_aligned_tag {};
+    struct element_aligned_tag {};
+
+    HPX_STATIC_CONSTEXPR vector_aligned_tag vector_aligned = {};
+    HPX_STATIC_CONSTEXPR element_aligned_tag element_aligned = {};
+
+    template <typename T, std::size_t N>
+    class pack;
+
+    template <typename T, std::size_t N>
+    class mask;
+
+    template <typename T, std::size_t N>
+    class where_expression;
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        // signed integer of the given size, the lane type of masks
+        template <std::size_t Size>
+        struct mask_lane;
+
+        template <> struct mask_lane<1> { typedef std::int8_t type; };
+        template <> struct mask_lane<2> { typedef std::int16_t type; };
+        template <> struct mask_lane<4> { typedef std::int32_t type; };
+        template <> struct mask_lane<8> { typedef std::int64_t type; };
+
+        // long double is never held in vector registers, its masks are
+        // arrays of lanes
+        template <std::size_t Size>
+        struct mask_lane
+        {
+            typedef std::int64_t type;
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        // Fallback storage: an array of lanes supporting the element-wise
+        // operators the vector extensions provide.
+        template <typename T, std::size_t N>
+        struct lane_array
+        {
+            T operator[](std::size_t i) const
+            {
+                return data_[i];
+            }
+
+            T data_[N];
+        };
+
+#define HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(op)                                \
+        template <typename T, std::size_t N>                                  \
+        lane_array<T, N> operator op(                                         \
+            lane_array<T, N> const& lhs, lane_array<T, N> const& rhs)         \
+        {                                                                     \
+            lane_array<T, N> result;                                          \
+            for (std::size_t i = 0; i != N; ++i)                              \
+                result.data_[i] = T(lhs.data_[i] op rhs.data_[i]);            \
+            return result;                                                    \
+        }                                                                     \
+    /**/
+
+#define HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP(op)                               \
+        template <typename T, std::size_t N>                                  \
+        lane_array<typename mask_lane<sizeof(T)>::type, N> operator op(       \
+            lane_array<T, N> const& lhs, lane_array<T, N> const& rhs)         \
+        {                                                                     \
+            lane_array<typename mask_lane<sizeof(T)>::type, N> result;        \
+            for (std::size_t i = 0; i != N; ++i)                              \
+                result.data_[i] = (lhs.data_[i] op rhs.data_[i]) ? -1 : 0;    \
+            return result;                                                    \
+        }                                                                     \
+    /**/
+
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(+)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(-)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(*)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(/)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(%)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(&)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(|)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(^)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(<<)
+        HPX_DATAPAR_BUILTIN_LANE_BINARY_OP(>>)
+
+        HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP(==)
+        HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP(!=)
+        HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP(<)
+        HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP(<=)
+        HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP(>)
+        HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP(>=)
+
+#undef HPX_DATAPAR_BUILTIN_LANE_COMPARE_OP
+#undef HPX_DATAPAR_BUILTIN_LANE_BINARY_OP
+
+        template <typename T, std::size_t N>
+        lane_array<T, N> operator-(lane_array<T, N> const& value)
+        {
+            lane_array<T, N> result;
+            for (std::size_t i = 0; i != N; ++i)
+                result.data_[i] = T(-value.data_[i]);
+            return result;
+        }
+
+        template <typename T, std::size_t N>
+        lane_array<T, N> operator~(lane_array<T, N> const& value)
+        {
+            lane_array<T, N> result;
+            for (std::size_t i = 0; i != N; ++i)
+                result.data_[i] = T(~value.data_[i]);
+            return result;
+        }
+
+        template <typename T, std::size_t N, typename U>
+        void set_lane(lane_array<T, N>& data, std::size_t i, U value)
+        {
+            data.data_[i] = T(value);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T, std::size_t N, typename Enable = void>
+        struct pack_storage
+        {
+            typedef lane_array<T, N> type;
+            typedef lane_array<typename mask_lane<sizeof(T)>::type, N>
+                mask_type;
+        };
+
+#if defined(HPX_DATAPAR_BUILTIN_VECTOR_EXTENSIONS)
+        // the vector extensions support arithmetic element types (except
+        // for bool and long double) and a power of two number of lanes
+        template <typename T, std::size_t N>
+        struct pack_storage<T, N,
+            typename std::enable_if<
+                std::is_arithmetic<T>::value &&
+                !std::is_same<T, bool>::value &&
+                !std::is_same<T, long double>::value &&
+                (N & (N - 1)) == 0
+            >::type>
+        {
+            typedef T type __attribute__((vector_size(N * sizeof(T))));
+            typedef typename mask_lane<sizeof(T)>::type mask_type
+                __attribute__((vector_size(N * sizeof(T))));
+        };
+
+        template <typename V, typename U>
+        HPX_FORCEINLINE void set_lane(V& data, std::size_t i, U value)
+        {
+            data[i] = value;
+        }
+
+        template <std::size_t Alignment, typename T>
+        HPX_FORCEINLINE T* assume_aligned(T* p)
+        {
+            return static_cast<T*>(__builtin_assume_aligned(p, Alignment));
+        }
+#else
+        template <std::size_t Alignment, typename T>
+        HPX_FORCEINLINE T* assume_aligned(T* p)
+        {
+            return p;
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // number of elements of type T in a native vector register
+        template <typename T>
+        struct native_size
+        {
+            static std::size_t const register_size =
+                std::is_floating_point<T>::value ?
+                    HPX_DATAPAR_BUILTIN_FLOAT_REGISTER_SIZE :
+                    HPX_DATAPAR_BUILTIN_INT_REGISTER_SIZE;
+
+            static std::size_t const value =
+                (std::is_same<T, bool>::value ||
+                 std::is_same<T, long double>::value ||
+                 register_size < 2 * sizeof(T)) ?
+                    1 : register_size / sizeof(T);
+        };
+
+        // The result is passed by reference: returning a vector type wider
+        // than the enabled instruction set by value changes the ABI (and
+        // triggers -Wpsabi).
+        template <typename Mask, typename T, std::size_t N>
+        HPX_FORCEINLINE void blend(lane_array<T, N>& result, Mask const& m,
+            lane_array<T, N> const& lhs, lane_array<T, N> const& rhs)
+        {
+            for (std::size_t i = 0; i != N; ++i)
+                result.data_[i] = m[i] ? lhs.data_[i] : rhs.data_[i];
+        }
+
+#if defined(HPX_DATAPAR_BUILTIN_VECTOR_EXTENSIONS)
+        // selects the lanes of lhs for which m is set and the lanes of rhs
+        // otherwise, bit-wise on vector registers
+        template <typename Mask, typename V>
+        HPX_FORCEINLINE void blend(V& result, Mask const& m, V const& lhs,
+            V const& rhs)
+        {
+            result = (V)(((Mask) lhs & m) | ((Mask) rhs & ~m));
+        }
+#endif
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A vector pack of \a N elements of type \a T. The default for \a N is
+    /// the number of elements which fit into a native vector register of the
+    /// target architecture (or one, if there is none).
+    template <typename T,
+        std::size_t N = detail::native_size<T>::value>
+    class pack
+    {
+        typedef detail::pack_storage<T, N> storage;
+
+    public:
+        typedef T value_type;
+        typedef simd::mask<T, N> mask_type;
+        typedef typename storage::type storage_type;
+
+        static HPX_CONSTEXPR std::size_t size()
+        {
+            return N;
+        }
+
+        pack()
+          : data_()
+        {}
+
+        // broadcast the given value to all lanes
+        pack(T value)
+        {
+            for (std::size_t i = 0; i != N; ++i)
+                detail::set_lane(data_, i, value);
+        }
+
+        explicit pack(storage_type const& data)
+          : data_(data)
+        {}
+
+        template <typename U>
+        pack(U const* p, element_aligned_tag)
+        {
+            load(p);
+        }
+
+        template <typename U>
+        pack(U const* p, vector_aligned_tag)
+        {
+            load(detail::assume_aligned<alignof(storage_type)>(p));
+        }
+
+        template <typename U>
+        void copy_to(U* p, element_aligned_tag) const
+        {
+            store(p);
+        }
+
+        template <typename U>
+        void copy_to(U* p, vector_aligned_tag) const
+        {
+            store(detail::assume_aligned<alignof(storage_type)>(p));
+        }
+
+        T operator[](std::size_t i) const
+        {
+            return data_[i];
+        }
+
+        void set(std::size_t i, T value)
+        {
+            detail::set_lane(data_, i, value);
+        }
+
+        storage_type const& data() const
+        {
+            return data_;
+        }
+
+        // v(m) = value assigns to the lanes for which m is set only
+        where_expression<T, N> operator()(mask_type const& m)
+        {
+            return where_expression<T, N>(m, *this);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        pack operator+() const
+        {
+            return *this;
+        }
+
+        pack operator-() const
+        {
+            return pack(storage_type(-data_));
+        }
+
+        pack operator~() const
+        {
+            return pack(storage_type(~data_));
+        }
+
+#define HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(op)                                \
+        friend pack operator op(pack const& lhs, pack const& rhs)             \
+        {                                                                     \
+            return pack(storage_type(lhs.data_ op rhs.data_));                \
+        }                                                                     \
+        pack& operator op##=(pack const& rhs)                                 \
+        {                                                                     \
+            data_ = storage_type(data_ op rhs.data_);                         \
+            return *this;                                                     \
+        }                                                                     \
+    /**/
+
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(+)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(-)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(*)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(/)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(%)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(&)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(|)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(^)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(<<)
+        HPX_DATAPAR_BUILTIN_PACK_BINARY_OP(>>)
+
+#undef HPX_DATAPAR_BUILTIN_PACK_BINARY_OP
+
+#define HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP(op)                               \
+        friend mask_type operator op(pack const& lhs, pack const& rhs)        \
+        {                                                                     \
+            return mask_type(typename mask_type::storage_type(                \
+                lhs.data_ op rhs.data_));                                     \
+        }                                                                     \
+    /**/
+
+        HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP(==)
+        HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP(!=)
+        HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP(<)
+        HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP(<=)
+        HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP(>)
+        HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP(>=)
+
+#undef HPX_DATAPAR_BUILTIN_PACK_COMPARE_OP
+
+    private:
+        template <typename U>
+        void load(U const* p)
+        {
+            load(p, std::is_same<T, U>());
+        }
+
+        template <typename U>
+        void load(U const* p, std::true_type)
+        {
+            std::memcpy(&data_, p, sizeof(data_));
+        }
+
+        template <typename U>
+        void load(U const* p, std::false_type)
+        {
+            for (std::size_t i = 0; i != N; ++i)
+                detail::set_lane(data_, i, T(p[i]));
+        }
+
+        template <typename U>
+        void store(U* p) const
+        {
+            store(p, std::is_same<T, U>());
+        }
+
+        template <typename U>
+        void store(U* p, std::true_type) const
+        {
+            std::memcpy(p, &data_, sizeof(data_));
+        }
+
+        template <typename U>
+        void store(U* p, std::false_type) const
+        {
+            for (std::size_t i = 0; i != N; ++i)
+                p[i] = U(data_[i]);
+        }
+
+        storage_type data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The result of comparing two vector packs of \a N elements of type
+    /// \a T, each lane is either set or unset.
+    template <typename T, std::size_t N>
+    class mask
+    {
+        typedef detail::pack_storage<T, N> storage;
+
+    public:
+        typedef bool value_type;
+        typedef typename storage::mask_type storage_type;
+
+        static HPX_CONSTEXPR std::size_t size()
+        {
+            return N;
+        }
+
+        mask()
+          : data_()
+        {}
+
+        // broadcast the given value to all lanes
+        mask(bool value)
+        {
+            for (std::size_t i = 0; i != N; ++i)
+                detail::set_lane(data_, i, value ? -1 : 0);
+        }
+
+        explicit mask(storage_type const& data)
+          : data_(data)
+        {}
+
+        bool operator[](std::size_t i) const
+        {
+            return data_[i] != 0;
+        }
+
+        storage_type const& data() const
+        {
+            return data_;
+        }
+
+        mask operator!() const
+        {
+            return mask(storage_type(~data_));
+        }
+
+        friend mask operator&&(mask const& lhs, mask const& rhs)
+        {
+            return mask(storage_type(lhs.data_ & rhs.data_));
+        }
+        friend mask operator||(mask const& lhs, mask const& rhs)
+        {
+            return mask(storage_type(lhs.data_ | rhs.data_));
+        }
+
+        friend mask operator&(mask const& lhs, mask const& rhs)
+        {
+            return mask(storage_type(lhs.data_ & rhs.data_));
+        }
+        friend mask operator|(mask const& lhs, mask const& rhs)
+        {
+            return mask(storage_type(lhs.data_ | rhs.data_));
+        }
+        friend mask operator^(mask const& lhs, mask const& rhs)
+        {
+            return mask(storage_type(lhs.data_ ^ rhs.data_));
+        }
+
+        friend mask operator==(mask const& lhs, mask const& rhs)
+        {
+            return mask(storage_type(~(lhs.data_ ^ rhs.data_)));
+        }
+        friend mask operator!=(mask const& lhs, mask const& rhs)
+        {
+            return mask(storage_type(lhs.data_ ^ rhs.data_));
+        }
+
+    private:
+        storage_type data_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Returns the number of set lanes of the given mask.
+    template <typename T, std::size_t N>
+    std::size_t popcount(mask<T, N> const& m)
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i != N; ++i)
+            count += m[i] ? 1 : 0;
+        return count;
+    }
+
+    template <typename T, std::size_t N>
+    bool all_of(mask<T, N> const& m)
+    {
+        return popcount(m) == N;
+    }
+
+    template <typename T, std::size_t N>
+    bool any_of(mask<T, N> const& m)
+    {
+        return popcount(m) != 0;
+    }
+
+    template <typename T, std::size_t N>
+    bool none_of(mask<T, N> const& m)
+    {
+        return popcount(m) == 0;
+    }
+
+    template <typename T, std::size_t N>
+    bool some_of(mask<T, N> const& m)
+    {
+        std::size_t const count = popcount(m);
+        return count != 0 && count != N;
+    }
+
+    /// Returns the index of the first set lane of the given mask, or the
+    /// size of the mask if none is set.
+    template <typename T, std::size_t N>
+    std::size_t find_first_set(mask<T, N> const& m)
+    {
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            if (m[i])
+                return i;
+        }
+        return N;
+    }
+
+    /// Returns the index of the last set lane of the given mask, or the
+    /// size of the mask if none is set.
+    template <typename T, std::size_t N>
+    std::size_t find_last_set(mask<T, N> const& m)
+    {
+        for (std::size_t i = N; i != 0; --i)
+        {
+            if (m[i - 1])
+                return i - 1;
+        }
+        return N;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Returns a vector pack holding the lanes of \a lhs for which \a m is set
+    /// and the lanes of \a rhs otherwise.
+    template <typename T, std::size_t N>
+    pack<T, N> choose(mask<T, N> const& m, pack<T, N> const& lhs,
+        pack<T, N> const& rhs)
+    {
+        typename pack<T, N>::storage_type result;
+        detail::blend(result, m.data(), lhs.data(), rhs.data());
+        return pack<T, N>(result);
+    }
+
+    template <typename T, std::size_t N>
+    pack<T, N> min(pack<T, N> const& lhs, pack<T, N> const& rhs)
+    {
+        return choose(rhs < lhs, rhs, lhs);
+    }
+
+    template <typename T, std::size_t N>
+    pack<T, N> max(pack<T, N> const& lhs, pack<T, N> const& rhs)
+    {
+        return choose(lhs < rhs, rhs, lhs);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Refers to the lanes of a vector pack for which a mask is set,
+    /// assignments modify those lanes only.
+    template <typename T, std::size_t N>
+    class where_expression
+    {
+    public:
+        where_expression(mask<T, N> const& m, pack<T, N>& value)
+          : mask_(m), value_(value)
+        {}
+
+        where_expression& operator=(pack<T, N> const& rhs)
+        {
+            value_ = choose(mask_, rhs, value_);
+            return *this;
+        }
+
+#define HPX_DATAPAR_BUILTIN_WHERE_ASSIGN_OP(op)                               \
+        where_expression& operator op##=(pack<T, N> const& rhs)               \
+        {                                                                     \
+            value_ = choose(mask_, value_ op rhs, value_);                    \
+            return *this;                                                     \
+        }                                                                     \
+    /**/
+
+        HPX_DATAPAR_BUILTIN_WHERE_ASSIGN_OP(+)
+        HPX_DATAPAR_BUILTIN_WHERE_ASSIGN_OP(-)
+        HPX_DATAPAR_BUILTIN_WHERE_ASSIGN_OP(*)
+        HPX_DATAPAR_BUILTIN_WHERE_ASSIGN_OP(/)
+
+#undef HPX_DATAPAR_BUILTIN_WHERE_ASSIGN_OP
+
+    private:
+        mask<T, N> mask_;
+        pack<T, N>& value_;
+    };
+
+    template <typename T, std::size_t N>
+    where_expression<T, N> where(mask<T, N> const& m, pack<T, N>& value)
+    {
+        return where_expression<T, N>(m, value);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Combines the lanes of the given vector pack using the (associative)
+    /// binary operation \a op.
+    template <typename T, std::size_t N, typename F>
+    T reduce(pack<T, N> const& value, F && op)
+    {
+        T result = value[0];
+        for (std::size_t i = 1; i != N; ++i)
+            result = op(result, value[i]);
+        return result;
+    }
+
+    template <typename T, std::size_t N>
+    T reduce(pack<T, N> const& value)
+    {
+        return reduce(value, std::plus<T>());
+    }
+}}}
+
+#endif
+#endif
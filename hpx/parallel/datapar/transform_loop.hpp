@@ -29,6 +29,26 @@
 
 namespace hpx { namespace parallel { namespace util
 {
+    // the vectorized loops are used by datapar_transform_loop and
+    // datapar_transform_binary_loop below, they have to be visible there
+    template <typename ExPolicy, typename Iter, typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    typename std::enable_if<
+        execution::is_vectorpack_execution_policy<ExPolicy>::value,
+        std::pair<Iter, OutIter>
+    >::type
+    transform_loop_n(Iter it, std::size_t count, OutIter dest, F && f);
+
+    template <typename ExPolicy, typename InIter1, typename InIter2,
+        typename OutIter, typename F>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    typename std::enable_if<
+        execution::is_vectorpack_execution_policy<ExPolicy>::value,
+        hpx::util::tuple<InIter1, InIter2, OutIter>
+    >::type
+    transform_binary_loop_n(InIter1 first1, std::size_t count, InIter2 first2,
+        OutIter dest, F && f);
+
     namespace detail
     {
         ///////////////////////////////////////////////////////////////////////
@@ -53,7 +73,7 @@ namespace hpx { namespace parallel { namespace util
             {
                 std::size_t len = count;
 
-                for (/* */; is_data_aligned(first) && len != 0; --len)
+                for (/* */; len != 0 && is_data_aligned(first); --len)
                 {
                     datapar_transform_loop_step::call1(f, first, dest);
                 }
@@ -61,7 +81,7 @@ namespace hpx { namespace parallel { namespace util
                 static std::size_t HPX_CONSTEXPR_OR_CONST size =
                     traits::vector_pack_size<V>::value;
 
-                for (std::int64_t lenV = std::int64_t(count - (size + 1));
+                for (std::int64_t lenV = std::int64_t(len) - std::int64_t(size + 1);
                         lenV > 0; lenV -= size, len -= size)
                 {
                     datapar_transform_loop_step::callv(f, first, dest);
@@ -158,7 +178,7 @@ namespace hpx { namespace parallel { namespace util
             {
                 std::size_t len = count;
 
-                for (/* */; is_data_aligned(first1) && len != 0; --len)
+                for (/* */; len != 0 && is_data_aligned(first1); --len)
                 {
                     datapar_transform_loop_step::call1(f, first1, first2, dest);
                 }
@@ -166,7 +186,7 @@ namespace hpx { namespace parallel { namespace util
                 static std::size_t HPX_CONSTEXPR_OR_CONST size =
                     traits::vector_pack_size<V>::value;
 
-                for (std::int64_t lenV = std::int64_t(count - (size + 1));
+                for (std::int64_t lenV = std::int64_t(len) - std::int64_t(size + 1);
                         lenV > 0; lenV -= size, len -= size)
                 {
                     datapar_transform_loop_step::callv(f, first1, first2, dest);
@@ -0,0 +1,556 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/executors/adaptive_chunk_size.hpp
+
+#if !defined(HPX_PARALLEL_EXECUTORS_ADAPTIVE_CHUNK_SIZE_HPP)
+#define HPX_PARALLEL_EXECUTORS_ADAPTIVE_CHUNK_SIZE_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/runtime/threads/thread_pool_base.hpp>
+#include <hpx/traits/is_executor_parameters.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace hpx { namespace parallel { namespace execution
+{
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The statistics collected for one shape of a loop, i.e. for a given
+        // number of cores and magnitude of the number of iterations. The
+        // candidates are the number of chunks created per core (1, 2, 4, ...,
+        // 64), the measured time per iteration is tracked as an exponential
+        // moving average for each of them.
+        struct adaptive_chunk_size_bucket
+        {
+            static std::size_t const num_candidates = 7;
+            static std::uint32_t const min_samples = 3;
+            static std::uint64_t const explore_interval = 32;
+
+            struct candidate
+            {
+                candidate()
+                  : samples_(0), time_(0.0),
+                    idle_rate_(-1.0), steal_ratio_(-1.0), overhead_(0.0)
+                {}
+
+                std::uint32_t samples_;
+                double time_;           // nanoseconds per iteration
+                double idle_rate_;      // negative if not available
+                double steal_ratio_;    // stolen tasks per chunk, negative if
+                                        // not available
+                double overhead_;       // fraction of the time spent while
+                                        // scheduling the chunks
+            };
+
+            adaptive_chunk_size_bucket()
+              : best_(2), calls_(0)
+            {}
+
+            static std::size_t chunks_per_core(std::size_t idx)
+            {
+                return std::size_t(1) << idx;
+            }
+
+            // select the candidate to use for the next measured invocation
+            std::size_t next_candidate()
+            {
+                ++calls_;
+
+                // make sure the current best candidate and its neighbors have
+                // been measured often enough to be compared
+                std::size_t const lower = best_ == 0 ? best_ : best_ - 1;
+                std::size_t const upper =
+                    (std::min)(best_ + 1, num_candidates - 1);
+
+                if (candidates_[best_].samples_ < min_samples)
+                    return best_;
+                if (candidates_[lower].samples_ < min_samples)
+                    return lower;
+                if (candidates_[upper].samples_ < min_samples)
+                    return upper;
+
+                // once converged, re-measure one of the neighbors every now
+                // and then to follow changes of the system
+                if (calls_ % explore_interval != 0)
+                    return best_;
+
+                candidate const& c = candidates_[best_];
+                bool const imbalanced =
+                    c.idle_rate_ > 0.25 || c.steal_ratio_ > 0.5;
+                bool const overloaded = c.overhead_ > 0.5;
+
+                if (imbalanced && !overloaded)
+                    return upper;
+                if (overloaded && !imbalanced)
+                    return lower;
+                return (calls_ / explore_interval) % 2 ? upper : lower;
+            }
+
+            void record(std::size_t idx, double time, double idle_rate,
+                double steal_ratio, double overhead)
+            {
+                candidate& c = candidates_[idx];
+                if (c.samples_ == 0)
+                {
+                    c.time_ = time;
+                    c.overhead_ = overhead;
+                }
+                else
+                {
+                    c.time_ += (time - c.time_) / 4;
+                    c.overhead_ += (overhead - c.overhead_) / 4;
+                }
+                c.idle_rate_ = idle_rate;
+                c.steal_ratio_ = steal_ratio;
+                if (c.samples_ != (std::numeric_limits<std::uint32_t>::max)())
+                    ++c.samples_;
+
+                // move to a neighbor if it is faster by more than 2%
+                std::size_t best = best_;
+                double best_time = candidates_[best_].time_;
+                if (candidates_[best_].samples_ < min_samples)
+                    return;
+
+                for (std::size_t i = best_ == 0 ? 0 : best_ - 1;
+                     i <= best_ + 1 && i != num_candidates; ++i)
+                {
+                    if (i != best_ && candidates_[i].samples_ >= min_samples &&
+                        candidates_[i].time_ < 0.98 * best_time)
+                    {
+                        best = i;
+                        best_time = candidates_[i].time_;
+                    }
+                }
+                best_ = best;
+            }
+
+            std::size_t best_;
+            std::uint64_t calls_;
+            candidate candidates_[num_candidates];
+        };
+
+        // The state shared by all copies of an adaptive_chunk_size object
+        class adaptive_chunk_size_state
+        {
+            typedef hpx::lcos::local::spinlock mutex_type;
+            typedef std::map<std::uint64_t, adaptive_chunk_size_bucket>
+                buckets_type;
+
+            // counters sampled at the beginning and the end of a measured
+            // invocation
+            struct counters
+            {
+                counters()
+                  : stolen_(0), exec_time_(0), tfunc_time_(0)
+                {}
+
+                std::int64_t stolen_;
+                std::int64_t exec_time_;
+                std::int64_t tfunc_time_;
+            };
+
+        public:
+            adaptive_chunk_size_state()
+              : active_(0), measuring_(false), overlapped_(false),
+                has_key_(false), key_(0), candidate_(0), count_(0),
+                chunks_(0), start_(0), end_of_scheduling_(0)
+            {}
+
+            static std::uint64_t make_key(std::size_t cores, std::size_t count)
+            {
+                std::uint64_t log2_count = 0;
+                while (count >>= 1)
+                    ++log2_count;
+                return (std::uint64_t(cores) << 8) | log2_count;
+            }
+
+            // the number of chunks per core to use for the given loop shape
+            std::size_t chunks_per_core(std::size_t cores, std::size_t count)
+            {
+                std::uint64_t const key = make_key(cores, count);
+
+                std::lock_guard<mutex_type> l(mtx_);
+                adaptive_chunk_size_bucket& b = buckets_[key];
+
+                // the first loop run by a measured invocation determines the
+                // shape and the candidate which is measured
+                if (measuring_ && !overlapped_)
+                {
+                    if (!has_key_)
+                    {
+                        has_key_ = true;
+                        key_ = key;
+                        candidate_ = b.next_candidate();
+                        count_ = count;
+                        chunks_ = (std::min)(count, cores *
+                            adaptive_chunk_size_bucket::chunks_per_core(
+                                candidate_));
+                    }
+
+                    if (key_ == key)
+                    {
+                        return adaptive_chunk_size_bucket::chunks_per_core(
+                            candidate_);
+                    }
+
+                    // a different loop shape is run by the same invocation
+                    overlapped_ = true;
+                }
+
+                return adaptive_chunk_size_bucket::chunks_per_core(b.best_);
+            }
+
+            std::size_t learned_chunks_per_core(
+                std::size_t cores, std::size_t count) const
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                buckets_type::const_iterator it =
+                    buckets_.find(make_key(cores, count));
+                std::size_t best = it != buckets_.end() ?
+                    it->second.best_ : adaptive_chunk_size_bucket().best_;
+                return adaptive_chunk_size_bucket::chunks_per_core(best);
+            }
+
+            void begin_execution()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (++active_ != 1)
+                {
+                    // concurrent invocations disturb each other's timings
+                    overlapped_ = true;
+                    return;
+                }
+
+                measuring_ = true;
+                overlapped_ = false;
+                has_key_ = false;
+                start_counters_ = sample_counters();
+                end_of_scheduling_ = 0;
+                start_ = hpx::util::high_resolution_clock::now();
+            }
+
+            void end_of_scheduling()
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                if (measuring_ && end_of_scheduling_ == 0)
+                    end_of_scheduling_ = hpx::util::high_resolution_clock::now();
+            }
+
+            void end_execution()
+            {
+                std::uint64_t const end =
+                    hpx::util::high_resolution_clock::now();
+
+                std::lock_guard<mutex_type> l(mtx_);
+                if (--active_ != 0 || !measuring_)
+                    return;
+
+                measuring_ = false;
+                if (!has_key_ || overlapped_ || count_ == 0 || end <= start_)
+                    return;
+
+                counters const end_counters = sample_counters();
+
+                double const elapsed = double(end - start_);
+                double const overhead = end_of_scheduling_ > start_ ?
+                    double(end_of_scheduling_ - start_) / elapsed : 0.0;
+
+                double idle_rate = -1.0;
+                std::int64_t const tfunc =
+                    end_counters.tfunc_time_ - start_counters_.tfunc_time_;
+                std::int64_t const exec =
+                    end_counters.exec_time_ - start_counters_.exec_time_;
+                if (tfunc > 0 && exec >= 0 && exec <= tfunc)
+                    idle_rate = 1.0 - double(exec) / double(tfunc);
+
+                double steal_ratio = -1.0;
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                if (chunks_ != 0)
+                {
+                    steal_ratio = double(
+                        end_counters.stolen_ - start_counters_.stolen_) /
+                            double(chunks_);
+                }
+#endif
+
+                buckets_[key_].record(candidate_, elapsed / double(count_),
+                    idle_rate, steal_ratio, overhead);
+            }
+
+            // The learned values are stored as text, one line per loop shape:
+            //   <cores> <log2(count)> <best> (<samples> <time>){7}
+            void save(std::ostream& os) const
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                os << "adaptive_chunk_size " << buckets_.size() << '\n';
+                for (auto const& v : buckets_)
+                {
+                    os << (v.first >> 8) << ' ' << (v.first & 0xff) << ' '
+                       << v.second.best_;
+                    for (auto const& c : v.second.candidates_)
+                        os << ' ' << c.samples_ << ' ' << c.time_;
+                    os << '\n';
+                }
+            }
+
+            bool load(std::istream& is)
+            {
+                std::string tag;
+                std::size_t size = 0;
+                if (!(is >> tag >> size) || tag != "adaptive_chunk_size")
+                    return false;
+
+                buckets_type buckets;
+                for (std::size_t i = 0; i != size; ++i)
+                {
+                    std::uint64_t cores = 0, log2_count = 0;
+                    adaptive_chunk_size_bucket b;
+                    if (!(is >> cores >> log2_count >> b.best_) ||
+                        b.best_ >= adaptive_chunk_size_bucket::num_candidates)
+                    {
+                        return false;
+                    }
+
+                    for (auto& c : b.candidates_)
+                    {
+                        if (!(is >> c.samples_ >> c.time_))
+                            return false;
+                    }
+                    buckets[(cores << 8) | (log2_count & 0xff)] = b;
+                }
+
+                std::lock_guard<mutex_type> l(mtx_);
+                buckets_.swap(buckets);
+                return true;
+            }
+
+        private:
+            // The counters are sampled for the thread pool of the calling
+            // thread, which is where the chunks are usually executed.
+            static counters sample_counters()
+            {
+                counters result;
+
+                hpx::error_code ec(hpx::lightweight);
+                hpx::threads::thread_pool_base* pool =
+                    hpx::this_thread::get_pool(ec);
+                if (ec || pool == nullptr)
+                    return result;
+
+#if (defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS) && \
+     defined(HPX_HAVE_THREAD_IDLE_RATES)) || \
+    defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                // the counters are accumulated over all worker threads
+                std::size_t const all_threads = std::size_t(-1);
+#endif
+
+#if defined(HPX_HAVE_THREAD_CUMULATIVE_COUNTS) && \
+    defined(HPX_HAVE_THREAD_IDLE_RATES)
+                result.tfunc_time_ =
+                    pool->get_cumulative_duration(all_threads, false);
+                result.exec_time_ =
+                    pool->get_cumulative_thread_duration(all_threads, false);
+#endif
+#if defined(HPX_HAVE_THREAD_STEALING_COUNTS)
+                result.stolen_ =
+                    pool->get_num_stolen_from_pending(all_threads, false) +
+                    pool->get_num_stolen_from_staged(all_threads, false);
+#endif
+                return result;
+            }
+
+            mutable mutex_type mtx_;
+            buckets_type buckets_;
+
+            // the invocation currently being measured
+            std::size_t active_;
+            bool measuring_;
+            bool overlapped_;
+            bool has_key_;
+            std::uint64_t key_;
+            std::size_t candidate_;
+            std::size_t count_;
+            std::size_t chunks_;
+            std::uint64_t start_;
+            std::uint64_t end_of_scheduling_;
+            counters start_counters_;
+        };
+        /// \endcond
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Loop iterations are divided into pieces and then assigned to threads.
+    /// The number of chunks created per core is learned online from the
+    /// measured execution times of the invocations of the algorithms using
+    /// this executor parameters object.
+    ///
+    /// The statistics are kept separately for each loop shape (the number of
+    /// cores used and the magnitude of the number of iterations). For each
+    /// shape the parameters object measures the time per iteration for the
+    /// current best number of chunks per core and its neighbors (the
+    /// candidates are 1, 2, 4, ..., 64 chunks per core) and moves towards the
+    /// fastest of them. After converging, a neighbor is re-measured every now
+    /// and then. The observed idle rate and work stealing (if the
+    /// corresponding performance counters are enabled) and the time spent
+    /// scheduling the chunks decide which neighbor is tried first.
+    ///
+    /// All copies of an \a adaptive_chunk_size object share the collected
+    /// statistics. A single object should be used for each call site, e.g.
+    /// by storing it in a static variable. Invocations which run
+    /// concurrently with other invocations using the same object are not
+    /// measured.
+    ///
+    /// The learned values can be stored with \a save and reloaded with \a load
+    /// (for instance on the next run of the application).
+    ///
+    struct adaptive_chunk_size
+    {
+    public:
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        /// without any collected statistics.
+        adaptive_chunk_size()
+          : state_(std::make_shared<detail::adaptive_chunk_size_state>())
+        {}
+
+        /// Construct an \a adaptive_chunk_size executor parameters object
+        /// initialized from the values previously stored with \a save.
+        ///
+        /// \param is           The stream to read the stored values from.
+        ///
+        explicit adaptive_chunk_size(std::istream& is)
+          : state_(std::make_shared<detail::adaptive_chunk_size_state>())
+        {
+            state_->load(is);
+        }
+
+        /// Store the learned values to the given stream.
+        void save(std::ostream& os) const
+        {
+            state_->save(os);
+        }
+
+        /// Replace the learned values with the ones read from the given
+        /// stream.
+        ///
+        /// \returns    true if the values were read successfully, otherwise
+        ///             the current values are left unchanged.
+        ///
+        bool load(std::istream& is)
+        {
+            return state_->load(is);
+        }
+
+        /// Returns the number of chunks per core currently considered best
+        /// for the given number of cores and iterations.
+        std::size_t learned_chunks_per_core(std::size_t cores,
+            std::size_t count) const
+        {
+            return state_->learned_chunks_per_core(cores, count);
+        }
+
+        /// \cond NOINTERNAL
+        template <typename Executor>
+        std::size_t maximal_number_of_chunks(Executor&&, std::size_t cores,
+            std::size_t count)
+        {
+            if (cores == 0 || count == 0)
+                return 1;
+
+            return (std::max)(std::size_t(1), (std::min)(count,
+                cores * state_->chunks_per_core(cores, count)));
+        }
+
+        template <typename Executor, typename F>
+        std::size_t get_chunk_size(Executor&& exec, F&&, std::size_t cores,
+            std::size_t count)
+        {
+            std::size_t const chunks =
+                maximal_number_of_chunks(exec, cores, count);
+            return (count + chunks - 1) / chunks;
+        }
+
+        template <typename Executor>
+        void mark_begin_execution(Executor&&)
+        {
+            state_->begin_execution();
+        }
+
+        template <typename Executor>
+        void mark_end_of_scheduling(Executor&&)
+        {
+            state_->end_of_scheduling();
+        }
+
+        template <typename Executor>
+        void mark_end_execution(Executor&&)
+        {
+            state_->end_execution();
+        }
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, const unsigned int) const
+        {
+            std::ostringstream os;
+            state_->save(os);
+            std::string data = os.str();
+            ar << data;
+        }
+
+        template <typename Archive>
+        void load(Archive& ar, const unsigned int)
+        {
+            std::string data;
+            ar >> data;
+            std::istringstream is(data);
+            state_ = std::make_shared<detail::adaptive_chunk_size_state>();
+            state_->load(is);
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+        /// \endcond
+
+    private:
+        /// \cond NOINTERNAL
+        std::shared_ptr<detail::adaptive_chunk_size_state> state_;
+        /// \endcond
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    /// \cond NOINTERNAL
+    template <>
+    struct is_executor_parameters<parallel::execution::adaptive_chunk_size>
+      : std::true_type
+    {};
+    /// \endcond
+}}}
+
+#endif
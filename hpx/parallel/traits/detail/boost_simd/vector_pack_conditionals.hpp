@@ -0,0 +1,30 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_DATAPAR_BOOST_SIMD_CONDITIONALS_JUL_22_2019_0938AM)
+#define HPX_PARALLEL_DATAPAR_BOOST_SIMD_CONDITIONALS_JUL_22_2019_0938AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BOOST_SIMD)
+#include <cstddef>
+
+#include <boost/simd.hpp>
+#include <boost/simd/function/if_else.hpp>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE void
+    mask_assign(boost::simd::pack<boost::simd::logical<T>, N, Abi> const& mask,
+        boost::simd::pack<T, N, Abi>& v, U const& val)
+    {
+        v = boost::simd::if_else(mask, boost::simd::pack<T, N, Abi>(T(val)), v);
+    }
+}}}
+
+#endif
+#endif
@@ -0,0 +1,37 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_DATAPAR_BOOST_SIMD_FIND_JUL_22_2019_0935AM)
+#define HPX_PARALLEL_DATAPAR_BOOST_SIMD_FIND_JUL_22_2019_0935AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BOOST_SIMD)
+#include <cstddef>
+
+#include <boost/simd.hpp>
+#include <boost/simd/function/any.hpp>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE int
+    find_first_of(boost::simd::pack<boost::simd::logical<T>, N, Abi> const& mask)
+    {
+        if (!boost::simd::any(mask))
+            return -1;
+
+        for (std::size_t i = 0; i != N; ++i)
+        {
+            if (mask[i])
+                return static_cast<int>(i);
+        }
+        return -1;
+    }
+}}}
+
+#endif
+#endif
@@ -0,0 +1,64 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_TRAITS_VECTOR_PACK_ALIGNMENT_SIZE_BUILTIN_JUL_16_2019_1104AM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_ALIGNMENT_SIZE_BUILTIN_JUL_16_2019_1104AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+#include <hpx/parallel/datapar/simd.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N>
+    struct is_vector_pack<simd::pack<T, N> >
+      : std::true_type
+    {};
+
+    template <typename T, std::size_t N>
+    struct is_scalar_vector_pack<simd::pack<T, N> >
+      : std::integral_constant<bool, N == 1>
+    {};
+
+    template <typename T, std::size_t N>
+    struct is_non_scalar_vector_pack<simd::pack<T, N> >
+      : std::integral_constant<bool, N != 1>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable>
+    struct vector_pack_alignment
+    {
+        static std::size_t const value = alignof(simd::pack<T>);
+    };
+
+    template <typename T, std::size_t N>
+    struct vector_pack_alignment<simd::pack<T, N> >
+    {
+        static std::size_t const value = alignof(simd::pack<T, N>);
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, typename Enable>
+    struct vector_pack_size
+    {
+        static std::size_t const value = simd::pack<T>::size();
+    };
+
+    template <typename T, std::size_t N>
+    struct vector_pack_size<simd::pack<T, N> >
+    {
+        static std::size_t const value = N;
+    };
+}}}
+
+#endif
+#endif
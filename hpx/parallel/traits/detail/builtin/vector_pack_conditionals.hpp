@@ -0,0 +1,28 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_DATAPAR_BUILTIN_CONDITIONALS_JUL_22_2019_0944AM)
+#define HPX_PARALLEL_DATAPAR_BUILTIN_CONDITIONALS_JUL_22_2019_0944AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+#include <hpx/parallel/datapar/simd.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename U>
+    HPX_FORCEINLINE void mask_assign(simd::mask<T, N> const& mask,
+        simd::pack<T, N>& v, U const& val)
+    {
+        simd::where(mask, v) = simd::pack<T, N>(T(val));
+    }
+}}}
+
+#endif
+#endif
@@ -0,0 +1,27 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_DATAPAR_BUILTIN_COUNT_BITS_JUL_16_2019_1106AM)
+#define HPX_PARALLEL_DATAPAR_BUILTIN_COUNT_BITS_JUL_16_2019_1106AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+#include <hpx/parallel/datapar/simd.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N>
+    HPX_FORCEINLINE std::size_t count_bits(simd::mask<T, N> const& mask)
+    {
+        return simd::popcount(mask);
+    }
+}}}
+
+#endif
+#endif
@@ -0,0 +1,28 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_DATAPAR_BUILTIN_FIND_JUL_22_2019_0941AM)
+#define HPX_PARALLEL_DATAPAR_BUILTIN_FIND_JUL_22_2019_0941AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+#include <hpx/parallel/datapar/simd.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N>
+    HPX_FORCEINLINE int find_first_of(simd::mask<T, N> const& mask)
+    {
+        std::size_t const idx = simd::find_first_set(mask);
+        return idx == N ? -1 : static_cast<int>(idx);
+    }
+}}}
+
+#endif
+#endif
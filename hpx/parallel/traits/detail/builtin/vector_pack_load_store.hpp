@@ -0,0 +1,107 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_TRAITS_VECTOR_PACK_LOAD_BUILTIN_JUL_16_2019_1108AM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_LOAD_BUILTIN_JUL_16_2019_1108AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+#include <hpx/parallel/datapar/simd.hpp>
+
+#include <cstddef>
+#include <memory>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename NewT>
+    struct rebind_pack<simd::pack<T, N>, NewT>
+    {
+        typedef simd::pack<NewT, N> type;
+    };
+
+    // don't wrap types twice
+    template <typename T, std::size_t N1, typename NewT, std::size_t N2>
+    struct rebind_pack<simd::pack<T, N1>, simd::pack<NewT, N2> >
+    {
+        typedef simd::pack<NewT, N2> type;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_load
+    {
+        typedef typename rebind_pack<V, ValueType>::type value_type;
+
+        template <typename Iter>
+        static value_type aligned(Iter const& iter)
+        {
+            return value_type(std::addressof(*iter), simd::vector_aligned);
+        }
+
+        template <typename Iter>
+        static value_type unaligned(Iter const& iter)
+        {
+            return value_type(std::addressof(*iter), simd::element_aligned);
+        }
+    };
+
+    // sequences of vector packs are loaded one pack at a time
+    template <typename V, typename T, std::size_t N>
+    struct vector_pack_load<V, simd::pack<T, N> >
+    {
+        typedef typename rebind_pack<V, simd::pack<T, N> >::type value_type;
+
+        template <typename Iter>
+        static value_type aligned(Iter const& iter)
+        {
+            return *iter;
+        }
+
+        template <typename Iter>
+        static value_type unaligned(Iter const& iter)
+        {
+            return *iter;
+        }
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename V, typename ValueType, typename Enable>
+    struct vector_pack_store
+    {
+        template <typename Iter>
+        static void aligned(V const& value, Iter const& iter)
+        {
+            value.copy_to(std::addressof(*iter), simd::vector_aligned);
+        }
+
+        template <typename Iter>
+        static void unaligned(V const& value, Iter const& iter)
+        {
+            value.copy_to(std::addressof(*iter), simd::element_aligned);
+        }
+    };
+
+    template <typename V, typename T, std::size_t N>
+    struct vector_pack_store<V, simd::pack<T, N> >
+    {
+        template <typename Iter>
+        static void aligned(V const& value, Iter const& iter)
+        {
+            *iter = value;
+        }
+
+        template <typename Iter>
+        static void unaligned(V const& value, Iter const& iter)
+        {
+            *iter = value;
+        }
+    };
+}}}
+
+#endif
+#endif
@@ -0,0 +1,51 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_TRAITS_VECTOR_PACK_TYPE_BUILTIN_JUL_16_2019_1102AM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_TYPE_BUILTIN_JUL_16_2019_1102AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+#include <hpx/parallel/datapar/simd.hpp>
+
+#include <cstddef>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // the built-in vector packs have a single Abi, it is ignored
+        template <typename T, std::size_t N, typename Abi>
+        struct vector_pack_type
+        {
+            typedef simd::pack<T, N> type;
+        };
+
+        template <typename T, typename Abi>
+        struct vector_pack_type<T, 0, Abi>
+        {
+            typedef simd::pack<T> type;
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename T, std::size_t N, typename Abi>
+    struct vector_pack_type
+      : detail::vector_pack_type<T, N, Abi>
+    {};
+
+    // don't wrap types twice
+    template <typename T, std::size_t N1, std::size_t N2, typename Abi>
+    struct vector_pack_type<simd::pack<T, N1>, N2, Abi>
+    {
+        typedef simd::pack<T, N1> type;
+    };
+}}}
+
+#endif
+#endif
@@ -0,0 +1,49 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_DATAPAR_VC_CONDITIONALS_JUL_22_2019_0931AM)
+#define HPX_PARALLEL_DATAPAR_VC_CONDITIONALS_JUL_22_2019_0931AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    void mask_assign(Vc::Mask<T, Abi> const& mask, Vc::Vector<T, Abi>& v,
+        U const& val)
+    {
+        v(mask) = Vc::Vector<T, Abi>(T(val));
+    }
+}}}
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    void mask_assign(Vc::mask<T, Abi> const& mask, Vc::datapar<T, Abi>& v,
+        U const& val)
+    {
+        Vc::where(mask, v) = Vc::datapar<T, Abi>(T(val));
+    }
+}}}
+
+#endif  // Vc_IS_VERSION_1
+
+#endif
+#endif
@@ -0,0 +1,47 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_DATAPAR_VC_FIND_JUL_22_2019_0927AM)
+#define HPX_PARALLEL_DATAPAR_VC_FIND_JUL_22_2019_0927AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_VC)
+#include <Vc/global.h>
+
+#if defined(Vc_IS_VERSION_1) && Vc_IS_VERSION_1
+
+#include <Vc/Vc>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    int find_first_of(Vc::Mask<T, Abi> const& mask)
+    {
+        return mask.isEmpty() ? -1 : mask.firstOne();
+    }
+}}}
+
+#else
+
+#include <Vc/datapar>
+
+namespace hpx { namespace parallel { namespace traits
+{
+    ///////////////////////////////////////////////////////////////////////
+    template <typename T, typename Abi>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    int find_first_of(Vc::mask<T, Abi> const& mask)
+    {
+        return Vc::any_of(mask) ? Vc::find_first_set(mask) : -1;
+    }
+}}}
+
+#endif  // Vc_IS_VERSION_1
+
+#endif
+#endif
@@ -0,0 +1,35 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_TRAITS_VECTOR_PACK_CONDITIONALS_JUL_22_2019_0921AM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_CONDITIONALS_JUL_22_2019_0921AM
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits
+{
+    // Assign the given value to all elements of 'v' for which the
+    // corresponding element of the mask is set. For scalars the mask is
+    // anything contextually convertible to bool.
+    template <typename Mask, typename T, typename U>
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    void mask_assign(Mask const& mask, T& v, U const& val)
+    {
+        if (mask)
+            v = val;
+    }
+}}}
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/parallel/traits/detail/vc/vector_pack_conditionals.hpp>
+#include <hpx/parallel/traits/detail/boost_simd/vector_pack_conditionals.hpp>
+#include <hpx/parallel/traits/detail/builtin/vector_pack_conditionals.hpp>
+#endif
+
+#endif
+#endif
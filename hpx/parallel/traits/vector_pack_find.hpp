@@ -0,0 +1,32 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_PARALLEL_TRAITS_VECTOR_PACK_FIND_JUL_22_2019_0915AM)
+#define HPX_PARALLEL_TRAITS_VECTOR_PACK_FIND_JUL_22_2019_0915AM
+
+#include <hpx/config.hpp>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace parallel { namespace traits
+{
+    // Return the index of the first element of the given mask which is set,
+    // or -1 if none is set.
+    HPX_HOST_DEVICE HPX_FORCEINLINE
+    int find_first_of(bool value)
+    {
+        return value ? 0 : -1;
+    }
+}}}
+
+#if defined(HPX_HAVE_DATAPAR)
+
+#if !defined(__CUDACC__)
+#include <hpx/parallel/traits/detail/vc/vector_pack_find.hpp>
+#include <hpx/parallel/traits/detail/boost_simd/vector_pack_find.hpp>
+#include <hpx/parallel/traits/detail/builtin/vector_pack_find.hpp>
+#endif
+
+#endif
+#endif
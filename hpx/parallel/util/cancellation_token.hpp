@@ -10,6 +10,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <functional>
 #include <memory>
 
@@ -21,6 +22,16 @@ namespace hpx { namespace parallel { namespace util
         {
             bool operator<= (no_data) const { return true; }
         };
+
+        // used for searches which are never cancelled from the outside
+        struct no_cancellation
+        {
+            HPX_CONSTEXPR bool was_cancelled(std::size_t) const noexcept
+            {
+                return false;
+            }
+            void cancel(std::size_t) noexcept {}
+        };
     }
 
     ///////////////////////////////////////////////////////////////////////////
@@ -58,7 +58,20 @@ namespace hpx { namespace parallel { namespace util { namespace detail
         Partitioner, TaskPartitioner>
     {
         template <typename ...Args>
-        using apply = TaskPartitioner<execution::datapar_task_policy>;
+        using apply = TaskPartitioner<execution::datapar_task_policy, Args...>;
+    };
+
+    template <
+        typename Executor, typename Parameters,
+        template <typename...> class Partitioner,
+        template <typename...> class TaskPartitioner>
+    struct select_partitioner<
+        execution::datapar_task_policy_shim<Executor, Parameters>,
+        Partitioner, TaskPartitioner>
+    {
+        template <typename ...Args>
+        using apply = TaskPartitioner<
+            execution::datapar_task_policy_shim<Executor, Parameters>, Args...>;
     };
 #endif
 }}}}
@@ -527,6 +527,70 @@ namespace hpx { namespace parallel { namespace util
             std::forward<F>(f));
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail
+    {
+        // Helper class to find the first element in a sequence for which a
+        // given predicate returns true.
+        template <typename Iterator>
+        struct find_first_n
+        {
+            template <typename Iter, typename CancelToken, typename F>
+            static Iter
+            call(std::size_t base_idx, Iter it, std::size_t count,
+                CancelToken& tok, F && f)
+            {
+                for (/**/; count != 0; (void) --count, ++it, ++base_idx)
+                {
+                    if (tok.was_cancelled(base_idx))
+                        break;
+
+                    if (hpx::util::invoke(f, *it))
+                    {
+                        tok.cancel(base_idx);
+                        break;
+                    }
+                }
+                return it;
+            }
+        };
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Searches [it, it + count) for the first element for which f returns
+    // true and cancels the given token at its index (base_idx + offset). The
+    // search stops early if the token was cancelled at a smaller index.
+    // Returns the position at which the search stopped.
+    //
+    // For vectorizing execution policies f is invoked with vector packs and
+    // has to return a mask.
+    template <typename ExPolicy, typename Iter, typename CancelToken,
+        typename F>
+    HPX_FORCEINLINE
+    typename std::enable_if<
+        !execution::is_vectorpack_execution_policy<ExPolicy>::value, Iter
+    >::type
+    find_first_n(std::size_t base_idx, Iter it, std::size_t count,
+        CancelToken& tok, F && f)
+    {
+        return detail::find_first_n<Iter>::call(base_idx, it, count, tok,
+            std::forward<F>(f));
+    }
+
+    // Returns the position of the first element in [it, it + count) for
+    // which f returns true (or it + count if there is none).
+    template <typename ExPolicy, typename Iter, typename F>
+    HPX_FORCEINLINE
+    typename std::enable_if<
+        !execution::is_vectorpack_execution_policy<ExPolicy>::value, Iter
+    >::type
+    find_first_n(Iter it, std::size_t count, F && f)
+    {
+        detail::no_cancellation tok;
+        return detail::find_first_n<Iter>::call(std::size_t(0), it, count,
+            tok, std::forward<F>(f));
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
@@ -555,6 +619,20 @@ namespace hpx { namespace parallel { namespace util
             std::forward<Pred>(f));
     }
 
+    // Reduces [it, it + count) into init. For vectorizing execution policies
+    // the elements are combined pack-wise first if the reduction operation
+    // can be invoked with vector packs.
+    template <typename ExPolicy, typename Iter, typename T, typename Reduce>
+    HPX_FORCEINLINE
+    typename std::enable_if<
+        !execution::is_vectorpack_execution_policy<ExPolicy>::value, T
+    >::type
+    reduce_n(Iter it, std::size_t count, T init, Reduce && r)
+    {
+        return util::accumulate_n(it, count, std::move(init),
+            std::forward<Reduce>(r));
+    }
+
     template <typename T, typename Iter, typename Reduce,
         typename Conv = util::projection_identity>
     HPX_FORCEINLINE T
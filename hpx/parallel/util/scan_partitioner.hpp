@@ -13,11 +13,17 @@
 #include <hpx/dataflow.hpp>
 #endif
 #include <hpx/exception_list.hpp>
+#include <hpx/lcos/future.hpp>
 #include <hpx/lcos/wait_all.hpp>
+#include <hpx/traits/is_iterator.hpp>
 #include <hpx/util/assert.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/optional.hpp>
+#include <hpx/util/yield_while.hpp>
 
 #include <hpx/parallel/execution_policy.hpp>
 #include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_information.hpp>
 #include <hpx/parallel/executors/execution_parameters.hpp>
 #include <hpx/parallel/util/detail/algorithm_result.hpp>
 #include <hpx/parallel/util/detail/chunk_size.hpp>
@@ -26,8 +32,10 @@
 #include <hpx/parallel/util/detail/select_partitioner.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <exception>
+#include <iterator>
 #include <list>
 #include <memory>
 #include <type_traits>
@@ -39,10 +47,83 @@ namespace hpx { namespace parallel { namespace util
 {
     struct scan_partitioner_normal_tag {};
     struct scan_partitioner_sequential_f3_tag {};
+    struct scan_partitioner_single_pass_tag {};
 
     ///////////////////////////////////////////////////////////////////////////
     namespace detail
     {
+        ///////////////////////////////////////////////////////////////////////
+        // The normal scan partitioner uses the single-pass algorithm for
+        // random access sequences of at least this many elements.
+        static const std::size_t scan_single_pass_limit = 1ul << 20;
+
+        // The maximal number of bytes of the sequence handled by one chunk
+        // of a single-pass algorithm selected by the normal scan partitioner.
+        // The chunk should still be in the cache when the third step
+        // revisits it.
+        static const std::size_t scan_single_pass_chunk_bytes = 1ul << 17;
+
+        // Executor parameters given explicitly by the user are honored by the
+        // normal scan partitioner.
+        template <typename Parameters, typename Executor, typename FwdIter>
+        bool use_scan_single_pass(std::size_t count)
+        {
+            return std::is_same<Parameters,
+                    typename execution::extract_executor_parameters<
+                        Executor
+                    >::type
+                >::value &&
+                hpx::traits::is_random_access_iterator<FwdIter>::value &&
+                count >= scan_single_pass_limit;
+        }
+
+        // The published state of a chunk of the single-pass algorithm. The
+        // aggregate is the result of the first step for the chunk, the
+        // prefix is the combined result of all chunks up to and including
+        // this one.
+        enum scan_chunk_status
+        {
+            scan_chunk_pending = 0,
+            scan_chunk_aggregate = 1,
+            scan_chunk_prefix = 2,
+            scan_chunk_failed = 3
+        };
+
+        template <typename T>
+        struct scan_chunk_state
+        {
+            scan_chunk_state()
+              : status_(scan_chunk_pending)
+            {}
+
+            std::atomic<int> status_;
+            hpx::util::optional<T> aggregate_;
+            hpx::util::optional<T> prefix_;
+            std::exception_ptr error_;
+        };
+
+        template <typename Result2>
+        struct scan_single_pass_final
+        {
+            template <typename F, typename ... Ts>
+            static hpx::future<Result2> call(F && f, Ts &&... ts)
+            {
+                return hpx::make_ready_future(hpx::util::invoke(
+                    std::forward<F>(f), std::forward<Ts>(ts)...));
+            }
+        };
+
+        template <>
+        struct scan_single_pass_final<void>
+        {
+            template <typename F, typename ... Ts>
+            static hpx::future<void> call(F && f, Ts &&... ts)
+            {
+                hpx::util::invoke(std::forward<F>(f), std::forward<Ts>(ts)...);
+                return hpx::make_ready_future();
+            }
+        };
+
         ///////////////////////////////////////////////////////////////////////
         // The static partitioner simply spawns one chunk of iterations for
         // each available core.
@@ -72,6 +153,19 @@ namespace hpx { namespace parallel { namespace util
                 HPX_ASSERT(false);
                 return R();
 #else
+                // large sequences are scanned in a single pass, which
+                // reads every element from memory only once
+                if (use_scan_single_pass<
+                        parameters_type, executor_type, FwdIter
+                    >(count))
+                {
+                    return call_single_pass(true,
+                        std::move(policy), first, count,
+                        std::forward<T>(init), std::forward<F1>(f1),
+                        std::forward<F2>(f2), std::forward<F3>(f3),
+                        std::forward<F4>(f4));
+                }
+
                 // inform parameter traits
                 scoped_executor_parameters scoped_params(
                     policy.parameters(), policy.executor());
@@ -286,6 +380,29 @@ namespace hpx { namespace parallel { namespace util
 #endif
             }
 
+            // The single-pass scan uses a decoupled look-back: the chunks
+            // are claimed in order by one task per core. Every task runs
+            // the first step on its chunk and publishes the result. It then
+            // combines the published results of the preceding chunks from
+            // right to left until it finds a chunk with a published prefix.
+            // It publishes its own prefix and runs the third step right
+            // away, while the chunk is still in the cache. The second step
+            // is invoked with the values instead of futures.
+            template <
+                typename ExPolicy_,
+                typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call(scan_partitioner_single_pass_tag,
+                ExPolicy_ policy,
+                FwdIter first, std::size_t count, T && init,
+                F1 && f1, F2 && f2, F3 && f3, F4 && f4)
+            {
+                return call_single_pass(false, std::move(policy), first,
+                    count, std::forward<T>(init), std::forward<F1>(f1),
+                    std::forward<F2>(f2), std::forward<F3>(f3),
+                    std::forward<F4>(f4));
+            }
+
             template <
                 typename ExPolicy_,
                 typename FwdIter, typename T,
@@ -303,6 +420,233 @@ namespace hpx { namespace parallel { namespace util
             }
 
         private:
+            // The chunk size is determined by the executor parameters, the
+            // chunks are limited to scan_single_pass_chunk_bytes if
+            // cache_bound is true.
+            template <
+                typename ExPolicy_,
+                typename FwdIter, typename T,
+                typename F1, typename F2, typename F3, typename F4>
+            static R call_single_pass(bool cache_bound,
+                ExPolicy_ policy,
+                FwdIter first, std::size_t count, T && init,
+                F1 && f1, F2 && f2, F3 && f3, F4 && f4)
+            {
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+                HPX_ASSERT(false);
+                return R();
+#else
+                typedef typename std::iterator_traits<FwdIter>::value_type
+                    value_type;
+                typedef scan_chunk_state<Result1> chunk_state;
+
+                // inform parameter traits
+                scoped_executor_parameters scoped_params(
+                    policy.parameters(), policy.executor());
+
+                HPX_ASSERT(count > 0);
+
+                std::size_t const cores = execution::processing_units_count(
+                    policy.executor(), policy.parameters());
+
+                std::size_t const max_chunk_size = (std::max)(std::size_t(1),
+                    scan_single_pass_chunk_bytes / sizeof(value_type));
+
+                std::size_t chunk_size = execution::get_chunk_size(
+                    policy.parameters(), policy.executor(),
+                    [](){ return 0; }, cores, count);
+                if (chunk_size == 0 ||
+                    (cache_bound && chunk_size > max_chunk_size))
+                {
+                    chunk_size = max_chunk_size;
+                }
+
+                std::size_t const num_chunks =
+                    (count + chunk_size - 1) / chunk_size;
+
+                std::vector<FwdIter> chunk_first;
+                chunk_first.reserve(num_chunks);
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    chunk_first.push_back(first);
+                    if (chunk + 1 != num_chunks)
+                        std::advance(first, chunk_size);
+                }
+
+                Result1 const init_value(std::forward<T>(init));
+
+                std::unique_ptr<chunk_state[]> chunks(
+                    new chunk_state[num_chunks]);
+                std::atomic<std::size_t> next_chunk(0);
+
+                std::vector<hpx::future<Result2>> finalitems(num_chunks);
+
+                auto process_chunk =
+                    [&](std::size_t chunk) -> hpx::future<Result2>
+                    {
+                        chunk_state& state = chunks[chunk];
+                        std::size_t const size = (std::min)(chunk_size,
+                            count - chunk * chunk_size);
+
+                        hpx::util::optional<Result1> exclusive;
+                        try
+                        {
+                            // every chunk uses its own copies of the steps
+                            // (as if they were scheduled separately), the
+                            // steps may modify their state
+                            typename std::decay<F1>::type step1(f1);
+                            typename std::decay<F2>::type step2(f2);
+
+                            state.aggregate_.emplace(hpx::util::invoke(
+                                step1, chunk_first[chunk], size));
+
+                            if (chunk == 0)
+                            {
+                                exclusive.emplace(init_value);
+                            }
+                            else
+                            {
+                                state.status_.store(scan_chunk_aggregate,
+                                    std::memory_order_release);
+
+                                // look back until a prefix is found
+                                for (std::size_t prev = chunk; prev-- != 0;)
+                                {
+                                    chunk_state& prev_state = chunks[prev];
+
+                                    int status = scan_chunk_pending;
+                                    hpx::util::yield_while(
+                                        [&]() -> bool
+                                        {
+                                            status = prev_state.status_.load(
+                                                std::memory_order_acquire);
+                                            return status ==
+                                                scan_chunk_pending;
+                                        });
+
+                                    if (status == scan_chunk_failed)
+                                        std::rethrow_exception(
+                                            prev_state.error_);
+
+                                    Result1 const& value =
+                                        status == scan_chunk_prefix ?
+                                            *prev_state.prefix_ :
+                                            *prev_state.aggregate_;
+
+                                    if (exclusive.has_value())
+                                    {
+                                        Result1 combined = hpx::util::invoke(
+                                            step2, value, *exclusive);
+                                        exclusive = std::move(combined);
+                                    }
+                                    else
+                                    {
+                                        exclusive.emplace(value);
+                                    }
+
+                                    if (status == scan_chunk_prefix)
+                                        break;
+                                }
+                            }
+
+                            state.prefix_.emplace(hpx::util::invoke(
+                                step2, *exclusive, *state.aggregate_));
+                            state.status_.store(scan_chunk_prefix,
+                                std::memory_order_release);
+                        }
+                        catch (...)
+                        {
+                            state.error_ = std::current_exception();
+                            state.status_.store(scan_chunk_failed,
+                                std::memory_order_release);
+
+                            return hpx::make_exceptional_future<Result2>(
+                                state.error_);
+                        }
+
+                        try
+                        {
+                            typename std::decay<F3>::type step3(f3);
+                            return scan_single_pass_final<Result2>::call(step3,
+                                chunk_first[chunk], size,
+                                hpx::make_ready_future(*exclusive).share(),
+                                hpx::make_ready_future(
+                                    *state.aggregate_).share());
+                        }
+                        catch (...)
+                        {
+                            return hpx::make_exceptional_future<Result2>(
+                                std::current_exception());
+                        }
+                    };
+
+                auto worker =
+                    [&]() -> void
+                    {
+                        std::size_t chunk;
+                        while ((chunk = next_chunk++) < num_chunks)
+                            finalitems[chunk] = process_chunk(chunk);
+                    };
+
+                std::size_t const num_workers = (std::min)(cores, num_chunks);
+
+                std::vector<hpx::future<void>> workers;
+                std::exception_ptr schedule_error;
+                try
+                {
+                    workers.reserve(num_workers);
+                    for (std::size_t i = 1; i < num_workers; ++i)
+                    {
+                        workers.push_back(execution::async_execute(
+                            policy.executor(), worker));
+                    }
+                }
+                catch (...)
+                {
+                    schedule_error = std::current_exception();
+                }
+
+                // the calling thread processes chunks as well, this
+                // guarantees that all chunks are processed
+                worker();
+
+                scoped_params.mark_end_of_scheduling();
+
+                // the workers refer to this stack frame, they have to finish
+                // before any exception is rethrown
+                hpx::wait_all(workers);
+
+                std::list<std::exception_ptr> errors;
+                if (schedule_error)
+                    handle_local_exceptions::call(schedule_error, errors);
+                handle_local_exceptions::call(workers, errors);
+
+                std::vector<hpx::shared_future<Result1>> workitems;
+                workitems.reserve(num_chunks + 1);
+                workitems.push_back(hpx::make_ready_future(init_value));
+                for (std::size_t chunk = 0; chunk != num_chunks; ++chunk)
+                {
+                    chunk_state& state = chunks[chunk];
+                    if (state.status_.load(std::memory_order_relaxed) ==
+                        scan_chunk_prefix)
+                    {
+                        workitems.push_back(
+                            hpx::make_ready_future(*state.prefix_));
+                    }
+                    else
+                    {
+                        workitems.push_back(
+                            hpx::make_exceptional_future<Result1>(
+                                state.error_));
+                    }
+                }
+
+                return reduce(
+                    std::move(workitems), std::move(finalitems), std::move(errors),
+                    std::forward<F4>(f4));
+#endif
+            }
+
             template <typename F>
             static R reduce(
                 std::vector<hpx::shared_future<Result1>>&& workitems,
@@ -374,7 +718,9 @@ namespace hpx { namespace parallel { namespace util
     // R:           overall result type
     // Result1:     intermediate result type of first and second step
     // Result2:     intermediate result of the third step
-    // ScanPartTag: select appropriate policy of scan partitioner
+    // ScanPartTag: select appropriate policy of scan partitioner, the normal
+    //              tag selects the single-pass scan for large random access
+    //              sequences
     template <typename ExPolicy, typename R = void, typename Result1 = R,
         typename Result2 = void,
         typename ScanPartTag = scan_partitioner_normal_tag>
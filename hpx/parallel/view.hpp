@@ -0,0 +1,410 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file parallel/view.hpp
+
+#if !defined(HPX_PARALLEL_VIEW_HPP)
+#define HPX_PARALLEL_VIEW_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/traits/is_range.hpp>
+#include <hpx/util/counting_iterator.hpp>
+#include <hpx/util/decay.hpp>
+#include <hpx/util/filter_iterator.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/iterator_range.hpp>
+#include <hpx/util/optional.hpp>
+#include <hpx/util/range.hpp>
+#include <hpx/util/tagged_pair.hpp>
+#include <hpx/util/transform_iterator.hpp>
+#include <hpx/util/zip_iterator.hpp>
+
+#include <hpx/parallel/tagspec.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+// The views defined here are lazy range adaptors. They don't own or copy any
+// elements, the elements of a view are computed from the elements of the
+// underlying ranges (which have to outlive the view) whenever they are
+// accessed. This allows to pass a whole pipeline of transformations to a
+// single parallel algorithm which then runs as one fused partitioned loop.
+//
+// The views created by iota, transform, zip and enumerate from random access
+// ranges are random access ranges themselves and can be used with all
+// parallel algorithms (and with for_loop through their iterators). A view
+// created by filter is a forward range. The parallel algorithms which are
+// specialized for filtered ranges (for_each, copy, copy_if, remove_copy,
+// remove_copy_if, count, count_if and reduce) partition the underlying range
+// instead and apply the filter predicate while processing the elements.
+namespace hpx { namespace parallel { inline namespace v1 { namespace view
+{
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // Stores a function object in a way which keeps the iterators
+        // referring to it copy-assignable, even if the function object is
+        // not (as it is the case for lambdas).
+        template <typename F>
+        class function_box
+        {
+        public:
+            function_box() {}
+
+            explicit function_box(F const& f)
+            {
+                f_.emplace(f);
+            }
+
+            explicit function_box(F && f)
+            {
+                f_.emplace(std::move(f));
+            }
+
+            function_box(function_box const& rhs)
+              : f_(rhs.f_)
+            {}
+
+            function_box& operator=(function_box const& rhs)
+            {
+                if (this != &rhs)
+                {
+                    if (rhs.f_)
+                        f_.emplace(*rhs.f_);
+                    else
+                        f_ = hpx::util::nullopt;
+                }
+                return *this;
+            }
+
+            template <typename ... Ts>
+            HPX_FORCEINLINE auto operator()(Ts &&... ts) const
+            ->  decltype(hpx::util::invoke(
+                    std::declval<F const&>(), std::forward<Ts>(ts)...))
+            {
+                return hpx::util::invoke(*f_, std::forward<Ts>(ts)...);
+            }
+
+        private:
+            hpx::util::optional<F> f_;
+        };
+
+        // hpx::util::transform_iterator invokes the transformer with the
+        // underlying iterator
+        template <typename F>
+        struct transform_view_op
+        {
+            transform_view_op() {}
+
+            explicit transform_view_op(F const& f)
+              : f_(f)
+            {}
+
+            template <typename Iter>
+            HPX_FORCEINLINE auto operator()(Iter const& it) const
+            ->  decltype(hpx::util::invoke(std::declval<F const&>(), *it))
+            {
+                return f_(*it);
+            }
+
+            function_box<F> f_;
+        };
+
+        template <typename Iter>
+        std::size_t range_size(Iter first, Iter last)
+        {
+            return static_cast<std::size_t>(std::distance(first, last));
+        }
+        /// \endcond
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A forward range consisting of the elements of an underlying range
+    /// [first, last) for which a predicate returns true.
+    template <typename Iter, typename Pred>
+    class filtered_range
+    {
+    public:
+        typedef detail::function_box<Pred> predicate_type;
+        typedef hpx::util::filter_iterator<Iter, predicate_type> iterator;
+        typedef Iter base_iterator;
+
+        filtered_range(Iter first, Iter last, Pred const& pred)
+          : first_(first), last_(last), pred_(pred)
+        {}
+
+        iterator begin() const
+        {
+            return iterator(first_, last_, pred_);
+        }
+
+        iterator end() const
+        {
+            return iterator(last_, last_, pred_);
+        }
+
+        /// Returns an iterator to the beginning of the underlying range
+        Iter base_begin() const
+        {
+            return first_;
+        }
+
+        /// Returns an iterator to the end of the underlying range
+        Iter base_end() const
+        {
+            return last_;
+        }
+
+        predicate_type const& predicate() const
+        {
+            return pred_;
+        }
+
+        /// Returns the iterator of this range which corresponds to the given
+        /// position in the underlying range.
+        iterator make_iterator(Iter it) const
+        {
+            return iterator(it, last_, pred_);
+        }
+
+    private:
+        Iter first_;
+        Iter last_;
+        predicate_type pred_;
+    };
+
+    namespace detail
+    {
+        /// \cond NOINTERNAL
+
+        // The function objects below are used by the parallel algorithms to
+        // process the underlying range of a filtered range.
+        template <typename Pred, typename F, typename Proj>
+        struct filtered_function
+        {
+            Pred pred_;
+            F f_;
+            Proj proj_;
+
+            template <typename T>
+            HPX_FORCEINLINE void operator()(T && t)
+            {
+                if (hpx::util::invoke(pred_, t))
+                {
+                    hpx::util::invoke(f_,
+                        hpx::util::invoke(proj_, std::forward<T>(t)));
+                }
+            }
+        };
+
+        // matches the elements which pass the filter and for which f
+        // returns Keep
+        template <typename Pred, typename F, typename Proj, bool Keep = true>
+        struct filtered_predicate
+        {
+            Pred pred_;
+            F f_;
+            Proj proj_;
+
+            template <typename T>
+            HPX_FORCEINLINE bool operator()(T && t) const
+            {
+                return hpx::util::invoke(pred_, t) &&
+                    static_cast<bool>(hpx::util::invoke(f_,
+                        hpx::util::invoke(proj_, std::forward<T>(t)))) == Keep;
+            }
+        };
+
+        // Reductions of filtered ranges combine optional values, the elements
+        // which don't pass the filter are mapped to empty values.
+        template <typename Pred, typename T>
+        struct filtered_value
+        {
+            Pred pred_;
+
+            template <typename U>
+            HPX_FORCEINLINE hpx::util::optional<T> operator()(U && u) const
+            {
+                if (!hpx::util::invoke(pred_, u))
+                    return hpx::util::optional<T>();
+                return hpx::util::optional<T>(T(std::forward<U>(u)));
+            }
+        };
+
+        template <typename F, typename T>
+        struct filtered_reduction
+        {
+            F f_;
+
+            hpx::util::optional<T> operator()(hpx::util::optional<T> const& lhs,
+                hpx::util::optional<T> const& rhs) const
+            {
+                if (!lhs)
+                    return rhs;
+                if (!rhs)
+                    return lhs;
+                return hpx::util::optional<T>(
+                    T(hpx::util::invoke(f_, *lhs, *rhs)));
+            }
+        };
+
+        template <typename T>
+        struct filtered_reduction_result
+        {
+            T operator()(hpx::util::optional<T> value) const
+            {
+                return std::move(*value);
+            }
+        };
+
+        // converts the results of the algorithms (which refer to the
+        // underlying range) to the iterator type of the filtered range
+        template <typename Range>
+        struct filtered_iterator_conv
+        {
+            typedef typename Range::iterator iterator;
+            typedef typename Range::base_iterator base_iterator;
+
+            Range rng_;
+
+            iterator operator()(base_iterator const& it) const
+            {
+                return rng_.make_iterator(it);
+            }
+
+            template <typename OutIter>
+            hpx::util::tagged_pair<tag::in(iterator), tag::out(OutIter)>
+            operator()(hpx::util::tagged_pair<
+                tag::in(base_iterator), tag::out(OutIter)> const& p) const
+            {
+                return hpx::util::make_tagged_pair<tag::in, tag::out>(
+                    rng_.make_iterator(p.in()), p.out());
+            }
+        };
+        /// \endcond
+    }
+
+    /// \cond NOINTERNAL
+    template <typename T>
+    struct is_filtered_range_impl
+      : std::false_type
+    {};
+
+    template <typename Iter, typename Pred>
+    struct is_filtered_range_impl<filtered_range<Iter, Pred> >
+      : std::true_type
+    {};
+    /// \endcond
+
+    /// Evaluates to true if the given type is a range created by view::filter.
+    template <typename T>
+    struct is_filtered_range
+      : is_filtered_range_impl<typename hpx::util::decay<T>::type>
+    {};
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Returns a random access range of the values in [first, last).
+    template <typename T>
+    hpx::util::iterator_range<hpx::util::counting_iterator<T> >
+    iota(T first, T last)
+    {
+        return hpx::util::make_iterator_range(
+            hpx::util::make_counting_iterator(first),
+            hpx::util::make_counting_iterator(last));
+    }
+
+    /// Returns a range of the results of invoking \a f with the elements of
+    /// \a rng. The function is invoked every time an element is accessed.
+    template <typename Rng, typename F>
+    typename std::enable_if<
+        hpx::traits::is_range<Rng>::value,
+        hpx::util::iterator_range<
+            hpx::util::transform_iterator<
+                typename hpx::traits::range_iterator<Rng>::type,
+                detail::transform_view_op<typename hpx::util::decay<F>::type>
+            >
+        >
+    >::type
+    transform(Rng && rng, F && f)
+    {
+        typedef detail::transform_view_op<typename hpx::util::decay<F>::type>
+            transformer;
+        transformer op(f);
+
+        return hpx::util::make_iterator_range(
+            hpx::util::make_transform_iterator(hpx::util::begin(rng), op),
+            hpx::util::make_transform_iterator(hpx::util::end(rng), op));
+    }
+
+    /// Returns a range of the elements of \a rng for which \a pred returns
+    /// true.
+    template <typename Rng, typename Pred>
+    typename std::enable_if<
+        hpx::traits::is_range<Rng>::value,
+        filtered_range<
+            typename hpx::traits::range_iterator<Rng>::type,
+            typename hpx::util::decay<Pred>::type
+        >
+    >::type
+    filter(Rng && rng, Pred && pred)
+    {
+        typedef filtered_range<
+                typename hpx::traits::range_iterator<Rng>::type,
+                typename hpx::util::decay<Pred>::type
+            > result_type;
+
+        return result_type(hpx::util::begin(rng), hpx::util::end(rng), pred);
+    }
+
+    /// Returns a range of tuples, the n-th tuple refers to the n-th elements
+    /// of all given ranges. The resulting range is as long as the shortest
+    /// of the given ranges.
+    template <typename Rng, typename ... Rngs>
+    hpx::util::iterator_range<
+        hpx::util::zip_iterator<
+            typename hpx::traits::range_iterator<Rng>::type,
+            typename hpx::traits::range_iterator<Rngs>::type...
+        >
+    >
+    zip(Rng && rng, Rngs &&... rngs)
+    {
+        std::size_t size = detail::range_size(
+            hpx::util::begin(rng), hpx::util::end(rng));
+
+        int const sizes[] = { 0, (size = (std::min)(size, detail::range_size(
+            hpx::util::begin(rngs), hpx::util::end(rngs))), 0)... };
+        (void) sizes;
+
+        return hpx::util::make_iterator_range(
+            hpx::util::make_zip_iterator(
+                hpx::util::begin(rng), hpx::util::begin(rngs)...),
+            hpx::util::make_zip_iterator(
+                std::next(hpx::util::begin(rng), size),
+                std::next(hpx::util::begin(rngs), size)...));
+    }
+
+    /// Returns a range of pairs (as tuples) of the position and the
+    /// corresponding element of \a rng.
+    template <typename Rng>
+    hpx::util::iterator_range<
+        hpx::util::zip_iterator<
+            hpx::util::counting_iterator<std::size_t>,
+            typename hpx::traits::range_iterator<Rng>::type
+        >
+    >
+    enumerate(Rng && rng)
+    {
+        std::size_t size = detail::range_size(
+            hpx::util::begin(rng), hpx::util::end(rng));
+
+        return view::zip(view::iota(std::size_t(0), size), rng);
+    }
+}}}}
+
+#endif
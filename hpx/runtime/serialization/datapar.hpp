@@ -12,6 +12,7 @@
 
 #include <hpx/runtime/serialization/detail/vc.hpp>
 #include <hpx/runtime/serialization/detail/boost_simd.hpp>
+#include <hpx/runtime/serialization/detail/builtin_simd.hpp>
 
 #endif
 #endif
@@ -0,0 +1,52 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_SERIALIZE_DATAPAR_BUILTIN_JUL_16_2019_1130AM)
+#define HPX_SERIALIZE_DATAPAR_BUILTIN_JUL_16_2019_1130AM
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_DATAPAR_BUILTIN)
+#include <hpx/parallel/datapar/simd.hpp>
+#include <hpx/runtime/serialization/array.hpp>
+#include <hpx/runtime/serialization/serialize.hpp>
+#include <hpx/traits/is_bitwise_serializable.hpp>
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+///////////////////////////////////////////////////////////////////////////////
+namespace hpx { namespace serialization
+{
+    template <typename T, std::size_t N>
+    void serialize(input_archive & ar, parallel::simd::pack<T, N>& v, unsigned)
+    {
+        std::array<T, N> data;
+        ar & data;
+        v = parallel::simd::pack<T, N>(
+            data.data(), parallel::simd::element_aligned);
+    }
+
+    template <typename T, std::size_t N>
+    void serialize(output_archive & ar, parallel::simd::pack<T, N> const& v,
+        unsigned)
+    {
+        std::array<T, N> data;
+        v.copy_to(data.data(), parallel::simd::element_aligned);
+        ar & data;
+    }
+}}
+
+namespace hpx { namespace traits
+{
+    template <typename T, std::size_t N>
+    struct is_bitwise_serializable<parallel::simd::pack<T, N> >
+      : is_bitwise_serializable<typename std::remove_const<T>::type>
+    {};
+}}
+
+#endif
+#endif
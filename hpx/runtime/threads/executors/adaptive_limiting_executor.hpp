@@ -0,0 +1,352 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef HPX_RUNTIME_THREADS_ADAPTIVE_LIMITING_EXECUTOR_HPP
+#define HPX_RUNTIME_THREADS_ADAPTIVE_LIMITING_EXECUTOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/parallel/executors/execution.hpp>
+#include <hpx/parallel/executors/execution_fwd.hpp>
+#include <hpx/parallel/executors/parallel_executor.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/high_resolution_clock.hpp>
+#include <hpx/util/invoke_fused.hpp>
+#include <hpx/util/tuple.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace threads { namespace executors
+{
+    ///////////////////////////////////////////////////////////////////////////
+    /// The adaptive_limiter keeps track of the number of tasks in flight and
+    /// adjusts the number of tasks allowed to be in flight concurrently based
+    /// on the measured latency of the tasks.
+    ///
+    /// The limit is adapted using the approach of TCP Vegas: the minimal
+    /// observed task latency approximates the latency of a task which didn't
+    /// have to wait for being scheduled. The difference between the expected
+    /// throughput (limit / min_latency) and the actual throughput (limit /
+    /// latency) gives an estimate for the number of tasks which are queued
+    /// without doing useful work. The limit is increased if this estimate is
+    /// small and decreased if it is large.
+    class HPX_EXPORT adaptive_limiter
+      : public std::enable_shared_from_this<adaptive_limiter>
+    {
+    public:
+        adaptive_limiter(std::size_t initial_limit, std::size_t min_limit,
+            std::size_t max_limit);
+
+        /// Removes the performance counter types installed by
+        /// register_counters.
+        ~adaptive_limiter();
+
+        /// Install the performance counters exposing the state of this
+        /// limiter. The counter instances are named:
+        ///
+        ///   /adaptive_limiting_executor{locality#N/total}/<name>/limit
+        ///   /adaptive_limiting_executor{locality#N/total}/<name>/queueing-delay
+        ///   /adaptive_limiting_executor{locality#N/total}/<name>/count/in-flight
+        ///
+        /// \throws hpx::exception (bad_parameter) if counters with the same
+        ///         name are installed already.
+        void register_counters(std::string const& name);
+
+        /// Wait until another task is allowed to be in flight, and account
+        /// for it.
+        void acquire();
+
+        /// Account for a finished task.
+        ///
+        /// \param delay    [in] The time (in nanoseconds) the task was
+        ///                 waiting to be executed after it was submitted.
+        /// \param latency  [in] The time (in nanoseconds) it took from
+        ///                 submitting the task up to its completion.
+        void release(std::uint64_t delay, std::uint64_t latency);
+
+        /// Give back the slot acquired for a task which could not be
+        /// submitted, without taking a measurement.
+        void release();
+
+        /// Wait for all tasks in flight to finish.
+        void wait() const;
+
+        /// The number of tasks currently allowed to be in flight
+        std::int64_t limit() const
+        {
+            return limit_.load(std::memory_order_relaxed);
+        }
+
+        /// The number of tasks currently in flight
+        std::int64_t in_flight() const
+        {
+            return in_flight_.load(std::memory_order_relaxed);
+        }
+
+        /// The average time (in nanoseconds) tasks were waiting to be
+        /// executed, measured over the last sampling window.
+        std::int64_t queueing_delay() const
+        {
+            return queueing_delay_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        void update_limit();
+
+        void install_counter_type(std::string const& name,
+            util::function_nonser<std::int64_t(bool)> const& counter_value,
+            std::string const& helptext, std::string const& uom);
+
+        std::int64_t const min_limit_;
+        std::int64_t const max_limit_;
+
+        std::atomic<std::int64_t> limit_;
+        std::atomic<std::int64_t> in_flight_;
+        std::atomic<std::int64_t> max_in_flight_;
+        std::atomic<std::int64_t> queueing_delay_;
+
+        // statistics of the current sampling window
+        std::atomic<std::uint64_t> samples_;
+        std::atomic<std::uint64_t> sum_delay_;
+        std::atomic<std::uint64_t> sum_latency_;
+        std::atomic<std::uint64_t> min_latency_;
+        std::atomic<std::uint64_t> windows_;
+        std::atomic<bool> updating_;
+
+        // the names of the installed performance counter types
+        std::vector<std::string> counter_types_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// The adaptive_limiting_executor wraps another executor and limits the
+    /// number of tasks scheduled through it which are in flight at the same
+    /// time, similar to the limiting_executor. The difference is that the
+    /// limit is not given by the user, but is adjusted at runtime based on
+    /// the measured throughput and latency of the tasks, which keeps the
+    /// amount of outstanding work bounded without any per machine tuning.
+    /// Any thread submitting work is suspended while the number of tasks in
+    /// flight exceeds the current limit.
+    template <typename Executor = parallel::execution::parallel_executor>
+    class adaptive_limiting_executor
+    {
+    private:
+        template <typename F, typename Args>
+        struct measured_call
+        {
+            typedef typename util::detail::invoke_fused_result<
+                    F, Args
+                >::type result_type;
+
+            struct release_on_exit
+            {
+                release_on_exit(adaptive_limiter& limiter,
+                        std::uint64_t submitted, std::uint64_t started)
+                  : limiter_(limiter), submitted_(submitted), started_(started)
+                {}
+
+                ~release_on_exit()
+                {
+                    std::uint64_t const finished =
+                        util::high_resolution_clock::now();
+                    limiter_.release(started_ - submitted_,
+                        finished - submitted_);
+                }
+
+                adaptive_limiter& limiter_;
+                std::uint64_t submitted_;
+                std::uint64_t started_;
+            };
+
+            result_type operator()()
+            {
+                release_on_exit on_exit(*limiter_, submitted_,
+                    util::high_resolution_clock::now());
+                return util::invoke_fused(std::move(f_), std::move(args_));
+            }
+
+            std::shared_ptr<adaptive_limiter> limiter_;
+            std::uint64_t submitted_;
+            F f_;
+            Args args_;
+        };
+
+        template <typename F, typename ...Ts>
+        measured_call<
+            typename std::decay<F>::type,
+            util::tuple<typename std::decay<Ts>::type...>
+        >
+        make_measured_call(F && f, Ts &&... ts)
+        {
+            measured_call<
+                    typename std::decay<F>::type,
+                    util::tuple<typename std::decay<Ts>::type...>
+                > call = {
+                    limiter_, util::high_resolution_clock::now(),
+                    std::forward<F>(f),
+                    util::make_tuple(std::forward<Ts>(ts)...)
+                };
+            return call;
+        }
+
+        // acquires a slot and gives it back unless the task was handed off
+        // to the wrapped executor, which is responsible for it from then on
+        struct submission_guard
+        {
+            explicit submission_guard(adaptive_limiter& limiter)
+              : limiter_(&limiter)
+            {
+                limiter_->acquire();
+            }
+
+            ~submission_guard()
+            {
+                if (limiter_ != nullptr)
+                    limiter_->release();
+            }
+
+            void dismiss()
+            {
+                limiter_ = nullptr;
+            }
+
+            adaptive_limiter* limiter_;
+        };
+
+    public:
+        /// \brief Create a new adaptive limiting executor
+        ///
+        /// \param initial_limit [in] The number of tasks allowed to be in
+        ///                 flight initially.
+        /// \param min_limit [in] The lower bound of the adapted limit.
+        /// \param max_limit [in] The upper bound of the adapted limit.
+        /// \param name     [in] If not empty, performance counters exposing
+        ///                 the state of this executor are installed using
+        ///                 this name as their instance name.
+        /// \param block_on_destruction [in] Wait for all tasks in flight to
+        ///                 finish when the executor is destroyed.
+        adaptive_limiting_executor(std::size_t initial_limit = 64,
+                std::size_t min_limit = 1, std::size_t max_limit = 65536,
+                std::string const& name = "", bool block_on_destruction = true)
+          : executor_(Executor())
+          , limiter_(std::make_shared<adaptive_limiter>(
+                initial_limit, min_limit, max_limit))
+          , block_(block_on_destruction)
+        {
+            if (!name.empty())
+                limiter_->register_counters(name);
+        }
+
+        adaptive_limiting_executor(Executor const& ex,
+                std::size_t initial_limit = 64, std::size_t min_limit = 1,
+                std::size_t max_limit = 65536, std::string const& name = "",
+                bool block_on_destruction = true)
+          : executor_(ex)
+          , limiter_(std::make_shared<adaptive_limiter>(
+                initial_limit, min_limit, max_limit))
+          , block_(block_on_destruction)
+        {
+            if (!name.empty())
+                limiter_->register_counters(name);
+        }
+
+        ~adaptive_limiting_executor()
+        {
+            if (block_)
+                wait();
+        }
+
+        // --------------------------------------------------------------------
+        // post : for general apply()
+        // --------------------------------------------------------------------
+        template <typename F, typename ... Ts>
+        void post(F && f, Ts &&... ts)
+        {
+            submission_guard guard(*limiter_);
+            parallel::execution::post(executor_,
+                make_measured_call(std::forward<F>(f), std::forward<Ts>(ts)...));
+            guard.dismiss();
+        }
+
+        // --------------------------------------------------------------------
+        // async_execute : for general async()
+        // --------------------------------------------------------------------
+        template <typename F, typename ... Ts>
+        hpx::future<
+            typename util::detail::invoke_deferred_result<F, Ts...>::type>
+        async_execute(F && f, Ts &&... ts)
+        {
+            submission_guard guard(*limiter_);
+            auto result = parallel::execution::async_execute(executor_,
+                make_measured_call(std::forward<F>(f), std::forward<Ts>(ts)...));
+            guard.dismiss();
+            return result;
+        }
+
+        /// Wait for all tasks in flight to finish
+        void wait() const
+        {
+            limiter_->wait();
+        }
+
+        /// The number of tasks currently allowed to be in flight
+        std::int64_t get_limit() const
+        {
+            return limiter_->limit();
+        }
+
+        /// The number of tasks currently in flight
+        std::int64_t get_in_flight() const
+        {
+            return limiter_->in_flight();
+        }
+
+        /// The average time (in nanoseconds) tasks were waiting to be
+        /// executed, measured over the last sampling window
+        std::int64_t get_queueing_delay() const
+        {
+            return limiter_->queueing_delay();
+        }
+
+    private:
+        Executor executor_;
+        std::shared_ptr<adaptive_limiter> limiter_;
+        bool block_;
+    };
+}}}
+
+namespace hpx { namespace parallel { namespace execution
+{
+    template <typename Executor>
+    struct executor_execution_category<
+        threads::executors::adaptive_limiting_executor<Executor> >
+    {
+        typedef parallel::execution::parallel_execution_tag type;
+    };
+
+    template <typename Executor>
+    struct is_one_way_executor<
+            threads::executors::adaptive_limiting_executor<Executor> >
+      : std::true_type
+    {};
+
+    template <typename Executor>
+    struct is_two_way_executor<
+            threads::executors::adaptive_limiting_executor<Executor> >
+      : std::true_type
+    {};
+}}}
+
+#include <hpx/config/warnings_suffix.hpp>
+
+#endif /*HPX_RUNTIME_THREADS_ADAPTIVE_LIMITING_EXECUTOR_HPP*/
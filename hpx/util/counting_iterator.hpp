@@ -0,0 +1,88 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_COUNTING_ITERATOR_HPP)
+#define HPX_UTIL_COUNTING_ITERATOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/iterator_facade.hpp>
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A random access iterator which refers to a (conceptual) sequence of
+    // consecutive integral values. Dereferencing it returns the current value
+    // (by value), no memory is associated with the sequence.
+    template <typename Incrementable>
+    class counting_iterator
+      : public iterator_facade<
+            counting_iterator<Incrementable>, Incrementable,
+            std::random_access_iterator_tag, Incrementable, std::ptrdiff_t
+        >
+    {
+        static_assert(std::is_integral<Incrementable>::value,
+            "counting_iterator requires an integral value type");
+
+    public:
+        HPX_HOST_DEVICE counting_iterator()
+          : value_()
+        {}
+
+        HPX_HOST_DEVICE explicit counting_iterator(Incrementable value)
+          : value_(value)
+        {}
+
+    private:
+        friend class hpx::util::iterator_core_access;
+
+        HPX_HOST_DEVICE bool equal(counting_iterator const& other) const
+        {
+            return value_ == other.value_;
+        }
+
+        HPX_HOST_DEVICE Incrementable dereference() const
+        {
+            return value_;
+        }
+
+        HPX_HOST_DEVICE void increment()
+        {
+            ++value_;
+        }
+
+        HPX_HOST_DEVICE void decrement()
+        {
+            --value_;
+        }
+
+        HPX_HOST_DEVICE void advance(std::ptrdiff_t n)
+        {
+            value_ = static_cast<Incrementable>(value_ + n);
+        }
+
+        HPX_HOST_DEVICE
+        std::ptrdiff_t distance_to(counting_iterator const& other) const
+        {
+            return static_cast<std::ptrdiff_t>(other.value_) -
+                static_cast<std::ptrdiff_t>(value_);
+        }
+
+        Incrementable value_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Incrementable>
+    HPX_HOST_DEVICE inline counting_iterator<Incrementable>
+    make_counting_iterator(Incrementable value)
+    {
+        return counting_iterator<Incrementable>(value);
+    }
+}}
+
+#endif
@@ -0,0 +1,83 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#if !defined(HPX_UTIL_FILTER_ITERATOR_HPP)
+#define HPX_UTIL_FILTER_ITERATOR_HPP
+
+#include <hpx/config.hpp>
+#include <hpx/util/invoke.hpp>
+#include <hpx/util/iterator_adaptor.hpp>
+
+#include <iterator>
+
+namespace hpx { namespace util
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // A forward iterator which skips all elements of the underlying sequence
+    // [it, end) for which the predicate returns false.
+    template <typename Iterator, typename Pred>
+    class filter_iterator
+      : public iterator_adaptor<
+            filter_iterator<Iterator, Pred>, Iterator, void,
+            std::forward_iterator_tag
+        >
+    {
+    private:
+        typedef iterator_adaptor<
+                filter_iterator<Iterator, Pred>, Iterator, void,
+                std::forward_iterator_tag
+            > base_type;
+
+    public:
+        filter_iterator() {}
+
+        filter_iterator(Iterator const& it, Iterator const& end,
+                Pred const& pred)
+          : base_type(it), end_(end), pred_(pred)
+        {
+            satisfy_predicate();
+        }
+
+        Iterator const& end() const
+        {
+            return end_;
+        }
+
+        Pred const& predicate() const
+        {
+            return pred_;
+        }
+
+    private:
+        friend class hpx::util::iterator_core_access;
+
+        void increment()
+        {
+            ++this->base_reference();
+            satisfy_predicate();
+        }
+
+        void satisfy_predicate()
+        {
+            Iterator& it = this->base_reference();
+            while (it != end_ && !hpx::util::invoke(pred_, *it))
+                ++it;
+        }
+
+        Iterator end_;
+        Pred pred_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Pred, typename Iterator>
+    inline filter_iterator<Iterator, Pred>
+    make_filter_iterator(Pred const& pred, Iterator const& it,
+        Iterator const& end)
+    {
+        return filter_iterator<Iterator, Pred>(it, end, pred);
+    }
+}}
+
+#endif
@@ -0,0 +1,445 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/plain_action.hpp>
+#include <hpx/runtime/basename_registration.hpp>
+#include <hpx/runtime/find_here.hpp>
+#include <hpx/runtime/get_locality_id.hpp>
+#include <hpx/runtime/get_num_localities.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/naming/name.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/jenkins_hash.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail
+{
+    ///////////////////////////////////////////////////////////////////////////
+    // The messages received by, or expected at, a single site. A message is
+    // stored until it is requested, or the request is stored until the
+    // message arrives, whatever happens first.
+    class communicator_mailbox
+    {
+        typedef lcos::local::spinlock mutex_type;
+        typedef communicator::buffer_type buffer_type;
+
+        struct message_key
+        {
+            std::size_t generation_;
+            std::size_t tag_;
+            std::size_t from_;
+
+            friend bool operator<(message_key const& lhs,
+                message_key const& rhs)
+            {
+                if (lhs.generation_ != rhs.generation_)
+                    return lhs.generation_ < rhs.generation_;
+                if (lhs.tag_ != rhs.tag_)
+                    return lhs.tag_ < rhs.tag_;
+                return lhs.from_ < rhs.from_;
+            }
+        };
+
+        struct entry
+        {
+            lcos::local::promise<buffer_type> promise_;
+            bool value_set_;
+        };
+
+        typedef std::map<message_key, entry> entries_type;
+
+    public:
+        void set(std::size_t generation, std::size_t tag, std::size_t from,
+            buffer_type && data)
+        {
+            message_key key = { generation, tag, from };
+
+            std::unique_lock<mutex_type> l(mtx_);
+            entries_type::iterator it = entries_.find(key);
+            if (it == entries_.end())
+            {
+                // nobody is waiting for this message yet
+                entry& e = entries_[key];
+                e.value_set_ = true;
+                e.promise_.set_value(std::move(data));
+                return;
+            }
+
+            HPX_ASSERT(!it->second.value_set_);
+
+            // somebody is waiting for this message, notify it outside of
+            // the lock
+            lcos::local::promise<buffer_type> p(
+                std::move(it->second.promise_));
+            entries_.erase(it);
+            l.unlock();
+
+            p.set_value(std::move(data));
+        }
+
+        hpx::future<buffer_type> get(std::size_t generation, std::size_t tag,
+            std::size_t from)
+        {
+            message_key key = { generation, tag, from };
+
+            std::lock_guard<mutex_type> l(mtx_);
+            entries_type::iterator it = entries_.find(key);
+            if (it == entries_.end())
+            {
+                entry& e = entries_[key];
+                e.value_set_ = false;
+                return e.promise_.get_future();
+            }
+
+            // the message has already arrived
+            HPX_ASSERT(it->second.value_set_);
+            hpx::future<buffer_type> f = it->second.promise_.get_future();
+            entries_.erase(it);
+            return f;
+        }
+
+    private:
+        mutex_type mtx_;
+        entries_type entries_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Messages refer to the name of a communicator by a hash value of it.
+    static std::uint64_t get_communicator_id(std::string const& name)
+    {
+        typedef util::jenkins_hash hash_type;
+        return (std::uint64_t(hash_type(0, hash_type::seed)(name)) << 32) |
+            hash_type(1, hash_type::seed)(name);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All mailboxes of the sites located on this locality. Messages may
+    // arrive before the communicator of the receiving site was created, in
+    // which case the mailbox is created on first use.
+    //
+    // All sites create the communicators with the same name in the same
+    // order, the n-th communicator of a site with a given name is its n-th
+    // incarnation. Messages arriving after the receiving incarnation was
+    // destroyed are dropped.
+    class communicator_mailboxes
+    {
+        typedef lcos::local::spinlock mutex_type;
+
+        struct mailbox_key
+        {
+            std::uint64_t id_;
+            std::size_t site_;
+            std::size_t incarnation_;
+
+            friend bool operator<(mailbox_key const& lhs,
+                mailbox_key const& rhs)
+            {
+                if (lhs.id_ != rhs.id_)
+                    return lhs.id_ < rhs.id_;
+                if (lhs.site_ != rhs.site_)
+                    return lhs.site_ < rhs.site_;
+                return lhs.incarnation_ < rhs.incarnation_;
+            }
+        };
+
+        struct site_entry
+        {
+            site_entry()
+              : incarnations_(0)
+            {}
+
+            std::string name_;
+            std::size_t incarnations_;
+            std::set<std::size_t> alive_;
+        };
+
+        typedef std::pair<std::uint64_t, std::size_t> site_key;
+
+    public:
+        // create the mailbox of a new incarnation of the given site
+        std::shared_ptr<communicator_mailbox> attach(std::uint64_t id,
+            std::string const& name, std::size_t site,
+            std::size_t& incarnation)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            site_entry& e = sites_[site_key(id, site)];
+            if (e.name_.empty())
+            {
+                e.name_ = name;
+            }
+            else if (e.name_ != name)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::lcos::communicator::communicator",
+                    "the name of the communicator conflicts with the name "
+                    "of another communicator: " + name + ", " + e.name_);
+            }
+
+            incarnation = ++e.incarnations_;
+            e.alive_.insert(incarnation);
+
+            std::shared_ptr<communicator_mailbox>& mb =
+                mailboxes_[mailbox_key{id, site, incarnation}];
+            if (!mb)
+                mb = std::make_shared<communicator_mailbox>();
+            return mb;
+        }
+
+        void detach(std::uint64_t id, std::size_t site,
+            std::size_t incarnation)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            mailboxes_.erase(mailbox_key{id, site, incarnation});
+            sites_[site_key(id, site)].alive_.erase(incarnation);
+        }
+
+        // return the mailbox a message should be delivered to, or an empty
+        // pointer if the receiving incarnation was destroyed already
+        std::shared_ptr<communicator_mailbox> get(std::uint64_t id,
+            std::size_t site, std::size_t incarnation)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+
+            auto it = sites_.find(site_key(id, site));
+            if (it != sites_.end() &&
+                incarnation <= it->second.incarnations_ &&
+                it->second.alive_.count(incarnation) == 0)
+            {
+                return std::shared_ptr<communicator_mailbox>();
+            }
+
+            std::shared_ptr<communicator_mailbox>& mb =
+                mailboxes_[mailbox_key{id, site, incarnation}];
+            if (!mb)
+                mb = std::make_shared<communicator_mailbox>();
+            return mb;
+        }
+
+    private:
+        mutex_type mtx_;
+        std::map<mailbox_key, std::shared_ptr<communicator_mailbox> >
+            mailboxes_;
+        std::map<site_key, site_entry> sites_;
+    };
+
+    static communicator_mailboxes& get_communicator_mailboxes()
+    {
+        static communicator_mailboxes mailboxes;
+        return mailboxes;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void communicator_set(std::uint64_t id, std::size_t site,
+        std::size_t incarnation, std::size_t generation, std::size_t tag,
+        std::size_t from, communicator::buffer_type data)
+    {
+        std::shared_ptr<communicator_mailbox> mb =
+            get_communicator_mailboxes().get(id, site, incarnation);
+        if (mb)
+            mb->set(generation, tag, from, std::move(data));
+    }
+}}}
+
+HPX_PLAIN_ACTION(hpx::lcos::detail::communicator_set,
+    hpx_lcos_communicator_set_action);
+
+namespace hpx { namespace lcos
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        struct communicator_data
+        {
+            communicator_data(std::string const& name,
+                    std::vector<hpx::id_type> && localities,
+                    std::size_t this_site, bool registered)
+              : name_(name)
+              , id_(get_communicator_id(name))
+              , localities_(std::move(localities))
+              , this_site_(this_site)
+              , registered_(registered)
+              , generation_(0)
+              , mailbox_(get_communicator_mailboxes().attach(
+                    id_, name, this_site, incarnation_))
+            {
+                hpx::id_type const here = hpx::find_here();
+
+                is_local_.reserve(localities_.size());
+                for (hpx::id_type const& id : localities_)
+                    is_local_.push_back(id == here);
+            }
+
+            ~communicator_data()
+            {
+                get_communicator_mailboxes().detach(
+                    id_, this_site_, incarnation_);
+                if (registered_)
+                    hpx::unregister_with_basename(name_, this_site_);
+            }
+
+            std::string const name_;
+            std::uint64_t const id_;
+            std::vector<hpx::id_type> const localities_;
+            std::vector<bool> is_local_;
+            std::size_t const this_site_;
+            bool const registered_;
+            std::atomic<std::size_t> generation_;
+            std::size_t incarnation_;
+            std::shared_ptr<communicator_mailbox> mailbox_;
+        };
+
+        static void check_site(std::size_t site, std::size_t num_sites,
+            char const* function)
+        {
+            if (site >= num_sites)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, function,
+                    "the given site is out of range: " +
+                    std::to_string(site) + " (number of sites: " +
+                    std::to_string(num_sites) + ")");
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    communicator::communicator(std::string const& basename)
+    {
+        std::uint32_t const num_sites =
+            hpx::get_num_localities(hpx::launch::sync);
+
+        std::vector<hpx::id_type> localities;
+        localities.reserve(num_sites);
+        for (std::uint32_t i = 0; i != num_sites; ++i)
+            localities.push_back(naming::get_id_from_locality_id(i));
+
+        data_ = std::make_shared<detail::communicator_data>(basename,
+            std::move(localities), hpx::get_locality_id(), false);
+    }
+
+    communicator::communicator(std::string const& basename,
+        std::size_t num_sites, std::size_t this_site)
+    {
+        detail::check_site(this_site, num_sites,
+            "hpx::lcos::communicator::communicator");
+
+        // publish the locality of this site and collect the localities of
+        // all other sites, this is done only once
+        if (!hpx::register_with_basename(
+                basename, hpx::find_here(), this_site).get())
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::lcos::communicator::communicator",
+                "the given base name for the communicator was already "
+                "registered: " + basename);
+        }
+
+        std::vector<hpx::future<hpx::id_type> > ids =
+            hpx::find_all_from_basename(basename, num_sites);
+
+        std::vector<hpx::id_type> localities;
+        localities.reserve(num_sites);
+        for (hpx::future<hpx::id_type>& id : ids)
+            localities.push_back(id.get());
+
+        data_ = std::make_shared<detail::communicator_data>(basename,
+            std::move(localities), this_site, true);
+    }
+
+    communicator::communicator(std::string const& basename,
+        std::vector<hpx::id_type> const& localities, std::size_t this_site)
+    {
+        detail::check_site(this_site, localities.size(),
+            "hpx::lcos::communicator::communicator");
+
+        std::vector<hpx::id_type> sites(localities);
+        data_ = std::make_shared<detail::communicator_data>(basename,
+            std::move(sites), this_site, false);
+    }
+
+    communicator::~communicator() = default;
+
+    std::size_t communicator::num_sites() const
+    {
+        HPX_ASSERT(data_);
+        return data_->localities_.size();
+    }
+
+    std::size_t communicator::this_site() const
+    {
+        HPX_ASSERT(data_);
+        return data_->this_site_;
+    }
+
+    hpx::id_type const& communicator::get_locality(std::size_t site) const
+    {
+        HPX_ASSERT(data_);
+        detail::check_site(site, data_->localities_.size(),
+            "hpx::lcos::communicator::get_locality");
+        return data_->localities_[site];
+    }
+
+    std::size_t communicator::next_generation(std::size_t generation)
+    {
+        HPX_ASSERT(data_);
+        if (generation != std::size_t(-1))
+            return generation;
+        return ++data_->generation_;
+    }
+
+    hpx::future<void> communicator::send(std::size_t site,
+        std::size_t generation, std::size_t tag, buffer_type data) const
+    {
+        HPX_ASSERT(data_);
+        detail::check_site(site, data_->localities_.size(),
+            "hpx::lcos::communicator::send");
+
+        if (site == data_->this_site_)
+        {
+            data_->mailbox_->set(generation, tag, site, std::move(data));
+            return hpx::make_ready_future();
+        }
+
+        if (data_->is_local_[site])
+        {
+            detail::communicator_set(data_->id_, site, data_->incarnation_,
+                generation, tag, data_->this_site_, std::move(data));
+            return hpx::make_ready_future();
+        }
+
+        return hpx::async(hpx_lcos_communicator_set_action(),
+            data_->localities_[site], data_->id_, site, data_->incarnation_,
+            generation, tag, data_->this_site_, std::move(data));
+    }
+
+    hpx::future<communicator::buffer_type> communicator::receive(
+        std::size_t site, std::size_t generation, std::size_t tag) const
+    {
+        HPX_ASSERT(data_);
+        detail::check_site(site, data_->localities_.size(),
+            "hpx::lcos::communicator::receive");
+
+        return data_->mailbox_->get(generation, tag, site);
+    }
+}}
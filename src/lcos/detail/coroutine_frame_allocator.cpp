@@ -0,0 +1,108 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/lcos/detail/coroutine_frame_allocator.hpp>
+
+#include <cstddef>
+#include <new>
+
+namespace hpx { namespace lcos { namespace detail
+{
+    namespace
+    {
+        // frames are grouped into size classes of this granularity
+        std::size_t const frame_granularity = 64;
+
+        // the number of size classes, larger frames are not cached
+        std::size_t const num_size_classes = 16;
+
+        // the maximal number of frames cached per size class and worker
+        std::size_t const max_cached_frames = 256;
+
+        struct frame_cache
+        {
+            struct free_frame
+            {
+                free_frame* next_;
+            };
+
+            frame_cache()
+            {
+                for (std::size_t i = 0; i != num_size_classes; ++i)
+                {
+                    free_[i] = nullptr;
+                    count_[i] = 0;
+                }
+            }
+
+            ~frame_cache()
+            {
+                for (std::size_t i = 0; i != num_size_classes; ++i)
+                {
+                    while (free_frame* f = free_[i])
+                    {
+                        free_[i] = f->next_;
+                        ::operator delete(f);
+                    }
+                }
+            }
+
+            free_frame* free_[num_size_classes];
+            std::size_t count_[num_size_classes];
+        };
+
+        frame_cache& get_frame_cache()
+        {
+            static thread_local frame_cache cache;
+            return cache;
+        }
+
+        inline std::size_t size_class(std::size_t size)
+        {
+            return size == 0 ? 0 : (size - 1) / frame_granularity;
+        }
+    }
+
+    void* allocate_coroutine_frame(std::size_t size)
+    {
+        std::size_t const idx = size_class(size);
+        if (idx >= num_size_classes)
+            return ::operator new(size);
+
+        frame_cache& cache = get_frame_cache();
+        if (frame_cache::free_frame* f = cache.free_[idx])
+        {
+            cache.free_[idx] = f->next_;
+            --cache.count_[idx];
+            return f;
+        }
+
+        // always allocate the full size class to allow for reusing the frame
+        return ::operator new((idx + 1) * frame_granularity);
+    }
+
+    void deallocate_coroutine_frame(void* p, std::size_t size) noexcept
+    {
+        std::size_t const idx = size_class(size);
+        if (idx >= num_size_classes)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        frame_cache& cache = get_frame_cache();
+        if (cache.count_[idx] == max_cached_frames)
+        {
+            ::operator delete(p);
+            return;
+        }
+
+        frame_cache::free_frame* f = static_cast<frame_cache::free_frame*>(p);
+        f->next_ = cache.free_[idx];
+        cache.free_[idx] = f;
+        ++cache.count_[idx];
+    }
+}}}
@@ -0,0 +1,554 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/apply.hpp>
+#include <hpx/async.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/distributed_task_pool.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/condition_variable.hpp>
+#include <hpx/lcos/local/spinlock.hpp>
+#include <hpx/runtime/actions/plain_action.hpp>
+#include <hpx/runtime/get_os_thread_count.hpp>
+#include <hpx/runtime/launch_policy.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/runtime/serialization/vector.hpp>
+#include <hpx/runtime/threads/thread.hpp>
+#include <hpx/runtime/threads/thread_helpers.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail
+{
+    typedef distributed_task_pool::task_type task_type;
+
+    // the number of tasks executed by a worker between sending the queue
+    // length of its site to another site
+    std::size_t const gossip_interval = 16;
+
+    // the bounds of the time (in microseconds) wait() pauses before checking
+    // for termination again
+    std::int64_t const min_backoff = 10;
+    std::int64_t const max_backoff = 1000;
+
+    ///////////////////////////////////////////////////////////////////////////
+    struct task_pool_data
+    {
+        typedef lcos::local::spinlock mutex_type;
+
+        task_pool_data(communicator && comm, std::string const& name,
+                std::size_t max_steal)
+          : comm_(std::move(comm))
+          , name_(name)
+          , max_steal_(max_steal == 0 ? 1 : max_steal)
+          , loads_(new std::atomic<std::size_t>[comm_.num_sites()])
+          , created_(0)
+          , completed_(0)
+          , running_(0)
+          , stealing_(false)
+          , stop_(false)
+        {
+            for (std::size_t i = 0; i != comm_.num_sites(); ++i)
+                loads_[i].store(0, std::memory_order_relaxed);
+        }
+
+        void start(std::size_t num_workers);
+        void stop();
+
+        ///////////////////////////////////////////////////////////////////////
+        void push(task_type && task)
+        {
+            ++created_;
+
+            std::lock_guard<mutex_type> l(mtx_);
+            queue_.push_back(std::move(task));
+            work_available_.notify_one();
+        }
+
+        // tasks are executed in LIFO order locally, which keeps the queue
+        // short for recursively generated workloads
+        bool pop(task_type& task)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (queue_.empty())
+                return false;
+
+            task = std::move(queue_.back());
+            queue_.pop_back();
+            return true;
+        }
+
+        std::size_t queue_length() const
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            return queue_.size();
+        }
+
+        // hand out up to half of the queued tasks to another site, taking the
+        // oldest ones
+        std::vector<task_type> steal(std::size_t thief, std::size_t thief_load)
+        {
+            update_load(thief, thief_load);
+
+            std::vector<task_type> tasks;
+
+            std::lock_guard<mutex_type> l(mtx_);
+            std::size_t const count =
+                (std::min)((queue_.size() + 1) / 2, max_steal_);
+
+            tasks.reserve(count);
+            for (std::size_t i = 0; i != count; ++i)
+            {
+                tasks.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+            return tasks;
+        }
+
+        // wake up an idle worker if the site has work to steal
+        void update_load(std::size_t site, std::size_t load)
+        {
+            loads_[site].store(load, std::memory_order_relaxed);
+            if (load != 0)
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                work_available_.notify_one();
+            }
+        }
+
+        // whether any other site is known to have queued tasks
+        bool remote_work() const
+        {
+            for (std::size_t i = 0; i != comm_.num_sites(); ++i)
+            {
+                if (i != comm_.this_site() &&
+                    loads_[i].load(std::memory_order_relaxed) != 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        void set_exception(std::exception_ptr const& e)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!exception_)
+                exception_ = e;
+        }
+
+        void execute(task_type& task)
+        {
+            ++running_;
+            try {
+                task();
+            }
+            catch (...) {
+                set_exception(std::current_exception());
+            }
+            task.reset();
+            --running_;
+            ++completed_;
+        }
+
+        std::size_t random_site(std::mt19937& gen) const
+        {
+            // any site but this one
+            std::size_t const num_sites = comm_.num_sites();
+            std::uniform_int_distribution<std::size_t> dist(0, num_sites - 2);
+
+            std::size_t site = dist(gen);
+            if (site >= comm_.this_site())
+                ++site;
+            return site;
+        }
+
+        void gossip(std::mt19937& gen);
+        bool try_steal(std::mt19937& gen);
+        void worker(std::size_t index);
+        void wait();
+
+        communicator comm_;
+        std::string const name_;
+        std::size_t const max_steal_;
+
+        mutable mutex_type mtx_;
+        std::deque<task_type> queue_;
+
+        // idle workers wait for tasks being queued, for another site to be
+        // known to have work, for a steal attempt to finish, or for the pool
+        // to be stopped
+        lcos::local::condition_variable_any work_available_;
+        std::exception_ptr exception_;
+
+        // the last known queue lengths of all sites
+        std::unique_ptr<std::atomic<std::size_t>[]> loads_;
+
+        // the number of tasks posted to, and executed by, this site
+        std::atomic<std::size_t> created_;
+        std::atomic<std::size_t> completed_;
+        std::atomic<std::size_t> running_;
+
+        std::atomic<bool> stealing_;
+        std::atomic<bool> stop_;
+        std::vector<hpx::future<void> > workers_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // All pool sites located on this locality
+    class task_pool_registry
+    {
+        typedef lcos::local::spinlock mutex_type;
+        typedef std::pair<std::string, std::size_t> key_type;
+
+    public:
+        void add(std::string const& name, std::size_t site,
+            std::shared_ptr<task_pool_data> const& data)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            if (!pools_.insert(std::make_pair(key_type(name, site), data))
+                    .second)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::lcos::distributed_task_pool::distributed_task_pool",
+                    "the given base name for the task pool is already in "
+                    "use: " + name);
+            }
+        }
+
+        std::shared_ptr<task_pool_data> get(std::string const& name,
+            std::size_t site)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            auto it = pools_.find(key_type(name, site));
+            if (it == pools_.end())
+                return std::shared_ptr<task_pool_data>();
+            return it->second;
+        }
+
+        void remove(std::string const& name, std::size_t site)
+        {
+            std::lock_guard<mutex_type> l(mtx_);
+            pools_.erase(key_type(name, site));
+        }
+
+    private:
+        mutex_type mtx_;
+        std::map<key_type, std::shared_ptr<task_pool_data> > pools_;
+    };
+
+    static task_pool_registry& get_task_pool_registry()
+    {
+        static task_pool_registry registry;
+        return registry;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Steal requests may arrive before the pool of the victim has been
+    // created or after it has been destroyed, the thief gets no tasks then.
+    std::vector<task_type> task_pool_steal(std::string const& name,
+        std::size_t site, std::size_t thief, std::size_t thief_load)
+    {
+        std::shared_ptr<task_pool_data> data =
+            get_task_pool_registry().get(name, site);
+        if (!data)
+            return std::vector<task_type>();
+        return data->steal(thief, thief_load);
+    }
+
+    void task_pool_gossip(std::string const& name, std::size_t site,
+        std::size_t from, std::size_t load)
+    {
+        std::shared_ptr<task_pool_data> data =
+            get_task_pool_registry().get(name, site);
+        if (data)
+            data->update_load(from, load);
+    }
+}}}
+
+HPX_PLAIN_ACTION(hpx::lcos::detail::task_pool_steal,
+    hpx_lcos_task_pool_steal_action);
+HPX_PLAIN_ACTION(hpx::lcos::detail::task_pool_gossip,
+    hpx_lcos_task_pool_gossip_action);
+
+namespace hpx { namespace lcos
+{
+    namespace detail
+    {
+        ///////////////////////////////////////////////////////////////////////
+        void task_pool_data::start(std::size_t num_workers)
+        {
+            workers_.reserve(num_workers);
+            for (std::size_t i = 0; i != num_workers; ++i)
+            {
+                workers_.push_back(hpx::async(
+                    &task_pool_data::worker, this, i));
+            }
+        }
+
+        void task_pool_data::stop()
+        {
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                stop_ = true;
+                work_available_.notify_all();
+            }
+            for (hpx::future<void>& f : workers_)
+                f.wait();
+            workers_.clear();
+        }
+
+        void task_pool_data::gossip(std::mt19937& gen)
+        {
+            std::size_t const site = random_site(gen);
+            hpx::apply(hpx_lcos_task_pool_gossip_action(),
+                comm_.get_locality(site), name_, site, comm_.this_site(),
+                queue_length());
+        }
+
+        // Ask one of two randomly chosen sites, whichever is known to have
+        // more work queued, for a batch of tasks. Only one worker per site
+        // steals at any time, the stolen tasks are shared by all of them.
+        bool task_pool_data::try_steal(std::mt19937& gen)
+        {
+            if (comm_.num_sites() == 1 || stealing_.exchange(true))
+                return false;
+
+            std::size_t victim = random_site(gen);
+            std::size_t const other = random_site(gen);
+            if (loads_[other].load(std::memory_order_relaxed) >
+                loads_[victim].load(std::memory_order_relaxed))
+            {
+                victim = other;
+            }
+
+            std::vector<task_type> tasks;
+            try {
+                tasks = hpx::async(hpx_lcos_task_pool_steal_action(),
+                    comm_.get_locality(victim), name_, victim,
+                    comm_.this_site(), queue_length()).get();
+            }
+            catch (...) {
+                set_exception(std::current_exception());
+            }
+
+            // the victim keeps about as many tasks as it handed out
+            loads_[victim].store(tasks.size(), std::memory_order_relaxed);
+
+            // the workers waiting for this steal attempt share the tasks
+            std::lock_guard<mutex_type> l(mtx_);
+            for (task_type& task : tasks)
+                queue_.push_back(std::move(task));
+
+            stealing_ = false;
+            work_available_.notify_all();
+
+            return !tasks.empty();
+        }
+
+        void task_pool_data::worker(std::size_t index)
+        {
+            // make the pool accessible to the tasks run by this thread
+            threads::set_thread_data(threads::get_self_id(),
+                reinterpret_cast<std::size_t>(this));
+
+            std::mt19937 gen(static_cast<std::mt19937::result_type>(
+                comm_.this_site() * 1021 + index));
+
+            std::size_t executed = 0;
+            std::size_t gossiped = 0;
+
+            task_type task;
+            while (!stop_.load(std::memory_order_relaxed))
+            {
+                if (pop(task))
+                {
+                    execute(task);
+
+                    // tell another site about the queued tasks regularly,
+                    // and whenever their number has grown considerably
+                    if (comm_.num_sites() != 1)
+                    {
+                        std::size_t const length = queue_length();
+                        if (++executed % gossip_interval == 0 ||
+                            length > 2 * gossiped)
+                        {
+                            gossip(gen);
+                            gossiped = length;
+                        }
+                    }
+                    continue;
+                }
+
+                if (remote_work() && try_steal(gen))
+                    continue;
+
+                // park until there is something to do
+                std::unique_lock<mutex_type> l(mtx_);
+                if (!stop_.load(std::memory_order_relaxed) && queue_.empty() &&
+                    (stealing_.load() || !remote_work()))
+                {
+                    work_available_.wait(l);
+                }
+            }
+
+            threads::set_thread_data(threads::get_self_id(), 0);
+        }
+
+        // Terminate once two consecutive global sums of the executed and
+        // posted tasks are equal to each other and did not change in
+        // between. As the counters only ever increase, no task can have been
+        // in flight (queued, running, or being stolen) at that point.
+        void task_pool_data::wait()
+        {
+            std::vector<std::size_t> previous;
+            std::int64_t backoff = min_backoff;
+
+            while (true)
+            {
+                // wait for the local work to be done first
+                while (running_ != 0 || queue_length() != 0)
+                {
+                    hpx::this_thread::sleep_for(
+                        std::chrono::microseconds(backoff));
+                    backoff = (std::min)(2 * backoff, max_backoff);
+                }
+
+                std::vector<std::size_t> counts(2);
+                counts[0] = completed_.load();
+                counts[1] = created_.load();
+
+                counts = all_reduce_elements(
+                    comm_, std::move(counts), reduction::plus()).get();
+
+                if (counts[0] == counts[1])
+                {
+                    if (counts == previous)
+                        break;
+                }
+                else
+                {
+                    hpx::this_thread::sleep_for(
+                        std::chrono::microseconds(backoff));
+                    backoff = (std::min)(2 * backoff, max_backoff);
+                }
+                previous = std::move(counts);
+            }
+
+            std::exception_ptr e;
+            {
+                std::lock_guard<mutex_type> l(mtx_);
+                std::swap(e, exception_);
+            }
+            if (e)
+                std::rethrow_exception(e);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<task_pool_data> create_task_pool(
+            communicator && comm, std::string const& basename,
+            std::size_t num_workers, std::size_t max_steal)
+        {
+            std::shared_ptr<task_pool_data> data =
+                std::make_shared<task_pool_data>(
+                    std::move(comm), basename, max_steal);
+
+            get_task_pool_registry().add(
+                basename, data->comm_.this_site(), data);
+
+            data->start(num_workers == 0 ?
+                hpx::get_os_thread_count() : num_workers);
+            return data;
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    distributed_task_pool::distributed_task_pool(std::string const& basename,
+        std::size_t num_workers, std::size_t max_steal)
+      : data_(detail::create_task_pool(communicator(basename), basename,
+            num_workers, max_steal))
+    {}
+
+    distributed_task_pool::distributed_task_pool(std::string const& basename,
+        std::vector<hpx::id_type> const& localities, std::size_t this_site,
+        std::size_t num_workers, std::size_t max_steal)
+      : data_(detail::create_task_pool(
+            communicator(basename, localities, this_site), basename,
+            num_workers, max_steal))
+    {}
+
+    distributed_task_pool::~distributed_task_pool()
+    {
+        if (data_)
+        {
+            detail::get_task_pool_registry().remove(
+                data_->name_, data_->comm_.this_site());
+            data_->stop();
+        }
+    }
+
+    communicator const& distributed_task_pool::get_communicator() const
+    {
+        HPX_ASSERT(data_);
+        return data_->comm_;
+    }
+
+    void distributed_task_pool::post(task_type task)
+    {
+        HPX_ASSERT(data_);
+        data_->push(std::move(task));
+    }
+
+    std::size_t distributed_task_pool::queue_length() const
+    {
+        HPX_ASSERT(data_);
+        return data_->queue_length();
+    }
+
+    void distributed_task_pool::wait()
+    {
+        HPX_ASSERT(data_);
+        data_->wait();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace this_task_pool
+    {
+        void post(distributed_task_pool::task_type task)
+        {
+            std::size_t const data = threads::get_thread_data(
+                threads::get_self_id());
+            if (data == 0)
+            {
+                HPX_THROW_EXCEPTION(invalid_status,
+                    "hpx::lcos::this_task_pool::post",
+                    "this function can only be called from a task executed "
+                    "by a distributed_task_pool");
+            }
+
+            reinterpret_cast<detail::task_pool_data*>(data)->push(
+                std::move(task));
+        }
+    }
+}}
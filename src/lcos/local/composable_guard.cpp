@@ -5,14 +5,18 @@
 
 #include <hpx/config.hpp>
 #include <hpx/apply.hpp>
+#include <hpx/exception.hpp>
 #include <hpx/util/assert.hpp>
 #include <hpx/util/bind_front.hpp>
 #include <hpx/util/function.hpp>
+#include <hpx/util/yield_while.hpp>
 
 #include <hpx/lcos/local/composable_guard.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <exception>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -214,6 +218,185 @@ namespace hpx { namespace lcos { namespace local
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // the number of queued tasks the owner of a combining_guard runs before
+    // handing off the remaining ones to a new thread
+    static std::size_t const combining_guard_batch_size = 64;
+
+    combining_guard::combining_guard()
+      : pending_(0), head_(&stub_), tail_(&stub_)
+    {}
+
+    combining_guard::~combining_guard()
+    {
+        HPX_ASSERT(pending_.load() == 0);
+    }
+
+    // wait-free, may be called concurrently by any number of threads
+    void combining_guard::push(detail::combining_guard_task* task)
+    {
+        task->next.store(nullptr, std::memory_order_relaxed);
+        detail::combining_guard_task* prev =
+            head_.exchange(task, std::memory_order_acq_rel);
+        prev->next.store(task, std::memory_order_release);
+    }
+
+    // may be called by the owner of the guard only, returns nullptr if the
+    // queue is empty or if a concurrent push has not completed yet
+    detail::combining_guard_task* combining_guard::pop()
+    {
+        detail::combining_guard_task* tail = tail_;
+        detail::combining_guard_task* next =
+            tail->next.load(std::memory_order_acquire);
+
+        if (tail == &stub_)
+        {
+            if (next == nullptr)
+                return nullptr;
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next != nullptr)
+        {
+            tail_ = next;
+            return tail;
+        }
+
+        if (tail != head_.load(std::memory_order_acquire))
+            return nullptr;
+
+        push(&stub_);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next != nullptr)
+        {
+            tail_ = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    // Make sure the queued tasks are run even if the current one throws.
+    struct combining_guard_release
+    {
+        explicit combining_guard_release(combining_guard& g)
+          : g_(g), released_(false)
+        {}
+
+        ~combining_guard_release()
+        {
+            if (!released_ &&
+                g_.pending_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                hpx::apply(&combining_guard_release::drain, &g_);
+            }
+        }
+
+        static void drain(combining_guard* g);
+
+        combining_guard& g_;
+        bool released_;
+    };
+
+    // Pass the exception of a task to its error handler, an exception thrown
+    // by the handler itself is reported as well.
+    static void report_guarded_error(detail::guard_error_handler& on_error,
+        std::exception_ptr const& e)
+    {
+        if (!on_error)
+        {
+            hpx::detail::report_exception_and_continue(e);
+            return;
+        }
+
+        try {
+            on_error(e);
+        }
+        catch (...) {
+            hpx::detail::report_exception_and_continue(
+                std::current_exception());
+        }
+    }
+
+    // Run queued tasks while owning the guard. The tasks belong to other
+    // threads, their exceptions must not propagate to the owner.
+    void combining_guard::drain()
+    {
+        for (std::size_t i = 0; i != combining_guard_batch_size; ++i)
+        {
+            // the task was counted but may not have been linked yet
+            detail::combining_guard_task* task = pop();
+            if (task == nullptr)
+            {
+                util::yield_while([&]() { return (task = pop()) == nullptr; },
+                    "combining_guard::drain");
+            }
+
+            std::unique_ptr<detail::combining_guard_task> t(task);
+
+            try {
+                t->run();
+            }
+            catch (...) {
+                report_guarded_error(t->on_error, std::current_exception());
+            }
+
+            if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                return;
+        }
+
+        // leave the remaining tasks to a new thread
+        hpx::apply(&combining_guard_release::drain, this);
+    }
+
+    void combining_guard_release::drain(combining_guard* g)
+    {
+        g->drain();
+    }
+
+    void run_guarded_handled(combining_guard& g, detail::guard_function task,
+        detail::guard_error_handler on_error)
+    {
+        g.check_();
+
+        if (g.pending_.fetch_add(1, std::memory_order_acq_rel) != 0)
+        {
+            // the guard is owned by somebody else who will run the task
+            g.push(new detail::combining_guard_task(
+                std::move(task), std::move(on_error)));
+            return;
+        }
+
+        // fast path: the guard is not contended, run the task directly
+        {
+            combining_guard_release release(g);
+            if (on_error)
+            {
+                try {
+                    task();
+                }
+                catch (...) {
+                    on_error(std::current_exception());
+                }
+            }
+            else
+            {
+                task();
+            }
+            release.released_ = true;
+        }
+
+        if (g.pending_.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            g.drain();
+    }
+
+    void run_guarded(combining_guard& g, detail::guard_function task)
+    {
+        run_guarded_handled(g, std::move(task), detail::guard_error_handler());
+    }
+
     guard::~guard() {
         guard_task *zero = nullptr;
         guard_task *current = task.load();
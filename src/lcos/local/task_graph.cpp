@@ -0,0 +1,205 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/apply.hpp>
+#include <hpx/lcos/future.hpp>
+#include <hpx/lcos/local/promise.hpp>
+#include <hpx/lcos/local/task_graph.hpp>
+#include <hpx/throw_exception.hpp>
+#include <hpx/util/assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace local
+{
+    static std::size_t const no_node = std::size_t(-1);
+
+    ///////////////////////////////////////////////////////////////////////////
+    task_graph::task_graph()
+      : prepared_(false)
+      , remaining_(0)
+      , running_(false)
+      , failed_(false)
+    {}
+
+    task_graph::~task_graph()
+    {
+        HPX_ASSERT(!running_);
+    }
+
+    task_graph::node task_graph::add_node(
+        task_function && f, node const* deps, std::size_t num_deps)
+    {
+        if (running_.load())
+        {
+            HPX_THROW_EXCEPTION(invalid_status, "task_graph::add",
+                "the graph can't be modified while it is running");
+            return node();
+        }
+
+        std::size_t const index = nodes_.size();
+
+        // nodes can depend on already existing nodes only, which guarantees
+        // the graph to be acyclic
+        for (std::size_t i = 0; i != num_deps; ++i)
+        {
+            if (deps[i].graph_ != this || deps[i].index() >= index)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter, "task_graph::add",
+                    "the given dependency does not refer to a node of "
+                    "this graph");
+                return node();
+            }
+        }
+
+        node_data data;
+        data.f_ = std::move(f);
+        data.num_dependencies_ = num_deps;
+        nodes_.push_back(std::move(data));
+
+        for (std::size_t i = 0; i != num_deps; ++i)
+            nodes_[deps[i].index()].successors_.push_back(index);
+
+        prepared_ = false;
+        return node(this, index);
+    }
+
+    void task_graph::clear()
+    {
+        if (running_.load())
+        {
+            HPX_THROW_EXCEPTION(invalid_status, "task_graph::clear",
+                "the graph can't be modified while it is running");
+            return;
+        }
+
+        nodes_.clear();
+        roots_.clear();
+        counters_.reset();
+        prepared_ = false;
+    }
+
+    // Compute the information which stays the same for every execution of
+    // the graph.
+    void task_graph::prepare()
+    {
+        if (prepared_)
+            return;
+
+        roots_.clear();
+        for (std::size_t i = 0; i != nodes_.size(); ++i)
+        {
+            if (nodes_[i].num_dependencies_ == 0)
+                roots_.push_back(i);
+        }
+
+        counters_.reset(new std::atomic<std::size_t>[nodes_.size()]);
+        prepared_ = true;
+    }
+
+    hpx::future<void> task_graph::run()
+    {
+        if (running_.exchange(true))
+        {
+            HPX_THROW_EXCEPTION(invalid_status, "task_graph::run",
+                "the graph is already running");
+            return hpx::future<void>();
+        }
+
+        if (nodes_.empty())
+        {
+            running_.store(false);
+            return hpx::make_ready_future();
+        }
+
+        prepare();
+
+        for (std::size_t i = 0; i != nodes_.size(); ++i)
+        {
+            counters_[i].store(
+                nodes_[i].num_dependencies_, std::memory_order_relaxed);
+        }
+        remaining_.store(nodes_.size(), std::memory_order_relaxed);
+        failed_.store(false, std::memory_order_relaxed);
+        exception_ = std::exception_ptr();
+
+        done_ = lcos::local::promise<void>();
+        hpx::future<void> result = done_.get_future();
+
+        for (std::size_t root : roots_)
+            hpx::apply(&task_graph::execute, this, root);
+
+        return result;
+    }
+
+    void task_graph::set_exception(std::exception_ptr const& e)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        if (!exception_)
+            exception_ = e;
+        failed_.store(true);
+    }
+
+    // Notify the successors of the given node, returns the successor which
+    // should be executed next on this thread (if any). All other successors
+    // which became ready are scheduled on new threads.
+    void task_graph::finish_node(std::size_t& index)
+    {
+        std::size_t next = no_node;
+        for (std::size_t s : nodes_[index].successors_)
+        {
+            if (--counters_[s] == 0)
+            {
+                if (next != no_node)
+                    hpx::apply(&task_graph::execute, this, next);
+                next = s;
+            }
+        }
+        index = next;
+    }
+
+    void task_graph::execute(std::size_t index)
+    {
+        while (index != no_node)
+        {
+            if (!failed_.load(std::memory_order_relaxed))
+            {
+                try {
+                    nodes_[index].f_();
+                }
+                catch (...) {
+                    set_exception(std::current_exception());
+                }
+            }
+
+            finish_node(index);
+
+            // the last node to finish signals the completion of the graph
+            if (--remaining_ == 0)
+            {
+                HPX_ASSERT(index == no_node);
+
+                lcos::local::promise<void> done(std::move(done_));
+                std::exception_ptr e(std::move(exception_));
+
+                // the graph may be run again (or destroyed) as soon as the
+                // promise is made ready
+                running_.store(false);
+
+                if (e)
+                    done.set_exception(std::move(e));
+                else
+                    done.set_value();
+            }
+        }
+    }
+}}}
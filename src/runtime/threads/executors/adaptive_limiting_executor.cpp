@@ -0,0 +1,233 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/error_code.hpp>
+#include <hpx/performance_counters/counter_creators.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/runtime/threads/executors/adaptive_limiting_executor.hpp>
+#include <hpx/util/assert.hpp>
+#include <hpx/util/bind.hpp>
+#include <hpx/util/function.hpp>
+#include <hpx/util/yield_while.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace hpx { namespace threads { namespace executors
+{
+    namespace detail
+    {
+        // the minimal number of samples collected before adapting the limit
+        static std::uint64_t const min_window_size = 16;
+
+        // the number of windows after which the minimal latency is reset,
+        // allowing to follow changes in the nature of the executed work
+        static std::uint64_t const min_latency_reset_interval = 100;
+
+        inline std::uint64_t no_latency()
+        {
+            return (std::numeric_limits<std::uint64_t>::max)();
+        }
+    }
+
+    adaptive_limiter::adaptive_limiter(std::size_t initial_limit,
+            std::size_t min_limit, std::size_t max_limit)
+      : min_limit_(static_cast<std::int64_t>((std::max)(min_limit,
+            std::size_t(1))))
+      , max_limit_(static_cast<std::int64_t>((std::max)(max_limit,
+            min_limit)))
+      , limit_(static_cast<std::int64_t>(initial_limit))
+      , in_flight_(0)
+      , max_in_flight_(0)
+      , queueing_delay_(0)
+      , samples_(0)
+      , sum_delay_(0)
+      , sum_latency_(0)
+      , min_latency_(detail::no_latency())
+      , windows_(0)
+      , updating_(false)
+    {
+        limit_.store(
+            (std::min)((std::max)(limit_.load(), min_limit_), max_limit_));
+    }
+
+    adaptive_limiter::~adaptive_limiter()
+    {
+        // the counter types may have been removed already during shutdown
+        for (std::string const& name : counter_types_)
+        {
+            error_code ec(lightweight);
+            performance_counters::remove_counter_type(
+                performance_counters::counter_info(name), ec);
+        }
+    }
+
+    void adaptive_limiter::register_counters(std::string const& name)
+    {
+        std::string const prefix("/adaptive_limiting_executor/" + name);
+
+        // the counters may outlive the executor, they don't keep the limiter
+        // alive
+        std::weak_ptr<adaptive_limiter> self(shared_from_this());
+
+        install_counter_type(prefix + "/limit",
+            [self](bool) -> std::int64_t
+            {
+                std::shared_ptr<adaptive_limiter> p = self.lock();
+                return p ? p->limit() : 0;
+            },
+            "returns the number of tasks currently allowed to be in flight",
+            "");
+        install_counter_type(prefix + "/queueing-delay",
+            [self](bool) -> std::int64_t
+            {
+                std::shared_ptr<adaptive_limiter> p = self.lock();
+                return p ? p->queueing_delay() : 0;
+            },
+            "returns the average time tasks were waiting to be executed",
+            "ns");
+        install_counter_type(prefix + "/count/in-flight",
+            [self](bool) -> std::int64_t
+            {
+                std::shared_ptr<adaptive_limiter> p = self.lock();
+                return p ? p->in_flight() : 0;
+            },
+            "returns the number of tasks currently in flight", "");
+    }
+
+    void adaptive_limiter::install_counter_type(std::string const& name,
+        util::function_nonser<std::int64_t(bool)> const& counter_value,
+        std::string const& helptext, std::string const& uom)
+    {
+        using util::placeholders::_1;
+        using util::placeholders::_2;
+
+        performance_counters::counter_info info(
+            performance_counters::counter_raw, name, helptext,
+            HPX_PERFORMANCE_COUNTER_V1, uom);
+
+        // this throws if a counter type with the same name exists already,
+        // the types installed so far are removed by the destructor
+        performance_counters::add_counter_type(info,
+            util::bind(&performance_counters::locality_raw_counter_creator,
+                _1, counter_value, _2),
+            &performance_counters::locality_counter_discoverer);
+
+        counter_types_.push_back(name);
+    }
+
+    void adaptive_limiter::acquire()
+    {
+        // the number of tasks in flight is incremented only while it is
+        // below the limit
+        std::int64_t current = in_flight_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            if (current >= limit())
+            {
+                hpx::util::yield_while([&]() {
+                    current = in_flight_.load(std::memory_order_relaxed);
+                    return current >= limit();
+                });
+            }
+
+            if (in_flight_.compare_exchange_weak(current, current + 1))
+                break;
+        }
+        ++current;
+
+        std::int64_t max_current = max_in_flight_.load();
+        while (current > max_current &&
+            !max_in_flight_.compare_exchange_weak(max_current, current))
+        {
+        }
+    }
+
+    void adaptive_limiter::release(std::uint64_t delay, std::uint64_t latency)
+    {
+        sum_delay_ += delay;
+        sum_latency_ += latency;
+
+        std::uint64_t min_latency = min_latency_.load();
+        while (latency < min_latency &&
+            !min_latency_.compare_exchange_weak(min_latency, latency))
+        {
+        }
+
+        // the task which completes the current sampling window adapts the
+        // limit
+        std::uint64_t const window = (std::max)(detail::min_window_size,
+            static_cast<std::uint64_t>(limit()));
+        if (++samples_ >= window && !updating_.exchange(true))
+        {
+            update_limit();
+            updating_.store(false);
+        }
+
+        --in_flight_;
+    }
+
+    void adaptive_limiter::release()
+    {
+        --in_flight_;
+    }
+
+    void adaptive_limiter::update_limit()
+    {
+        std::uint64_t const samples = samples_.exchange(0);
+        std::uint64_t const sum_delay = sum_delay_.exchange(0);
+        std::uint64_t const sum_latency = sum_latency_.exchange(0);
+        std::int64_t const max_in_flight = max_in_flight_.exchange(0);
+
+        if (samples == 0 || sum_latency == 0)
+            return;
+
+        queueing_delay_.store(static_cast<std::int64_t>(sum_delay / samples));
+
+        double const latency = double(sum_latency) / samples;
+        double const min_latency = double(min_latency_.load());
+        std::int64_t limit = limit_.load();
+
+        // estimated number of tasks which are waiting instead of doing
+        // useful work
+        double const queue = limit * (1.0 - (std::min)(min_latency, latency) /
+            latency);
+
+        double const step = (std::max)(1.0, std::log10(double(limit)));
+        double const alpha = 3 * step;
+        double const beta = 6 * step;
+
+        if (queue < alpha)
+        {
+            // grow the limit only if it was actually limiting
+            if (2 * max_in_flight >= limit)
+                limit += static_cast<std::int64_t>(step);
+        }
+        else if (queue > beta)
+        {
+            limit -= static_cast<std::int64_t>(step);
+        }
+
+        limit_.store((std::min)((std::max)(limit, min_limit_), max_limit_));
+
+        if (++windows_ % detail::min_latency_reset_interval == 0)
+            min_latency_.store(static_cast<std::uint64_t>(latency));
+    }
+
+    void adaptive_limiter::wait() const
+    {
+        hpx::util::yield_while([this]() {
+            return in_flight_.load(std::memory_order_relaxed) != 0;
+        });
+    }
+}}}
@@ -22,6 +22,7 @@
 
 #include <hpx/include/parallel_execution.hpp>
 #include <hpx/lcos/local/sliding_semaphore.hpp>
+#include <hpx/runtime/threads/executors/adaptive_limiting_executor.hpp>
 #include <hpx/runtime/threads/executors/limiting_executor.hpp>
 #include <hpx/runtime/threads/executors/pool_executor.hpp>
 
@@ -259,6 +260,36 @@ void measure_function_futures_limiting_executor(
     print_stats("apply", "limiting-Exec", ExecName(exec), count, duration, csv);
 }
 
+template <typename Executor>
+void measure_function_futures_adaptive_limiting_executor(
+    std::uint64_t count, bool csv, Executor exec)
+{
+    std::atomic<std::uint64_t> sanity_check(count);
+
+    // start the clock
+    high_resolution_timer walltime;
+    {
+        hpx::threads::executors::adaptive_limiting_executor<Executor>
+            signal_exec(exec);
+        for (std::uint64_t i = 0; i < count; ++i) {
+            hpx::apply(signal_exec, [&](){
+                null_function();
+                sanity_check--;
+            });
+        }
+    }
+
+    if (sanity_check!=0) {
+        throw std::runtime_error(
+            "This test is faulty " + std::to_string(sanity_check));
+    }
+
+    // stop the clock
+    const double duration = walltime.elapsed();
+    print_stats("apply", "adaptive-limiting-Exec", ExecName(exec), count,
+        duration, csv);
+}
+
 template <typename Executor>
 void measure_function_futures_sliding_semaphore(
     std::uint64_t count, bool csv, Executor& exec)
@@ -310,6 +341,8 @@ int hpx_main(variables_map& vm)
             measure_function_futures_thread_count(count, csv, par);
             measure_function_futures_limiting_executor(count, csv, def);
             measure_function_futures_limiting_executor(count, csv, par);
+            measure_function_futures_adaptive_limiting_executor(count, csv, def);
+            measure_function_futures_adaptive_limiting_executor(count, csv, par);
             measure_function_futures_sliding_semaphore(count, csv, def);
         }
     }
@@ -27,6 +27,7 @@
 #include <hpx/include/iostreams.hpp>
 #include <hpx/include/threads.hpp>
 #include <hpx/include/compute.hpp>
+#include <hpx/include/datapar.hpp>
 #include <hpx/util/unused.hpp>
 
 #include <cstddef>
@@ -231,7 +232,7 @@ struct multiply_step
     //         (used in invoke()) to get the return type
 
     template<typename U>
-    HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(U val) const
+    HPX_HOST_DEVICE HPX_FORCEINLINE U operator()(U val) const
     {
         return val * factor_;
     }
@@ -247,7 +248,7 @@ struct add_step
     //         (used in invoke()) to get the return type
 
     template<typename U>
-    HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(U val1, U val2) const
+    HPX_HOST_DEVICE HPX_FORCEINLINE U operator()(U val1, U val2) const
     {
         return val1 + val2;
     }
@@ -263,7 +264,7 @@ struct triad_step
     //         (used in invoke()) to get the return type
 
     template<typename U>
-    HPX_HOST_DEVICE HPX_FORCEINLINE T operator()(U val1, U val2) const
+    HPX_HOST_DEVICE HPX_FORCEINLINE U operator()(U val1, U val2) const
     {
         return val1 + val2 * factor_;
     }
@@ -272,9 +273,10 @@ struct triad_step
 };
 
 ///////////////////////////////////////////////////////////////////////////////
-template <typename Allocator, typename Executor, typename Target, typename... Targets>
+template <typename Allocator, typename Executor, typename Policy,
+    typename Target, typename... Targets>
 std::vector<std::vector<double> >
-run_benchmark(
+run_benchmark(Policy const& base_policy,
     std::size_t iterations, std::size_t size, Target target, Targets... targets)
 {
     // Creating our allocator ...
@@ -291,7 +293,7 @@ run_benchmark(
     Executor exec(target, targets...);
 
     // Creating the policy used in the parallel algorithms
-    auto policy = hpx::parallel::execution::par.on(exec);
+    auto policy = base_policy.on(exec);
 
     // Initialize arrays
     hpx::parallel::fill(policy, a.begin(), a.end(), 1.0);
@@ -419,6 +421,10 @@ int hpx_main(boost::program_options::variables_map& vm)
         << "Number of Threads requested = "
             << hpx::get_os_thread_count() << "\n"
         << "Chunking policy requested: " << chunker << "\n"
+#if defined(HPX_HAVE_DATAPAR)
+        << "Vectorization requested: "
+            << (vm.count("use-datapar") ? "datapar" : "none") << "\n"
+#endif
         << "-------------------------------------------------------------\n"
         ;
 
@@ -448,7 +454,8 @@ int hpx_main(boost::program_options::variables_map& vm)
         // perform benchmark
         timing =
             run_benchmark<allocator_type, executor_type>(
-                iterations, vector_size, std::move(target), std::move(host_targets));
+                hpx::parallel::execution::par, iterations, vector_size,
+                std::move(target), std::move(host_targets));
                 //iterations, vector_size, std::move(target));
     }
     else
@@ -461,9 +468,22 @@ int hpx_main(boost::program_options::variables_map& vm)
         auto numa_nodes = hpx::compute::host::numa_domains();
 
         // perform benchmark
-        timing =
-            run_benchmark<allocator_type, executor_type>(
-                iterations, vector_size, numa_nodes);
+#if defined(HPX_HAVE_DATAPAR)
+        if (vm.count("use-datapar"))
+        {
+            timing =
+                run_benchmark<allocator_type, executor_type>(
+                    hpx::parallel::execution::datapar, iterations,
+                    vector_size, numa_nodes);
+        }
+        else
+#endif
+        {
+            timing =
+                run_benchmark<allocator_type, executor_type>(
+                    hpx::parallel::execution::par, iterations,
+                    vector_size, numa_nodes);
+        }
     }
     time_total = mysecond() - time_total;
 
@@ -545,6 +565,11 @@ int main(int argc, char* argv[])
 #if defined(HPX_HAVE_COMPUTE)
         (   "use-accelerator",
             "Use this flag to run the stream benchmark on the GPU")
+#endif
+#if defined(HPX_HAVE_DATAPAR)
+        (   "use-datapar",
+            "Use this flag to run the stream benchmark using the vectorizing "
+            "execution policy (datapar)")
 #endif
         ;
 
@@ -8,6 +8,9 @@
 #include <hpx/util/high_resolution_clock.hpp>
 #include <hpx/include/parallel_numeric.hpp>
 #include <hpx/include/iostreams.hpp>
+#if defined(HPX_HAVE_DATAPAR)
+#include <hpx/include/datapar.hpp>
+#endif
 #include "worker_timed.hpp"
 
 #include <cstddef>
@@ -67,6 +70,41 @@ void measure_transform_reduce_old(std::size_t size)
     HPX_UNUSED(result);
 }
 
+#if defined(HPX_HAVE_DATAPAR)
+// The elements of Point can't be loaded into vector registers, the datapar
+// version computes the same sum from separate arrays of the coordinates.
+struct multiplies
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 && t1, T2 && t2) const -> decltype(t1 * t2)
+    {
+        return t1 * t2;
+    }
+};
+
+struct plus
+{
+    template <typename T1, typename T2>
+    auto operator()(T1 && t1, T2 && t2) const -> decltype(t1 + t2)
+    {
+        return t1 + t2;
+    }
+};
+
+void measure_transform_reduce_datapar(std::size_t size)
+{
+    std::vector<double> x(size, double(gen()));
+    std::vector<double> y(size, double(gen()));
+
+    // invoke transform_reduce
+    double result =
+        hpx::parallel::transform_reduce(hpx::parallel::execution::datapar,
+            std::begin(x), std::end(x), std::begin(y), 0.0,
+            ::plus(), ::multiplies());
+    HPX_UNUSED(result);
+}
+#endif
+
 std::uint64_t average_out_transform_reduce(std::size_t vector_size)
 {
     measure_transform_reduce(vector_size);
@@ -79,6 +117,14 @@ std::uint64_t average_out_transform_reduce_old(std::size_t vector_size)
     return std::uint64_t(1);
 }
 
+#if defined(HPX_HAVE_DATAPAR)
+std::uint64_t average_out_transform_reduce_datapar(std::size_t vector_size)
+{
+    measure_transform_reduce_datapar(vector_size);
+    return std::uint64_t(1);
+}
+#endif
+
 int hpx_main(boost::program_options::variables_map& vm)
 {
     std::size_t vector_size = vm["vector_size"].as<std::size_t>();
@@ -90,15 +136,27 @@ int hpx_main(boost::program_options::variables_map& vm)
         std::uint64_t tr_time = average_out_transform_reduce(vector_size);
         std::uint64_t tr_old_time = average_out_transform_reduce_old(
             vector_size);
+#if defined(HPX_HAVE_DATAPAR)
+        std::uint64_t tr_datapar_time = average_out_transform_reduce_datapar(
+            vector_size);
+#endif
 
         if(csvoutput) {
             hpx::cout << "," << tr_time/1e9
-                      << "," << tr_old_time/1e9 << "\n" << hpx::flush;
+                      << "," << tr_old_time/1e9
+#if defined(HPX_HAVE_DATAPAR)
+                      << "," << tr_datapar_time/1e9
+#endif
+                      << "\n" << hpx::flush;
         } else {
             hpx::cout << "transform_reduce: " << std::right
                 << std::setw(30) << tr_time/1e9 << "\n" << hpx::flush;
             hpx::cout << "old_transform_reduce" << std::right
                 << std::setw(30) << tr_old_time/1e9 << "\n" << hpx::flush;
+#if defined(HPX_HAVE_DATAPAR)
+            hpx::cout << "transform_reduce(datapar): " << std::right
+                << std::setw(30) << tr_datapar_time/1e9 << "\n" << hpx::flush;
+#endif
         }
     }
     return hpx::finalize();
@@ -6,6 +6,7 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 #include <hpx/lcos/barrier.hpp>
+#include <hpx/lcos/dissemination_barrier.hpp>
 
 #include <cstddef>
 #include <iostream>
@@ -33,11 +34,52 @@ void global_barrier()
     }
 }
 
+void dissemination_barrier()
+{
+    hpx::lcos::dissemination_barrier b("dissemination_barrier");
+
+    hpx::util::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        b.wait();
+    }
+    double elapsed = t.elapsed();
+
+    if (hpx::get_locality_id() == 0)
+    {
+        std::cout << "Dissemination barrier: " << elapsed/iterations
+                  << " (seconds)\n";
+    }
+}
+
+// the same, overlapping each barrier with some work
+void dissemination_barrier_split_phase()
+{
+    hpx::lcos::dissemination_barrier b("dissemination_barrier_split_phase");
+
+    hpx::util::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        b.arrive();
+        hpx::this_thread::yield();
+        b.wait();
+    }
+    double elapsed = t.elapsed();
+
+    if (hpx::get_locality_id() == 0)
+    {
+        std::cout << "Dissemination barrier (split-phase): "
+                  << elapsed/iterations << " (seconds)\n";
+    }
+}
+
 int hpx_main()
 {
     if (hpx::get_locality_id() == 0)
         startup_end = hpx::util::high_resolution_timer::now();
     global_barrier();
+    dissemination_barrier();
+    dissemination_barrier_split_phase();
 
     if (hpx::get_locality_id() == 0)
         shutdown_start = hpx::util::high_resolution_timer::now();
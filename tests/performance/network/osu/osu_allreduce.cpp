@@ -0,0 +1,141 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// AllReduce network test, this benchmark has to be run on all localities
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/communicator.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#define SKIP 200
+#define SKIP_LARGE 10
+#define LARGE_MESSAGE_SIZE 8192
+#define ITERATIONS_LARGE 100
+
+///////////////////////////////////////////////////////////////////////////////
+struct params
+{
+    std::size_t max_msg_size;
+    std::size_t iterations;
+};
+
+boost::program_options::options_description params_desc()
+{
+    boost::program_options::options_description
+        desc("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc.add_options()
+        ("max-msg-size",
+         boost::program_options::value<std::size_t>()->default_value(1048576),
+         "Set maximum message size in bytes.")
+        ("iter",
+         boost::program_options::value<std::size_t>()->default_value(1000),
+         "Set number of iterations per message size.")
+        ;
+
+    return desc;
+}
+
+params process_args(boost::program_options::variables_map & vm)
+{
+    params p
+        = {
+            vm["max-msg-size"].as<std::size_t>()
+          , vm["iter"].as<std::size_t>()
+        };
+
+    return p;
+}
+
+void print_header(std::string const & benchmark)
+{
+    hpx::cout << "# " << benchmark << hpx::endl
+              << "# Size    Latency (microsec)" << hpx::endl
+              << hpx::flush;
+}
+
+void print_data(double elapsed, std::size_t size)
+{
+    hpx::cout << std::left << std::setw(10) << size
+              << elapsed
+              << hpx::endl << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double run_all_reduce(hpx::lcos::communicator& comm, std::size_t size,
+    std::size_t iterations, std::size_t skip)
+{
+    std::vector<double> data(size / sizeof(double), 1.0);
+
+    double elapsed = 0.0;
+    for (std::size_t i = 0; i < iterations + skip; ++i)
+    {
+        hpx::util::high_resolution_timer t;
+
+        data = hpx::lcos::all_reduce_elements(
+            comm, std::move(data), std::plus<double>()).get();
+
+        double t_elapsed = t.elapsed();
+        if (i >= skip)
+            elapsed += t_elapsed;
+    }
+
+    return (elapsed * 1e6) / iterations;
+}
+
+void run_benchmark(params const& p)
+{
+    // the communicator is created once and reused for all measurements
+    hpx::lcos::communicator comm("/osu/all_reduce");
+    bool const root = comm.this_site() == 0;
+
+    if (root)
+        print_header("OSU HPX AllReduce Latency Test");
+
+    for (std::size_t size = sizeof(double); size <= p.max_msg_size; size *= 2)
+    {
+        std::size_t skip = SKIP;
+        std::size_t iterations = p.iterations;
+        if (size > LARGE_MESSAGE_SIZE)
+        {
+            skip = SKIP_LARGE;
+            iterations = ITERATIONS_LARGE;
+        }
+
+        double latency = run_all_reduce(comm, size, iterations, skip);
+
+        // report the maximal latency observed by any site
+        latency = hpx::lcos::all_reduce(comm, latency,
+            [](double lhs, double rhs) { return (std::max)(lhs, rhs); }).get();
+
+        if (root)
+            print_data(latency, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    run_benchmark(process_args(vm));
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(params_desc(), argc, argv, cfg);
+}
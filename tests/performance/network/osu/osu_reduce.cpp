@@ -0,0 +1,153 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Elementwise Reduce network test, this benchmark has to be run on all
+// localities. It compares the predefined (vectorized) reduction operations
+// with a generic binary function object.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/iostreams.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/communicator_collectives.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#define SKIP 200
+#define SKIP_LARGE 5
+#define LARGE_MESSAGE_SIZE 8192
+#define ITERATIONS_LARGE 20
+
+///////////////////////////////////////////////////////////////////////////////
+struct params
+{
+    std::size_t max_msg_size;
+    std::size_t iterations;
+};
+
+boost::program_options::options_description params_desc()
+{
+    boost::program_options::options_description
+        desc("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc.add_options()
+        ("max-msg-size",
+         boost::program_options::value<std::size_t>()->default_value(16777216),
+         "Set maximum message size in bytes.")
+        ("iter",
+         boost::program_options::value<std::size_t>()->default_value(1000),
+         "Set number of iterations per message size.")
+        ;
+
+    return desc;
+}
+
+params process_args(boost::program_options::variables_map & vm)
+{
+    params p
+        = {
+            vm["max-msg-size"].as<std::size_t>()
+          , vm["iter"].as<std::size_t>()
+        };
+
+    return p;
+}
+
+void print_header(std::string const & benchmark)
+{
+    hpx::cout << "# " << benchmark << hpx::endl
+              << "# Size    Latency (microsec)" << hpx::endl
+              << "#         reduction::plus   std::plus   reduction::maximum"
+              << hpx::endl
+              << hpx::flush;
+}
+
+void print_data(std::vector<double> const& elapsed, std::size_t size)
+{
+    hpx::cout << std::left << std::setw(10) << size;
+    for (double e : elapsed)
+        hpx::cout << std::left << std::setw(18) << e;
+    hpx::cout << hpx::endl << hpx::flush;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+double run_reduce(hpx::lcos::communicator& comm, std::size_t size,
+    std::size_t iterations, std::size_t skip, F op)
+{
+    std::vector<double> const data(size / sizeof(double), 1.0);
+
+    double elapsed = 0.0;
+    for (std::size_t i = 0; i < iterations + skip; ++i)
+    {
+        hpx::util::high_resolution_timer t;
+
+        hpx::lcos::reduce_elements(comm, data, op).get();
+
+        double t_elapsed = t.elapsed();
+        if (i >= skip)
+            elapsed += t_elapsed;
+    }
+
+    return (elapsed * 1e6) / iterations;
+}
+
+void run_benchmark(params const& p)
+{
+    // the communicator is created once and reused for all measurements
+    hpx::lcos::communicator comm("/osu/reduce");
+    bool const root = comm.this_site() == 0;
+
+    if (root)
+        print_header("OSU HPX Elementwise Reduce Latency Test");
+
+    for (std::size_t size = sizeof(double); size <= p.max_msg_size; size *= 2)
+    {
+        std::size_t skip = SKIP;
+        std::size_t iterations = p.iterations;
+        if (size > LARGE_MESSAGE_SIZE)
+        {
+            skip = SKIP_LARGE;
+            iterations = ITERATIONS_LARGE;
+        }
+
+        std::vector<double> latency = {
+            run_reduce(comm, size, iterations, skip,
+                hpx::lcos::reduction::plus()),
+            run_reduce(comm, size, iterations, skip, std::plus<double>()),
+            run_reduce(comm, size, iterations, skip,
+                hpx::lcos::reduction::maximum())
+        };
+
+        // report the maximal latency observed by any site
+        latency = hpx::lcos::all_reduce_elements(comm, std::move(latency),
+            hpx::lcos::reduction::maximum()).get();
+
+        if (root)
+            print_data(latency, size);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    run_benchmark(process_args(vm));
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    return hpx::init(params_desc(), argc, argv, cfg);
+}
@@ -0,0 +1,165 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/communicator_collectives.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_reduce(hpx::lcos::communicator& comm)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    // the same communicator is used for all iterations
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::future<std::size_t> result = hpx::lcos::all_reduce(
+            comm, this_site + i, std::plus<std::size_t>());
+
+        std::size_t sum = 0;
+        for (std::size_t j = 0; j != num_sites; ++j)
+            sum += j + i;
+
+        HPX_TEST_EQ(result.get(), sum);
+    }
+
+    // the values are combined in the order of the sites
+    std::string expected;
+    for (std::size_t j = 0; j != num_sites; ++j)
+        expected += char('a' + j);
+
+    HPX_TEST_EQ(hpx::lcos::all_reduce(comm, std::string(1, char('a' + this_site)),
+        std::plus<std::string>()).get(), expected);
+}
+
+void test_all_reduce_elements(hpx::lcos::communicator& comm,
+    std::size_t size)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    std::vector<double> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+        values[i] = double(this_site * i);
+
+    std::vector<double> result = hpx::lcos::all_reduce_elements(
+        comm, std::move(values), std::plus<double>()).get();
+
+    HPX_TEST_EQ(result.size(), size);
+
+    double const factor = double(num_sites * (num_sites - 1) / 2);
+    for (std::size_t i = 0; i != size; ++i)
+        HPX_TEST_EQ(result[i], factor * i);
+}
+
+void test_reduce_elements(hpx::lcos::communicator& comm, std::size_t size)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    std::vector<double> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+        values[i] = double(this_site * i);
+
+    // both reductions are in flight at the same time
+    hpx::future<std::vector<double> > max_result =
+        hpx::lcos::all_reduce_elements(
+            comm, values, hpx::lcos::reduction::maximum());
+
+    std::size_t const root = num_sites - 1;
+    hpx::future<std::vector<double> > sum_result =
+        hpx::lcos::reduce_elements(
+            comm, values, hpx::lcos::reduction::plus(), root);
+
+    std::vector<double> result = max_result.get();
+    HPX_TEST_EQ(result.size(), size);
+    for (std::size_t i = 0; i != size; ++i)
+        HPX_TEST_EQ(result[i], double((num_sites - 1) * i));
+
+    result = sum_result.get();
+    if (this_site == root)
+    {
+        HPX_TEST_EQ(result.size(), size);
+
+        double const factor = double(num_sites * (num_sites - 1) / 2);
+        for (std::size_t i = 0; i != size; ++i)
+            HPX_TEST_EQ(result[i], factor * i);
+    }
+    else
+    {
+        HPX_TEST(result.empty());
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(std::string const& name,
+    std::vector<hpx::id_type> const& localities, std::size_t this_site)
+{
+    hpx::lcos::communicator comm(name, localities, this_site);
+    test_all_reduce(comm);
+    test_all_reduce_elements(comm, 10);
+    test_all_reduce_elements(comm, 100000);
+    test_reduce_elements(comm, 10);
+    test_reduce_elements(comm, 100000);
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/all_reduce/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+        sites.push_back(hpx::async(&run_site, name, localities, i));
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality
+    hpx::lcos::communicator comm("/test/all_reduce");
+    test_all_reduce(comm);
+    test_all_reduce_elements(comm, 10);
+    test_all_reduce_elements(comm, 100000);
+    test_reduce_elements(comm, 10);
+    test_reduce_elements(comm, 100000);
+
+    test_local_sites(1);
+    test_local_sites(4);
+    test_local_sites(5);
+    test_local_sites(7);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,162 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/all_gather.hpp>
+#include <hpx/lcos/all_to_all.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+typedef hpx::serialization::serialize_buffer<int> buffer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_gather(hpx::lcos::communicator& comm)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    for (std::size_t i = 0; i != 5; ++i)
+    {
+        std::vector<std::size_t> result =
+            hpx::lcos::all_gather(comm, this_site + i).get();
+
+        HPX_TEST_EQ(result.size(), num_sites);
+        for (std::size_t j = 0; j != num_sites; ++j)
+            HPX_TEST_EQ(result[j], j + i);
+    }
+
+    std::vector<std::string> names = hpx::lcos::all_gather(
+        comm, std::to_string(this_site)).get();
+
+    HPX_TEST_EQ(names.size(), num_sites);
+    for (std::size_t j = 0; j != num_sites; ++j)
+        HPX_TEST_EQ(names[j], std::to_string(j));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_all_to_all(hpx::lcos::communicator& comm)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    for (std::size_t i = 0; i != 5; ++i)
+    {
+        std::vector<std::size_t> values(num_sites);
+        for (std::size_t j = 0; j != num_sites; ++j)
+            values[j] = 100 * this_site + j + i;
+
+        std::vector<std::size_t> result =
+            hpx::lcos::all_to_all(comm, std::move(values)).get();
+
+        HPX_TEST_EQ(result.size(), num_sites);
+        for (std::size_t j = 0; j != num_sites; ++j)
+            HPX_TEST_EQ(result[j], 100 * j + this_site + i);
+    }
+}
+
+void test_all_to_all_v(hpx::lcos::communicator& comm)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    // site i sends j + 1 elements with the value i to site j
+    std::vector<std::vector<int> > values(num_sites);
+    for (std::size_t j = 0; j != num_sites; ++j)
+        values[j].assign(j + 1, int(this_site));
+
+    std::vector<std::vector<int> > result =
+        hpx::lcos::all_to_all_v(comm, std::move(values)).get();
+
+    HPX_TEST_EQ(result.size(), num_sites);
+    for (std::size_t j = 0; j != num_sites; ++j)
+    {
+        HPX_TEST_EQ(result[j].size(), this_site + 1);
+        for (int v : result[j])
+            HPX_TEST_EQ(v, int(j));
+    }
+
+    // the same using serialize_buffer's
+    std::vector<buffer_type> buffers;
+    for (std::size_t j = 0; j != num_sites; ++j)
+    {
+        buffer_type b(j + 1);
+        for (std::size_t k = 0; k != j + 1; ++k)
+            b[k] = int(this_site);
+        buffers.push_back(b);
+    }
+
+    std::vector<buffer_type> received =
+        hpx::lcos::all_to_all_v(comm, std::move(buffers)).get();
+
+    HPX_TEST_EQ(received.size(), num_sites);
+    for (std::size_t j = 0; j != num_sites; ++j)
+    {
+        HPX_TEST_EQ(received[j].size(), this_site + 1);
+        for (std::size_t k = 0; k != received[j].size(); ++k)
+            HPX_TEST_EQ(received[j][k], int(j));
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(std::string const& name,
+    std::vector<hpx::id_type> const& localities, std::size_t this_site)
+{
+    hpx::lcos::communicator comm(name, localities, this_site);
+    test_all_gather(comm);
+    test_all_to_all(comm);
+    test_all_to_all_v(comm);
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/all_to_all/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+        sites.push_back(hpx::async(&run_site, name, localities, i));
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality
+    hpx::lcos::communicator comm("/test/all_to_all");
+    test_all_gather(comm);
+    test_all_to_all(comm);
+    test_all_to_all_v(comm);
+
+    test_local_sites(1);
+    test_local_sites(4);
+    test_local_sites(6);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
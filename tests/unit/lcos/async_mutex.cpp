@@ -0,0 +1,137 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/async.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<int> active(0);
+std::size_t counter = 0;
+
+void increment()
+{
+    HPX_TEST_EQ(++active, 1);
+    ++counter;
+    --active;
+}
+
+int get_counter()
+{
+    return static_cast<int>(counter);
+}
+
+void test_async_mutex()
+{
+    hpx::lcos::local::async_mutex mtx;
+
+    // uncontended lock_async returns a ready future
+    hpx::future<void> f1 = mtx.lock_async();
+    HPX_TEST(f1.is_ready());
+    HPX_TEST(mtx.is_locked());
+    HPX_TEST(!mtx.try_lock());
+
+    // contended lock_async is handed the lock on unlock
+    hpx::future<void> f2 = mtx.lock_async();
+    HPX_TEST(!f2.is_ready());
+    HPX_TEST_EQ(mtx.num_waiters(), std::size_t(1));
+
+    mtx.unlock();
+    HPX_TEST(f2.is_ready());
+    HPX_TEST(mtx.is_locked());
+
+    mtx.unlock();
+    HPX_TEST(!mtx.is_locked());
+
+    // guarded functions never run concurrently
+    counter = 0;
+    std::vector<hpx::future<void> > results;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        // the returned future<future<void> > is implicitly unwrapped
+        results.push_back(hpx::async([&mtx]() -> hpx::future<void>
+            {
+                return hpx::lcos::local::run_guarded(mtx, &increment);
+            }));
+    }
+    hpx::wait_all(results);
+
+    hpx::future<int> result =
+        hpx::lcos::local::run_guarded(mtx, &get_counter);
+    HPX_TEST_EQ(result.get(), 100);
+    HPX_TEST(!mtx.is_locked());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_async_semaphore()
+{
+    hpx::lcos::local::async_semaphore sem(2);
+
+    hpx::future<void> f1 = sem.wait_async();
+    hpx::future<void> f2 = sem.wait_async();
+    HPX_TEST(f1.is_ready() && f2.is_ready());
+    HPX_TEST_EQ(sem.value(), std::int64_t(0));
+
+    // waiters are served in order
+    hpx::future<void> f3 = sem.wait_async(2);
+    hpx::future<void> f4 = sem.wait_async(1);
+    HPX_TEST(!sem.try_wait());
+
+    sem.signal();
+    HPX_TEST(!f3.is_ready() && !f4.is_ready());
+
+    sem.signal();
+    HPX_TEST(f3.is_ready() && !f4.is_ready());
+
+    sem.signal(3);
+    HPX_TEST(f4.is_ready());
+    HPX_TEST_EQ(sem.value(), std::int64_t(2));
+
+    // guarded functions run with the requested credits held
+    counter = 0;
+    hpx::lcos::local::async_semaphore one(1);
+    std::vector<hpx::future<void> > results;
+    for (std::size_t i = 0; i != 100; ++i)
+    {
+        results.push_back(
+            hpx::lcos::local::run_guarded(one, 1, &increment));
+    }
+    hpx::wait_all(results);
+
+    HPX_TEST_EQ(counter, std::size_t(100));
+    HPX_TEST_EQ(one.value(), std::int64_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_async_mutex();
+    test_async_semaphore();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,139 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+
+#if !defined(HPX_HAVE_AWAIT)
+#error "This test requires compiler support for await"
+#endif
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/local_lcos.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/lcos/task.hpp>
+
+#include <hpx/util/lightweight_test.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> fib(int n)
+{
+    if (n >= 2)
+        n = co_await fib(n - 1) + co_await fib(n - 2);
+    co_return n;
+}
+
+void test_symmetric_transfer()
+{
+    HPX_TEST_EQ(hpx::lcos::to_future(fib(15)).get(), 610);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> add_futures(hpx::future<int> f, hpx::shared_future<int> sf)
+{
+    int a = co_await std::move(f);
+    int b = co_await sf;
+    co_return a + b;
+}
+
+void test_futures()
+{
+    hpx::shared_future<int> sf = hpx::async([]() { return 2; });
+    HPX_TEST_EQ(hpx::lcos::to_future(
+        add_futures(hpx::async([]() { return 40; }), sf)).get(), 42);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<int> sum_channel(hpx::lcos::local::channel<int> c, int count)
+{
+    int sum = 0;
+    for (int i = 0; i != count; ++i)
+        sum += co_await c;
+    co_return sum;
+}
+
+void test_channel()
+{
+    hpx::lcos::local::channel<int> c;
+    hpx::future<int> f = hpx::lcos::to_future(sum_channel(c, 10));
+    for (int i = 0; i != 10; ++i)
+        c.set(i);
+    HPX_TEST_EQ(f.get(), 45);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<hpx::thread::id> switch_thread()
+{
+    co_await hpx::parallel::execution::parallel_executor();
+    co_return hpx::this_thread::get_id();
+}
+
+void test_executor()
+{
+    HPX_TEST(hpx::lcos::to_future(switch_thread()).get() !=
+        hpx::this_thread::get_id());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+hpx::task<> throw_exception()
+{
+    co_await hpx::make_ready_future();
+    throw std::runtime_error("throw_exception");
+}
+
+hpx::task<> await_exception(bool& caught)
+{
+    try {
+        co_await throw_exception();
+    }
+    catch (std::runtime_error const&) {
+        caught = true;
+    }
+}
+
+void test_exception()
+{
+    bool caught = false;
+    hpx::lcos::to_future(await_exception(caught)).get();
+    HPX_TEST(caught);
+
+    bool caught_future = false;
+    try {
+        hpx::lcos::to_future(throw_exception()).get();
+    }
+    catch (std::runtime_error const&) {
+        caught_future = true;
+    }
+    HPX_TEST(caught_future);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_symmetric_transfer();
+    test_futures();
+    test_channel();
+    test_executor();
+    test_exception();
+
+    HPX_TEST_EQ(hpx::finalize(), 0);
+    return hpx::util::report_errors();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    return hpx::init(argc, argv, cfg);
+}
@@ -8,9 +8,12 @@
 #include <hpx/include/actions.hpp>
 #include <hpx/include/components.hpp>
 #include <hpx/include/lcos.hpp>
+#include <hpx/lcos/buffered_send_channel.hpp>
 #include <hpx/util/lightweight_test.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
 #include <numeric>
 #include <string>
 #include <utility>
@@ -278,6 +281,71 @@ void channel_as_lco(hpx::id_type const& here, hpx::id_type const& there)
     HPX_TEST_EQ(lco.get(hpx::launch::sync), 42);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void batched_set_get(hpx::id_type const& loc)
+{
+    hpx::lcos::channel<int> c(loc);
+
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 0);
+
+    c.set_n(values);
+    c.set_n(hpx::launch::async, std::vector<int>{ 100, 101 }).get();
+
+    std::vector<int> received = c.get_n(hpx::launch::sync, 102);
+    HPX_TEST_EQ(received.size(), std::size_t(102));
+    for (std::size_t i = 0; i != received.size(); ++i)
+        HPX_TEST_EQ(received[i], int(i));
+
+    // get_n may be invoked before the values are available
+    hpx::lcos::receive_channel<int> rc(c);
+    hpx::future<std::vector<int> > f = rc.get_n(3);
+
+    hpx::lcos::send_channel<int> sc(c);
+    sc.set_n(hpx::launch::apply, std::vector<int>{ 1, 2, 3 });
+
+    HPX_TEST((f.get() == std::vector<int>{ 1, 2, 3 }));
+}
+
+void buffered_set(hpx::id_type const& loc)
+{
+    hpx::lcos::channel<int> c(loc);
+
+    // values are sent once the buffer is full, or when flushed, separate
+    // messages may arrive in any order
+    {
+        hpx::lcos::buffered_send_channel<int> bc(c, 10, 0);
+        for (int i = 0; i != 25; ++i)
+            bc.set(i);
+
+        std::vector<int> received = c.get_n(hpx::launch::sync, 20);
+        HPX_TEST_EQ(received.size(), std::size_t(20));
+        std::sort(received.begin(), received.end());
+        for (std::size_t i = 0; i != received.size(); ++i)
+            HPX_TEST_EQ(received[i], int(i));
+
+        bc.flush();
+        received = c.get_n(hpx::launch::sync, 5);
+        HPX_TEST_EQ(received.size(), std::size_t(5));
+        for (std::size_t i = 0; i != received.size(); ++i)
+            HPX_TEST_EQ(received[i], int(i + 20));
+    }
+
+    // values are sent after the given time interval
+    {
+        hpx::lcos::buffered_send_channel<int> bc(c, 1000, 1000);
+        bc.set(42);
+        HPX_TEST_EQ(c.get(hpx::launch::sync), 42);
+    }
+
+    // the remaining values are sent on destruction
+    {
+        hpx::lcos::buffered_send_channel<int> bc(c, 1000, 0);
+        bc.set(43);
+    }
+    HPX_TEST_EQ(c.get(hpx::launch::sync), 43);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int main(int argc, char* argv[])
 {
@@ -297,6 +365,9 @@ int main(int argc, char* argv[])
 
     channel_as_lco(here, here);
 
+    batched_set_get(here);
+    buffered_set(here);
+
     std::vector<hpx::id_type> remote_localities = hpx::find_remote_localities();
     for (hpx::id_type id : remote_localities)
     {
@@ -307,6 +378,9 @@ int main(int argc, char* argv[])
 
         channel_as_lco(id, here);
         channel_as_lco(here, id);
+
+        batched_set_get(id);
+        buffered_set(id);
     }
 
     return hpx::util::report_errors();
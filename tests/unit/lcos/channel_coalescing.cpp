@@ -0,0 +1,85 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/lcos/buffered_send_channel.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+#include <vector>
+
+HPX_REGISTER_CHANNEL(int);
+HPX_CHANNEL_USES_MESSAGE_COALESCING(int);
+
+///////////////////////////////////////////////////////////////////////////////
+// the parcels setting the values may be combined and delivered in any order,
+// only the received values are compared
+void test_received(std::vector<int> received, int first, int count)
+{
+    HPX_TEST_EQ(received.size(), std::size_t(count));
+
+    std::vector<int> expected(count);
+    std::iota(expected.begin(), expected.end(), first);
+
+    std::sort(received.begin(), received.end());
+    HPX_TEST(received == expected);
+}
+
+void set_get(hpx::id_type const& loc)
+{
+    hpx::lcos::channel<int> c(loc);
+
+    for (int i = 0; i != 100; ++i)
+        c.set(hpx::launch::apply, i);
+    test_received(c.get_n(hpx::launch::sync, 100), 0, 100);
+
+    std::vector<int> values(100);
+    std::iota(values.begin(), values.end(), 100);
+    for (std::size_t i = 0; i != values.size(); i += 10)
+    {
+        c.set_n(hpx::launch::apply, std::vector<int>(
+            values.begin() + i, values.begin() + i + 10));
+    }
+    test_received(c.get_n(hpx::launch::sync, 100), 100, 100);
+}
+
+void buffered_set(hpx::id_type const& loc)
+{
+    hpx::lcos::channel<int> c(loc);
+
+    {
+        hpx::lcos::buffered_send_channel<int> bc1(c, 7, 0);
+        hpx::lcos::buffered_send_channel<int> bc2(c, 13, 0);
+        for (int i = 0; i != 100; ++i)
+        {
+            bc1.set(i);
+            bc2.set(i + 100);
+        }
+    }
+    test_received(c.get_n(hpx::launch::sync, 200), 0, 200);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main(int argc, char* argv[])
+{
+    hpx::id_type here = hpx::find_here();
+
+    set_get(here);
+    buffered_set(here);
+
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        set_get(id);
+        buffered_set(id);
+    }
+
+    return hpx::util::report_errors();
+}
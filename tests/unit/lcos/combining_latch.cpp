@@ -0,0 +1,141 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/combining_latch.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// every site expects a different number of count downs, some none at all
+std::ptrdiff_t site_count(std::size_t site)
+{
+    return std::ptrdiff_t(site % 3) * 4;
+}
+
+void run_site(hpx::lcos::communicator comm,
+    std::shared_ptr<std::atomic<std::size_t> > arrived)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::ptrdiff_t const count = site_count(comm.this_site());
+
+    std::size_t total = 0;
+    for (std::size_t i = 0; i != num_sites; ++i)
+        total += site_count(i);
+
+    for (std::size_t iteration = 0; iteration != 5; ++iteration)
+    {
+        hpx::lcos::combining_latch l(comm, count);
+
+        // split-phase: the participants arrive without blocking and wait
+        // later
+        std::vector<hpx::future<void> > participants;
+        for (std::ptrdiff_t i = 0; i != count; ++i)
+        {
+            participants.push_back(hpx::async(
+                [l, arrived]() mutable
+                {
+                    ++*arrived;
+                    l.arrive();
+                    hpx::this_thread::yield();
+                    l.wait();
+                }));
+        }
+
+        l.wait(hpx::launch::async).get();
+        HPX_TEST(l.is_ready());
+
+        // no site may be released before all participants have arrived
+        HPX_TEST_LTE((iteration + 1) * total, arrived->load());
+
+        hpx::wait_all(participants);
+        for (hpx::future<void>& f : participants)
+            f.get();
+
+        // all count downs of this site at once
+        hpx::lcos::combining_latch all(comm, count);
+        all.count_down(count);
+        all.wait();
+        HPX_TEST(all.is_ready());
+    }
+
+    // counting down too often is an error
+    hpx::lcos::combining_latch l(comm, 1);
+
+    bool caught_exception = false;
+    try {
+        l.count_down(2);
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST(!l.is_ready());
+
+    l.arrive_and_wait();
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/combining_latch/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+    std::shared_ptr<std::atomic<std::size_t> > arrived =
+        std::make_shared<std::atomic<std::size_t> >(0);
+
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        sites.push_back(hpx::async(&run_site,
+            hpx::lcos::communicator(name, localities, i), arrived));
+    }
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality
+    {
+        hpx::lcos::communicator comm("/test/combining_latch");
+        for (std::size_t i = 0; i != 10; ++i)
+        {
+            hpx::lcos::combining_latch l(comm, 1);
+            l.arrive();
+            l.wait();
+        }
+    }
+
+    test_local_sites(1);
+    test_local_sites(2);
+    test_local_sites(5);
+    test_local_sites(8);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
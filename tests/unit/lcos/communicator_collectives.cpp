@@ -0,0 +1,132 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/communicator_collectives.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_collectives(hpx::lcos::communicator& comm)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    // the same communicator is used for all collective operations
+    for (std::size_t root = 0; root != num_sites; ++root)
+    {
+        // broadcast
+        std::size_t value = hpx::lcos::broadcast(comm,
+            this_site == root ? 42 + root : std::size_t(0), root).get();
+        HPX_TEST_EQ(value, 42 + root);
+
+        // reduce
+        std::size_t sum = hpx::lcos::reduce(comm, this_site + 1,
+            [](std::size_t lhs, std::size_t rhs) { return lhs + rhs; },
+            root).get();
+        if (this_site == root)
+            HPX_TEST_EQ(sum, num_sites * (num_sites + 1) / 2);
+
+        // reduce preserves the order of the sites (starting at the root)
+        std::string concatenated = hpx::lcos::reduce(comm,
+            std::to_string(this_site),
+            [](std::string const& lhs, std::string const& rhs)
+            {
+                return lhs + rhs;
+            },
+            root).get();
+        if (this_site == root)
+        {
+            std::string expected;
+            for (std::size_t i = 0; i != num_sites; ++i)
+                expected += std::to_string((root + i) % num_sites);
+            HPX_TEST_EQ(concatenated, expected);
+        }
+
+        // gather
+        std::vector<std::string> names = hpx::lcos::gather(comm,
+            std::to_string(this_site), root).get();
+        if (this_site == root)
+        {
+            HPX_TEST_EQ(names.size(), num_sites);
+            for (std::size_t i = 0; i != names.size(); ++i)
+                HPX_TEST_EQ(names[i], std::to_string(i));
+        }
+        else
+        {
+            HPX_TEST(names.empty());
+        }
+
+        // scatter
+        std::vector<std::size_t> values;
+        if (this_site == root)
+        {
+            for (std::size_t i = 0; i != num_sites; ++i)
+                values.push_back(10 * i + root);
+        }
+        std::size_t received =
+            hpx::lcos::scatter(comm, std::move(values), root).get();
+        HPX_TEST_EQ(received, 10 * this_site + root);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(std::string const& name,
+    std::vector<hpx::id_type> const& localities, std::size_t this_site)
+{
+    hpx::lcos::communicator comm(name, localities, this_site);
+    test_collectives(comm);
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/communicator_collectives/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+        sites.push_back(hpx::async(&run_site, name, localities, i));
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality, created once and used for all operations
+    hpx::lcos::communicator comm("/test/communicator_collectives");
+    for (std::size_t i = 0; i != 10; ++i)
+        test_collectives(comm);
+
+    test_local_sites(1);
+    test_local_sites(3);
+    test_local_sites(6);
+    test_local_sites(8);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
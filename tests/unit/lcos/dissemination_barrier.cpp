@@ -0,0 +1,114 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/dissemination_barrier.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+std::size_t const iterations = 20;
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(std::string const& name,
+    std::vector<hpx::id_type> const& localities, std::size_t this_site,
+    std::shared_ptr<std::atomic<std::size_t> > arrived)
+{
+    std::size_t const num_sites = localities.size();
+
+    hpx::lcos::dissemination_barrier b(
+        hpx::lcos::communicator(name, localities, this_site));
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        ++*arrived;
+        b.wait();
+
+        // no site may leave the barrier before all sites have arrived
+        HPX_TEST_LTE((2 * i + 1) * num_sites, arrived->load());
+
+        // split-phase: work placed between arrive and wait overlaps with
+        // the synchronization
+        ++*arrived;
+        b.arrive();
+        hpx::this_thread::yield();
+        b.wait(hpx::launch::async).get();
+
+        HPX_TEST_LTE((2 * i + 2) * num_sites, arrived->load());
+    }
+
+    // arriving twice is an error
+    bool caught_exception = false;
+    b.arrive();
+    try {
+        b.arrive();
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    b.wait();
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/dissemination_barrier/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+    std::shared_ptr<std::atomic<std::size_t> > arrived =
+        std::make_shared<std::atomic<std::size_t> >(0);
+
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+    {
+        sites.push_back(
+            hpx::async(&run_site, name, localities, i, arrived));
+    }
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality
+    {
+        hpx::lcos::dissemination_barrier b("/test/dissemination_barrier");
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            b.arrive();
+            b.wait();
+        }
+    }
+
+    test_local_sites(1);
+    test_local_sites(2);
+    test_local_sites(5);
+    test_local_sites(8);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,190 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/all_reduce.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/distributed_task_pool.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+std::atomic<std::size_t> visited(0);
+std::atomic<std::size_t> slept(0);
+
+///////////////////////////////////////////////////////////////////////////////
+// visit all nodes of a tree with the given depth and branching factor 3
+void visit(std::size_t depth);
+HPX_PLAIN_ACTION(visit, visit_action);
+
+void visit(std::size_t depth)
+{
+    ++visited;
+    if (depth == 0)
+        return;
+
+    for (std::size_t i = 0; i != 3; ++i)
+    {
+        hpx::lcos::this_task_pool::post(
+            hpx::lcos::make_task<visit_action>(depth - 1));
+    }
+}
+
+std::size_t num_nodes(std::size_t depth)
+{
+    std::size_t nodes = 1;
+    std::size_t level = 1;
+    for (std::size_t i = 0; i != depth; ++i)
+    {
+        level *= 3;
+        nodes += level;
+    }
+    return nodes;
+}
+
+void sleep_a_while(std::size_t ms)
+{
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    ++slept;
+}
+HPX_PLAIN_ACTION(sleep_a_while, sleep_action);
+
+void fail()
+{
+    HPX_THROW_EXCEPTION(hpx::bad_parameter, "fail", "task failed");
+}
+HPX_PLAIN_ACTION(fail, fail_action);
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(std::string const& name,
+    std::vector<hpx::id_type> const& localities, std::size_t this_site)
+{
+    hpx::lcos::distributed_task_pool pool(name, localities, this_site, 2);
+
+    // all work is generated by site 0
+    for (std::size_t depth = 0; depth != 6; ++depth)
+    {
+        if (this_site == 0)
+            pool.post(hpx::lcos::make_task<visit_action>(depth));
+        pool.wait();
+    }
+
+    // several phases in a row
+    for (std::size_t phase = 0; phase != 3; ++phase)
+    {
+        pool.post(hpx::lcos::make_task<visit_action>(std::size_t(2)));
+        pool.wait();
+    }
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/distributed_task_pool/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    visited = 0;
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+        sites.push_back(hpx::async(&run_site, name, localities, i));
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+
+    std::size_t expected = 3 * num_sites * num_nodes(2);
+    for (std::size_t depth = 0; depth != 6; ++depth)
+        expected += num_nodes(depth);
+
+    HPX_TEST_EQ(visited.load(), expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality
+    {
+        hpx::lcos::distributed_task_pool pool("/test/distributed_task_pool");
+        hpx::lcos::communicator comm = pool.get_communicator();
+
+        std::size_t const this_site = comm.this_site();
+        std::size_t const num_sites = comm.num_sites();
+
+        // a tree search started on site 0 only
+        std::size_t const depth = 8;
+        if (this_site == 0)
+            pool.post(hpx::lcos::make_task<visit_action>(depth));
+        pool.wait();
+
+        HPX_TEST_EQ(hpx::lcos::all_reduce(comm, visited.load(),
+            std::plus<std::size_t>()).get(), num_nodes(depth));
+
+        // long running tasks posted to site 0 may be stolen by other sites,
+        // each of them is executed exactly once
+        std::size_t const num_tasks = 100 * num_sites;
+        if (this_site == 0)
+        {
+            for (std::size_t i = 0; i != num_tasks; ++i)
+                pool.post(hpx::lcos::make_task<sleep_action>(std::size_t(1)));
+        }
+        pool.wait();
+
+        HPX_TEST_EQ(pool.queue_length(), std::size_t(0));
+        HPX_TEST_EQ(hpx::lcos::all_reduce(comm, slept.load(),
+            std::plus<std::size_t>()).get(), num_tasks);
+
+        // exceptions thrown by tasks are rethrown by wait on the site which
+        // executed the task
+        pool.post(hpx::lcos::make_task<fail_action>());
+
+        std::size_t caught_exceptions = 0;
+        try {
+            pool.wait();
+        }
+        catch (hpx::exception const&) {
+            caught_exceptions = 1;
+        }
+        HPX_TEST_LT(std::size_t(0), hpx::lcos::all_reduce(comm,
+            caught_exceptions, std::plus<std::size_t>()).get());
+    }
+
+    // posting from outside of a task
+    bool caught_exception = false;
+    try {
+        hpx::lcos::this_task_pool::post(
+            hpx::lcos::make_task<visit_action>(std::size_t(0)));
+    }
+    catch (hpx::exception const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    test_local_sites(1);
+    test_local_sites(2);
+    test_local_sites(4);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,101 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/pipelined_broadcast.hpp>
+#include <hpx/runtime/serialization/serialize_buffer.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+typedef hpx::serialization::serialize_buffer<double> buffer_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_pipelined_broadcast(hpx::lcos::communicator& comm)
+{
+    std::size_t const num_sites = comm.num_sites();
+    std::size_t const this_site = comm.this_site();
+
+    // the segment size is set to 1024 bytes (128 doubles) below, so this
+    // covers empty buffers, single and partial segments, and many segments
+    std::size_t const sizes[] = { 0, 1, 128, 1000, 100000 };
+
+    for (std::size_t root = 0; root != num_sites; ++root)
+    {
+        for (std::size_t size : sizes)
+        {
+            buffer_type data;
+            if (this_site == root)
+            {
+                data = buffer_type(size);
+                for (std::size_t i = 0; i != size; ++i)
+                    data[i] = double(i + root);
+            }
+
+            buffer_type result = hpx::lcos::pipelined_broadcast(
+                comm, data, root).get();
+
+            HPX_TEST_EQ(result.size(), size);
+            for (std::size_t i = 0; i != result.size(); ++i)
+                HPX_TEST_EQ(result[i], double(i + root));
+        }
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(std::string const& name,
+    std::vector<hpx::id_type> const& localities, std::size_t this_site)
+{
+    hpx::lcos::communicator comm(name, localities, this_site);
+    test_pipelined_broadcast(comm);
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/pipelined_broadcast/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+        sites.push_back(hpx::async(&run_site, name, localities, i));
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality
+    hpx::lcos::communicator comm("/test/pipelined_broadcast");
+    test_pipelined_broadcast(comm);
+
+    test_local_sites(1);
+    test_local_sites(2);
+    test_local_sites(7);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1",
+        "hpx.lcos.collectives.broadcast_segment_size!=1024"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
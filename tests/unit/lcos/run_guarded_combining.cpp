@@ -0,0 +1,143 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/local/composable_guard.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<int> active(0);
+int counter = 0;
+
+void incr()
+{
+    // no other task protected by the same guard may run concurrently
+    HPX_TEST_EQ(++active, 1);
+    ++counter;
+    --active;
+}
+
+void incr_and_throw()
+{
+    incr();
+    throw std::runtime_error("incr_and_throw");
+}
+
+int increments = 3000;
+
+// the guard may still be in use by a thread draining it when hpx_main exits
+hpx::lcos::local::combining_guard guard;
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("increments"))
+        increments = vm["increments"].as<int>();
+
+    // uncontended tasks are run directly
+    run_guarded(guard, &incr);
+    HPX_TEST_EQ(counter, 1);
+
+    // the exception of an uncontended task is reported to the caller and
+    // the guard stays usable afterwards
+    bool caught_exception = false;
+    try {
+        run_guarded(guard, &incr_and_throw);
+    }
+    catch (std::runtime_error const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(counter, 2);
+
+    // the exception of a task run by the owner of the guard on behalf of
+    // another thread is passed to the error handler of that task, it is
+    // not propagated to the owner
+    {
+        hpx::lcos::local::promise<void> entered, queued, handled;
+        hpx::future<void> entered_f = entered.get_future();
+        hpx::shared_future<void> queued_f = queued.get_future();
+        hpx::future<void> handled_f = handled.get_future();
+
+        hpx::future<void> owner = hpx::async([&entered, queued_f]() {
+            run_guarded(guard, [&entered, queued_f]() {
+                entered.set_value();
+                queued_f.get();
+                incr();
+            });
+        });
+        entered_f.get();
+
+        // both tasks are queued while the guard is owned
+        run_guarded_handled(guard, &incr_and_throw,
+            [&handled](std::exception_ptr const& e) {
+                handled.set_exception(e);
+            });
+        run_guarded(guard, &incr_and_throw);
+        queued.set_value();
+
+        owner.get();
+        HPX_TEST_EQ(counter, 5);
+
+        bool handled_exception = false;
+        try {
+            handled_f.get();
+        }
+        catch (std::runtime_error const&) {
+            handled_exception = true;
+        }
+        HPX_TEST(handled_exception);
+    }
+
+    // contended tasks are run by the owner of the guard
+    std::vector<hpx::future<void> > results;
+    for (int i = 0; i != increments; ++i)
+    {
+        results.push_back(hpx::async([]() {
+            run_guarded(guard, &incr);
+        }));
+    }
+    hpx::wait_all(results);
+
+    // wait for all queued tasks to have run
+    {
+        hpx::lcos::local::promise<int> p;
+        hpx::future<int> f = p.get_future();
+        run_guarded(guard, [&p]() { p.set_value(counter); });
+        HPX_TEST_EQ(f.get(), increments + 5);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    boost::program_options::options_description
+       desc_commandline("Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("increments,n", boost::program_options::value<int>()->default_value(3000),
+            "the number of times to increment the counter")
+        ;
+
+    // We force this test to use several threads by default.
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+      "HPX main exited with non-zero status");
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,136 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/communicator.hpp>
+#include <hpx/lcos/elementwise_reduction.hpp>
+#include <hpx/lcos/scan.hpp>
+#include <hpx/runtime/serialization/string.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+void test_scan(hpx::lcos::communicator& comm)
+{
+    std::size_t const this_site = comm.this_site();
+
+    // the same communicator is used for all iterations
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::future<std::size_t> inclusive = hpx::lcos::inclusive_scan(
+            comm, this_site + i, std::plus<std::size_t>());
+        hpx::future<std::size_t> exclusive = hpx::lcos::exclusive_scan(
+            comm, this_site + i, std::size_t(100), std::plus<std::size_t>());
+
+        std::size_t sum = 0;
+        for (std::size_t j = 0; j != this_site; ++j)
+            sum += j + i;
+
+        HPX_TEST_EQ(exclusive.get(), 100 + sum);
+        HPX_TEST_EQ(inclusive.get(), sum + this_site + i);
+    }
+
+    // the values are combined in the order of the sites
+    std::string expected;
+    for (std::size_t j = 0; j != this_site; ++j)
+        expected += char('a' + j);
+
+    std::string const value(1, char('a' + this_site));
+
+    HPX_TEST_EQ(hpx::lcos::exclusive_scan(comm, value, std::string(">"),
+        std::plus<std::string>()).get(), ">" + expected);
+    HPX_TEST_EQ(hpx::lcos::inclusive_scan(comm, value,
+        std::plus<std::string>()).get(), expected + value);
+}
+
+void test_scan_elements(hpx::lcos::communicator& comm, std::size_t size)
+{
+    std::size_t const this_site = comm.this_site();
+
+    std::vector<double> values(size);
+    for (std::size_t i = 0; i != size; ++i)
+        values[i] = double(this_site * i);
+
+    hpx::future<std::vector<double> > inclusive =
+        hpx::lcos::inclusive_scan_elements(
+            comm, values, hpx::lcos::reduction::plus());
+    hpx::future<std::vector<double> > exclusive =
+        hpx::lcos::exclusive_scan_elements(
+            comm, values, 1.0, hpx::lcos::reduction::plus());
+
+    double const factor = double(this_site * (this_site + 1) / 2);
+
+    std::vector<double> result = inclusive.get();
+    HPX_TEST_EQ(result.size(), size);
+    for (std::size_t i = 0; i != size; ++i)
+        HPX_TEST_EQ(result[i], factor * i);
+
+    result = exclusive.get();
+    HPX_TEST_EQ(result.size(), size);
+    for (std::size_t i = 0; i != size; ++i)
+        HPX_TEST_EQ(result[i], 1.0 + (factor - this_site) * i);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void run_site(std::string const& name,
+    std::vector<hpx::id_type> const& localities, std::size_t this_site)
+{
+    hpx::lcos::communicator comm(name, localities, this_site);
+    test_scan(comm);
+    test_scan_elements(comm, 10);
+    test_scan_elements(comm, 10000);
+}
+
+void test_local_sites(std::size_t num_sites)
+{
+    // several sites on the same locality
+    std::string const name = "/test/scan/local/" +
+        std::to_string(hpx::get_locality_id()) + "/" +
+        std::to_string(num_sites);
+
+    std::vector<hpx::id_type> localities(num_sites, hpx::find_here());
+
+    std::vector<hpx::future<void> > sites;
+    for (std::size_t i = 0; i != num_sites; ++i)
+        sites.push_back(hpx::async(&run_site, name, localities, i));
+
+    hpx::wait_all(sites);
+    for (hpx::future<void>& f : sites)
+        f.get();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    // one site per locality
+    hpx::lcos::communicator comm("/test/scan");
+    test_scan(comm);
+    test_scan_elements(comm, 10);
+    test_scan_elements(comm, 10000);
+
+    test_local_sites(1);
+    test_local_sites(2);
+    test_local_sites(5);
+    test_local_sites(8);
+    test_local_sites(13);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.run_hpx_main!=1"
+    };
+
+    HPX_TEST_EQ(hpx::init(argc, argv, cfg), 0);
+    return hpx::util::report_errors();
+}
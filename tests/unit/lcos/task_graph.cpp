@@ -0,0 +1,208 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/lcos/local/task_graph.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef hpx::lcos::local::task_graph task_graph;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_diamond()
+{
+    std::atomic<int> a(0), b(0), c(0), d(0);
+
+    task_graph g;
+    task_graph::node na = g.add([&]() { ++a; });
+    task_graph::node nb = g.add([&]() { HPX_TEST_EQ(b.load(), a - 1); ++b; },
+        {na});
+    task_graph::node nc = g.add([&]() { HPX_TEST_EQ(c.load(), a - 1); ++c; },
+        {na});
+    g.add([&]() { HPX_TEST(b == c); HPX_TEST_EQ(d.load(), b - 1); ++d; },
+        {nb, nc});
+
+    HPX_TEST_EQ(g.size(), std::size_t(4));
+
+    // replaying the graph runs each node once per iteration
+    for (int i = 0; i != 10; ++i)
+        g.run().get();
+
+    HPX_TEST_EQ(a.load(), 10);
+    HPX_TEST_EQ(b.load(), 10);
+    HPX_TEST_EQ(c.load(), 10);
+    HPX_TEST_EQ(d.load(), 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_stencil()
+{
+    std::size_t const np = 16;
+    std::size_t const nt = 20;
+
+    std::vector<int> current(np, 0), next(np, 0);
+    std::vector<int>* src = &current;
+    std::vector<int>* dst = &next;
+
+    // capture one time step: each partition depends on its neighbors
+    task_graph g;
+    std::vector<task_graph::node> nodes;
+    for (std::size_t i = 0; i != np; ++i)
+    {
+        nodes.push_back(g.add([&, i]() { (*dst)[i] = (*src)[i] + 1; }));
+    }
+
+    std::vector<task_graph::node> step;
+    for (std::size_t i = 0; i != np; ++i)
+    {
+        std::vector<task_graph::node> deps;
+        deps.push_back(nodes[i]);
+        if (i != 0)
+            deps.push_back(nodes[i - 1]);
+        if (i + 1 != np)
+            deps.push_back(nodes[i + 1]);
+
+        step.push_back(g.add([&, i]() { HPX_TEST((*dst)[i] > (*src)[i]); },
+            deps));
+    }
+
+    // replay with new inputs by swapping the buffers in between
+    for (std::size_t t = 0; t != nt; ++t)
+    {
+        g.run().get();
+        std::swap(src, dst);
+    }
+
+    for (std::size_t i = 0; i != np; ++i)
+        HPX_TEST_EQ((*src)[i], int(nt));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_typed()
+{
+    int input = 0;
+
+    // the values computed by the nodes are passed along the edges
+    task_graph g;
+    task_graph::typed_node<int> a = g.add_typed([&]() { return input; });
+    task_graph::typed_node<int> b = g.add_typed(
+        [](int x) { return x + 1; }, a);
+    task_graph::typed_node<std::string> c = g.add_typed(
+        [](int x) { return std::to_string(x); }, a);
+    task_graph::typed_node<std::string> d = g.add_typed(
+        [](int x, std::string const& y) { return y + std::to_string(x); },
+        b, c);
+
+    // typed nodes can be used as dependencies of untyped nodes
+    std::atomic<int> count(0);
+    g.add([&]() { ++count; }, {b, d});
+
+    HPX_TEST_EQ(g.size(), std::size_t(5));
+
+    for (int i = 0; i != 10; ++i)
+    {
+        input = i;
+        g.run().get();
+
+        HPX_TEST_EQ(a.get(), i);
+        HPX_TEST_EQ(b.get(), i + 1);
+        HPX_TEST_EQ(d.get(), std::to_string(i) + std::to_string(i + 1));
+    }
+    HPX_TEST_EQ(count.load(), 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_exception()
+{
+    std::atomic<int> count(0);
+
+    task_graph g;
+    task_graph::node n1 = g.add([]() { throw std::runtime_error("test"); });
+    g.add([&]() { ++count; }, {n1});
+
+    bool caught_exception = false;
+    try {
+        g.run().get();
+        HPX_TEST(false);
+    }
+    catch (std::runtime_error const&) {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(count.load(), 0);
+
+    // the graph can be reused after a failure
+    g.clear();
+    g.add([&]() { ++count; });
+    g.run().get();
+    HPX_TEST_EQ(count.load(), 1);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_foreign_node()
+{
+    task_graph g1;
+    task_graph g2;
+    task_graph::node n1 = g1.add([]() {});
+    g2.add([]() {});
+
+    // the index of n1 is valid in g2 as well
+    bool caught_exception = false;
+    try {
+        g2.add([]() {}, {n1});
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e) {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(g2.size(), std::size_t(1));
+
+    // default constructed handles don't refer to any graph
+    caught_exception = false;
+    try {
+        g1.add([]() {}, {task_graph::node()});
+        HPX_TEST(false);
+    }
+    catch (hpx::exception const& e) {
+        caught_exception = true;
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+    }
+    HPX_TEST(caught_exception);
+    HPX_TEST_EQ(g1.size(), std::size_t(1));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    test_diamond();
+    test_stencil();
+    test_typed();
+    test_exception();
+    test_foreign_node();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,203 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <hpx/include/parallel_for_loop.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+template <typename ExPolicy>
+void test_for_loop_2d(ExPolicy policy,
+    hpx::parallel::tiling<2> const& t)
+{
+    using namespace hpx::parallel;
+
+    std::ptrdiff_t const rows = 100 + gen() % 100;
+    std::ptrdiff_t const cols = 1000 + gen() % 1000;
+
+    // every index of the box is visited exactly once
+    std::vector<std::atomic<int> > visited(rows * cols);
+    for (auto& v : visited)
+        v.store(0);
+
+    for_loop(policy, index_box<2>({3, 5}, {rows, cols}), t,
+        [&](std::ptrdiff_t i, std::ptrdiff_t j)
+        {
+            ++visited[i * cols + j];
+        });
+
+    std::size_t count = 0;
+    for (std::ptrdiff_t i = 0; i != rows; ++i)
+    {
+        for (std::ptrdiff_t j = 0; j != cols; ++j)
+        {
+            int const expected = (i >= 3 && j >= 5) ? 1 : 0;
+            if (visited[i * cols + j].load() != expected)
+                ++count;
+        }
+    }
+    HPX_TEST_EQ(count, std::size_t(0));
+}
+
+template <typename ExPolicy>
+void test_for_loop_2d(ExPolicy policy)
+{
+    using namespace hpx::parallel;
+
+    test_for_loop_2d(policy, tiling<2>());
+    test_for_loop_2d(policy, tiling<2>({16, 64}));
+    test_for_loop_2d(policy, tiling<2>({0, 100}, tile_order::morton));
+    test_for_loop_2d(policy, tiling<2>({7, 13}, tile_order::morton, true));
+    test_for_loop_2d(policy, tiling<2>({0, 0}, tile_order::row_major, true));
+}
+
+template <typename ExPolicy>
+void test_for_loop_3d_induction_reduction(ExPolicy policy)
+{
+    using namespace hpx::parallel;
+
+    std::ptrdiff_t const n = 40;
+    std::vector<std::size_t> c(n * n * n, 0);
+
+    // the induction values are the positions in row-major order of the box
+    std::size_t pos = 0;
+    std::size_t sum = 0;
+    for_loop(policy, index_box<3>({n, n, n}),
+        tiling<3>({8, 0, 16}, tile_order::morton),
+        induction(pos), reduction_plus(sum),
+        [&](std::ptrdiff_t i, std::ptrdiff_t j, std::ptrdiff_t k,
+            std::size_t p, std::size_t& s)
+        {
+            c[(i * n + j) * n + k] = p;
+            s += std::size_t(i + j + k);
+        });
+
+    HPX_TEST_EQ(pos, std::size_t(n * n * n));
+
+    std::size_t errors = 0;
+    for (std::size_t p = 0; p != c.size(); ++p)
+    {
+        if (c[p] != p)
+            ++errors;
+    }
+    HPX_TEST_EQ(errors, std::size_t(0));
+    HPX_TEST_EQ(sum, std::size_t(3 * n * n * n * (n - 1) / 2));
+}
+
+template <typename ExPolicy>
+void test_for_loop_2d_async(ExPolicy policy)
+{
+    using namespace hpx::parallel;
+
+    std::ptrdiff_t const n = 512;
+    std::vector<double> a(n * n), b(n * n);
+    for (std::size_t p = 0; p != a.size(); ++p)
+        a[p] = double(p);
+
+    // transpose
+    hpx::future<void> f = for_loop(policy, index_box<2>({n, n}),
+        tiling<2>({32, 32}, tile_order::morton, true),
+        [&](std::ptrdiff_t i, std::ptrdiff_t j)
+        {
+            b[j * n + i] = a[i * n + j];
+        });
+    f.wait();
+    HPX_TEST(!f.has_exception());
+
+    std::size_t errors = 0;
+    for (std::ptrdiff_t i = 0; i != n; ++i)
+    {
+        for (std::ptrdiff_t j = 0; j != n; ++j)
+        {
+            if (b[j * n + i] != a[i * n + j])
+                ++errors;
+        }
+    }
+    HPX_TEST_EQ(errors, std::size_t(0));
+}
+
+void test_for_loop_1d_empty()
+{
+    using namespace hpx::parallel;
+
+    std::size_t count = 0;
+    for_loop(index_box<1>({100}),
+        [&](std::ptrdiff_t i)
+        {
+            count += std::size_t(i);
+        });
+    HPX_TEST_EQ(count, std::size_t(4950));
+
+    // an empty box doesn't invoke the function
+    for_loop(execution::par, index_box<2>({5, 5}, {5, 10}),
+        [](std::ptrdiff_t, std::ptrdiff_t)
+        {
+            HPX_TEST(false);
+        });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_for_loop_2d(execution::seq);
+    test_for_loop_2d(execution::par);
+    test_for_loop_2d(execution::par_unseq);
+
+    test_for_loop_3d_induction_reduction(execution::seq);
+    test_for_loop_3d_induction_reduction(execution::par);
+
+    test_for_loop_2d_async(execution::seq(execution::task));
+    test_for_loop_2d_async(execution::par(execution::task));
+
+    test_for_loop_1d_empty();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,256 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_HISTOGRAM_TEST_SIZE (1 << 16)
+#else
+#define HPX_HISTOGRAM_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::int64_t> make_random(std::size_t size, std::int64_t min,
+    std::int64_t max)
+{
+    std::uniform_int_distribution<std::int64_t> dist(min, max);
+
+    std::vector<std::int64_t> c(size);
+    for (std::int64_t& elem : c)
+        elem = dist(gen);
+    return c;
+}
+
+std::vector<std::size_t> expected_histogram(
+    std::vector<std::int64_t> const& c, std::size_t num_bins)
+{
+    std::vector<std::size_t> expected(num_bins, 0);
+    for (std::int64_t i : c)
+    {
+        if (i >= 0 && std::size_t(i) < num_bins)
+            ++expected[std::size_t(i)];
+    }
+    return expected;
+}
+
+template <typename ExPolicy>
+void test_histogram(ExPolicy policy, std::size_t size, std::size_t num_bins)
+{
+    // some of the elements are outside of [0, num_bins)
+    std::vector<std::int64_t> c = make_random(size, -10,
+        std::int64_t(num_bins) + 10);
+    std::vector<std::size_t> expected = expected_histogram(c, num_bins);
+
+    std::vector<std::size_t> bins(num_bins, 42);
+    auto result = hpx::parallel::histogram(policy, c.begin(), c.end(),
+        bins.begin(), num_bins);
+    HPX_TEST(result == bins.end());
+    HPX_TEST(bins == expected);
+}
+
+template <typename ExPolicy>
+void test_histogram_async(ExPolicy policy, std::size_t size,
+    std::size_t num_bins)
+{
+    std::vector<std::int64_t> c = make_random(size, 0,
+        std::int64_t(num_bins) - 1);
+    std::vector<std::size_t> expected = expected_histogram(c, num_bins);
+
+    std::vector<std::size_t> bins(num_bins);
+    auto f = hpx::parallel::histogram(policy, c.begin(), c.end(),
+        bins.begin(), num_bins);
+    HPX_TEST(f.get() == bins.end());
+    HPX_TEST(bins == expected);
+}
+
+template <typename ExPolicy>
+void test_histogram_projection(ExPolicy policy)
+{
+    std::vector<std::int64_t> c = make_random(HPX_HISTOGRAM_TEST_SIZE,
+        0, 1000000);
+
+    std::vector<std::size_t> expected(10, 0);
+    for (std::int64_t i : c)
+        ++expected[std::size_t(i % 10)];
+
+    std::vector<std::size_t> bins(10);
+    hpx::parallel::histogram(policy, c.begin(), c.end(), bins.begin(), 10,
+        [](std::int64_t i) { return i % 10; });
+    HPX_TEST(bins == expected);
+}
+
+template <typename ExPolicy>
+void test_histogram(ExPolicy policy)
+{
+    std::size_t const size = HPX_HISTOGRAM_TEST_SIZE;
+
+    // dense bins
+    test_histogram(policy, size, 1);
+    test_histogram(policy, size, 256);
+    test_histogram(policy, size, 100000);
+
+    // sparse bins
+    test_histogram(policy, size, 4 * size);
+
+    // small sequences
+    test_histogram(policy, 0, 16);
+    test_histogram(policy, 1000, 16);
+    test_histogram(policy, 1000, 0);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_aggregate_by_key(ExPolicy policy, std::size_t size,
+    std::int64_t max_key)
+{
+    std::vector<std::int64_t> keys = make_random(size, 0, max_key);
+    std::vector<std::int64_t> values = make_random(size, -1000, 1000);
+
+    std::map<std::int64_t, std::int64_t> expected;
+    for (std::size_t i = 0; i != size; ++i)
+        expected[keys[i]] += values[i];
+
+    std::vector<std::int64_t> keys_output(size);
+    std::vector<std::int64_t> values_output(size);
+    auto result = hpx::parallel::aggregate_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), keys_output.begin(),
+        values_output.begin());
+
+    // the order of the output elements is unspecified
+    HPX_TEST(result.first ==
+        std::next(keys_output.begin(), expected.size()));
+    HPX_TEST(result.second ==
+        std::next(values_output.begin(), expected.size()));
+
+    std::map<std::int64_t, std::int64_t> aggregated;
+    for (std::size_t i = 0; i != expected.size(); ++i)
+    {
+        HPX_TEST(aggregated.insert(
+            std::make_pair(keys_output[i], values_output[i])).second);
+    }
+    HPX_TEST(aggregated == expected);
+}
+
+template <typename ExPolicy>
+void test_aggregate_by_key_async(ExPolicy policy)
+{
+    std::size_t const size = HPX_HISTOGRAM_TEST_SIZE;
+
+    std::vector<std::string> keys(size);
+    std::vector<std::int64_t> values(size);
+    std::map<std::string, std::int64_t> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys[i] = std::to_string(gen() % 5000);
+        values[i] = gen() % 100;
+        expected[keys[i]] = (std::max)(expected[keys[i]], values[i]);
+    }
+
+    std::vector<std::string> keys_output(size);
+    std::vector<std::int64_t> values_output(size);
+    auto f = hpx::parallel::aggregate_by_key(policy, keys.begin(),
+        keys.end(), values.begin(), keys_output.begin(),
+        values_output.begin(),
+        [](std::int64_t lhs, std::int64_t rhs)
+        {
+            return (std::max)(lhs, rhs);
+        });
+
+    auto result = f.get();
+    std::size_t const count =
+        std::size_t(std::distance(keys_output.begin(), result.first));
+    HPX_TEST_EQ(count, expected.size());
+
+    std::map<std::string, std::int64_t> aggregated;
+    for (std::size_t i = 0; i != count; ++i)
+        aggregated[keys_output[i]] = values_output[i];
+    HPX_TEST(aggregated == expected);
+}
+
+template <typename ExPolicy>
+void test_aggregate_by_key(ExPolicy policy)
+{
+    std::size_t const size = HPX_HISTOGRAM_TEST_SIZE;
+
+    test_aggregate_by_key(policy, size, 0);
+    test_aggregate_by_key(policy, size, 100);
+    test_aggregate_by_key(policy, size, std::int64_t(size));
+    test_aggregate_by_key(policy, size, std::int64_t(1) << 40);
+    test_aggregate_by_key(policy, 0, 100);
+    test_aggregate_by_key(policy, 1000, 100);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_histogram(execution::seq);
+    test_histogram(execution::par);
+    test_histogram(execution::par_unseq);
+
+    test_histogram_async(execution::seq(execution::task),
+        HPX_HISTOGRAM_TEST_SIZE, 1000);
+    test_histogram_async(execution::par(execution::task),
+        HPX_HISTOGRAM_TEST_SIZE, 1000);
+
+    test_histogram_projection(execution::seq);
+    test_histogram_projection(execution::par);
+
+    test_aggregate_by_key(execution::seq);
+    test_aggregate_by_key(execution::par);
+    test_aggregate_by_key(execution::par_unseq);
+
+    test_aggregate_by_key_async(execution::seq(execution::task));
+    test_aggregate_by_key_async(execution::par(execution::task));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,183 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_PARTIAL_SORT_TEST_SIZE (1 << 16)
+#else
+#define HPX_PARTIAL_SORT_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Distribution>
+std::vector<T> make_random(std::size_t size, Distribution dist)
+{
+    std::vector<T> c(size);
+    for (T& elem : c)
+        elem = static_cast<T>(dist(gen));
+    return c;
+}
+
+std::vector<std::string> make_random_strings(std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 100000);
+
+    std::vector<std::string> c(size);
+    for (std::string& elem : c)
+        elem = std::to_string(dist(gen));
+    return c;
+}
+
+template <typename ExPolicy, typename T, typename Compare = std::less<T> >
+void test_partial_sort(ExPolicy policy, std::vector<T> c, std::size_t m,
+    Compare comp = Compare())
+{
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    auto result = hpx::parallel::partial_sort(policy, c.begin(),
+        c.begin() + m, c.end(), comp);
+    HPX_TEST(result == c.end());
+    HPX_TEST(std::equal(c.begin(), c.begin() + m, expected.begin()));
+
+    // the remaining elements are a permutation of the remaining input
+    std::sort(c.begin() + m, c.end(), comp);
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename T, typename Compare = std::less<T> >
+void test_partial_sort_copy(ExPolicy policy, std::vector<T> const& c,
+    std::size_t m, Compare comp = Compare())
+{
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end(), comp);
+
+    std::size_t const k = (std::min)(m, c.size());
+
+    std::vector<T> d(m);
+    auto result = hpx::parallel::partial_sort_copy(policy, c.begin(),
+        c.end(), d.begin(), d.end(), comp);
+    HPX_TEST(result == d.begin() + k);
+    HPX_TEST(std::equal(d.begin(), d.begin() + k, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_async(ExPolicy policy, std::vector<int> c)
+{
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const m = c.size() / 10;
+    auto f = hpx::parallel::partial_sort(policy, c.begin(), c.begin() + m,
+        c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(std::equal(c.begin(), c.begin() + m, expected.begin()));
+
+    std::vector<int> d(m);
+    auto g = hpx::parallel::partial_sort_copy(policy, c.begin(), c.end(),
+        d.begin(), d.end());
+    HPX_TEST(g.get() == d.end());
+    HPX_TEST(std::equal(d.begin(), d.end(), expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort(ExPolicy policy)
+{
+    std::size_t const size = HPX_PARTIAL_SORT_TEST_SIZE;
+
+    std::vector<int> c = make_random<int>(size,
+        std::uniform_int_distribution<int>());
+    for (std::size_t m : { std::size_t(0), std::size_t(100), size / 2, size })
+    {
+        test_partial_sort(policy, c, m);
+        test_partial_sort_copy(policy, c, m);
+    }
+    test_partial_sort_copy(policy, c, 2 * size);
+
+    test_partial_sort(policy, make_random<double>(size,
+        std::uniform_real_distribution<double>(-1.0, 1.0)), size / 3,
+        std::greater<double>());
+    test_partial_sort_copy(policy, make_random<double>(size,
+        std::uniform_real_distribution<double>(-1.0, 1.0)), size / 3,
+        std::greater<double>());
+
+    std::vector<std::string> s = make_random_strings(size / 16);
+    test_partial_sort(policy, s, size / 64);
+    test_partial_sort_copy(policy, s, size / 64);
+
+    // few distinct values, small and empty inputs
+    test_partial_sort(policy, make_random<int>(size,
+        std::uniform_int_distribution<int>(0, 3)), size / 2);
+    test_partial_sort_copy(policy, make_random<int>(size,
+        std::uniform_int_distribution<int>(0, 3)), size / 2);
+    test_partial_sort(policy, make_random<int>(100,
+        std::uniform_int_distribution<int>()), 50);
+    test_partial_sort_copy(policy, std::vector<int>(), 10);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_partial_sort(execution::seq);
+    test_partial_sort(execution::par);
+    test_partial_sort(execution::par_unseq);
+
+    test_partial_sort_async(execution::seq(execution::task),
+        make_random<int>(HPX_PARTIAL_SORT_TEST_SIZE,
+            std::uniform_int_distribution<int>()));
+    test_partial_sort_async(execution::par(execution::task),
+        make_random<int>(HPX_PARTIAL_SORT_TEST_SIZE,
+            std::uniform_int_distribution<int>()));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,209 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 16)
+#else
+#define HPX_RADIX_SORT_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Distribution>
+std::vector<T> make_random(std::size_t size, Distribution dist)
+{
+    std::vector<T> c(size);
+    for (T& elem : c)
+        elem = static_cast<T>(dist(gen));
+    return c;
+}
+
+template <typename ExPolicy, typename T>
+void test_radix_sort(ExPolicy policy, std::vector<T> c)
+{
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto result = hpx::parallel::radix_sort(policy, c.begin(), c.end());
+    HPX_TEST(result == c.end());
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_radix_sort_async(ExPolicy policy, std::vector<T> c)
+{
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    auto f = hpx::parallel::radix_sort(policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_sort_arithmetic(ExPolicy policy, std::vector<T> c)
+{
+    std::vector<T> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    // the default comparison selects the radix sort
+    hpx::parallel::sort(policy, c.begin(), c.end());
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_radix_sort(ExPolicy policy)
+{
+    std::size_t const size = HPX_RADIX_SORT_TEST_SIZE;
+
+    test_radix_sort(policy, make_random<std::uint64_t>(size,
+        std::uniform_int_distribution<std::uint64_t>()));
+    test_radix_sort(policy, make_random<std::int64_t>(size,
+        std::uniform_int_distribution<std::int64_t>(-1000000, 1000000)));
+    test_radix_sort(policy, make_random<std::int32_t>(size,
+        std::uniform_int_distribution<std::int32_t>()));
+    test_radix_sort(policy, make_random<std::int8_t>(size,
+        std::uniform_int_distribution<int>(-128, 127)));
+    test_radix_sort(policy, make_random<double>(size,
+        std::uniform_real_distribution<double>(-1.0e6, 1.0e6)));
+    test_radix_sort(policy, make_random<float>(size,
+        std::uniform_real_distribution<float>(-1.0f, 1.0f)));
+
+    // few distinct keys, all keys equal, already sorted and small inputs
+    test_radix_sort(policy, make_random<std::uint64_t>(size,
+        std::uniform_int_distribution<std::uint64_t>(0, 3)));
+    test_radix_sort(policy, std::vector<std::uint32_t>(size, 42));
+
+    std::vector<int> sorted = make_random<int>(size,
+        std::uniform_int_distribution<int>());
+    std::sort(sorted.begin(), sorted.end());
+    test_radix_sort(policy, sorted);
+
+    test_radix_sort(policy, std::vector<int>());
+    test_radix_sort(policy, make_random<int>(100,
+        std::uniform_int_distribution<int>()));
+
+    test_sort_arithmetic(policy, make_random<std::int64_t>(size,
+        std::uniform_int_distribution<std::int64_t>()));
+    test_sort_arithmetic(policy, make_random<double>(size,
+        std::uniform_real_distribution<double>(-1.0, 1.0)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+struct record
+{
+    std::uint64_t key;
+    std::string payload;
+};
+
+template <typename ExPolicy>
+void test_radix_sort_projection(ExPolicy policy)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, 1000);
+
+    std::vector<record> c(HPX_RADIX_SORT_TEST_SIZE / 4);
+    for (record& r : c)
+    {
+        r.key = dist(gen);
+        r.payload = std::to_string(r.key);
+    }
+
+    hpx::parallel::radix_sort(policy, c.begin(), c.end(),
+        [](record const& r) { return r.key; });
+
+    for (std::size_t i = 0; i != c.size(); ++i)
+    {
+        HPX_TEST_EQ(c[i].payload, std::to_string(c[i].key));
+        if (i != 0)
+            HPX_TEST_LTE(c[i - 1].key, c[i].key);
+    }
+}
+
+void test_sort_by_key()
+{
+    using namespace hpx::parallel;
+
+    std::vector<std::uint64_t> keys = make_random<std::uint64_t>(
+        HPX_RADIX_SORT_TEST_SIZE,
+        std::uniform_int_distribution<std::uint64_t>());
+
+    // the values are the keys, they have to follow the keys
+    std::vector<std::uint64_t> values = keys;
+
+    sort_by_key(execution::par, keys.begin(), keys.end(), values.begin());
+
+    HPX_TEST(std::is_sorted(keys.begin(), keys.end()));
+    HPX_TEST(keys == values);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_radix_sort(execution::seq);
+    test_radix_sort(execution::par);
+    test_radix_sort(execution::par_unseq);
+
+    test_radix_sort_async(execution::seq(execution::task),
+        make_random<std::int64_t>(HPX_RADIX_SORT_TEST_SIZE,
+            std::uniform_int_distribution<std::int64_t>()));
+    test_radix_sort_async(execution::par(execution::task),
+        make_random<std::int64_t>(HPX_RADIX_SORT_TEST_SIZE,
+            std::uniform_int_distribution<std::int64_t>()));
+
+    test_radix_sort_projection(execution::seq);
+    test_radix_sort_projection(execution::par);
+
+    test_sort_by_key();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,298 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// The scan based algorithms use the single-pass scan partitioner for large
+// random access sequences, these tests use sequences above that limit.
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_scan.hpp>
+#include <hpx/include/parallel_transform_scan.hpp>
+#include <hpx/parallel/util/scan_partitioner.hpp>
+#include <hpx/util/lightweight_test.hpp>
+#include <hpx/util/unwrap.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+std::size_t const test_size = hpx::parallel::util::detail::
+    scan_single_pass_limit + 12345;
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::uint64_t> make_random(std::size_t size)
+{
+    std::uniform_int_distribution<std::uint64_t> dist(0, 1000);
+
+    std::vector<std::uint64_t> c(size);
+    for (std::uint64_t& elem : c)
+        elem = dist(gen);
+    return c;
+}
+
+template <typename ExPolicy>
+void test_scans(ExPolicy policy)
+{
+    using namespace hpx::parallel;
+
+    std::vector<std::uint64_t> c = make_random(test_size);
+    std::vector<std::uint64_t> d(c.size());
+    std::vector<std::uint64_t> e(c.size());
+
+    // inclusive_scan
+    inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+        std::plus<std::uint64_t>(), std::uint64_t(42));
+    v1::detail::sequential_inclusive_scan(c.begin(), c.end(), e.begin(),
+        std::uint64_t(42), std::plus<std::uint64_t>());
+    HPX_TEST(d == e);
+
+    // exclusive_scan
+    exclusive_scan(policy, c.begin(), c.end(), d.begin(), std::uint64_t(42),
+        std::plus<std::uint64_t>());
+    e[0] = 42;
+    std::partial_sum(c.begin(), c.end() - 1, e.begin() + 1);
+    std::for_each(e.begin() + 1, e.end(), [](std::uint64_t& v) { v += 42; });
+    HPX_TEST(d == e);
+
+    // transform_inclusive_scan
+    auto twice = [](std::uint64_t v) { return 2 * v; };
+    transform_inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+        std::plus<std::uint64_t>(), twice);
+    std::transform(c.begin(), c.end(), e.begin(), twice);
+    std::partial_sum(e.begin(), e.end(), e.begin());
+    HPX_TEST(d == e);
+
+    // in place inclusive_scan
+    std::vector<std::uint64_t> f = c;
+    inclusive_scan(policy, f.begin(), f.end(), f.begin());
+    std::partial_sum(c.begin(), c.end(), e.begin());
+    HPX_TEST(f == e);
+
+    // copy_if
+    auto is_odd = [](std::uint64_t v) { return (v & 1) != 0; };
+    std::fill(d.begin(), d.end(), 0);
+    auto result = copy_if(policy, c.begin(), c.end(), d.begin(), is_odd);
+    auto expected = std::copy_if(c.begin(), c.end(), e.begin(), is_odd);
+    HPX_TEST(result.second - d.begin() == expected - e.begin());
+    HPX_TEST(std::equal(d.begin(), result.second, e.begin()));
+}
+
+template <typename ExPolicy>
+void test_scans_async(ExPolicy policy)
+{
+    using namespace hpx::parallel;
+
+    std::vector<std::uint64_t> c = make_random(test_size);
+    std::vector<std::uint64_t> d(c.size());
+    std::vector<std::uint64_t> e(c.size());
+
+    auto f = inclusive_scan(policy, c.begin(), c.end(), d.begin());
+    HPX_TEST(f.get() == d.end());
+
+    std::partial_sum(c.begin(), c.end(), e.begin());
+    HPX_TEST(d == e);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the composition of affine functions is associative, but not commutative
+struct affine
+{
+    std::uint64_t a;
+    std::uint64_t b;
+};
+
+inline bool operator==(affine const& lhs, affine const& rhs)
+{
+    return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+struct compose
+{
+    affine operator()(affine const& f, affine const& g) const
+    {
+        return affine{ g.a * f.a, g.a * f.b + g.b };
+    }
+};
+
+template <typename ExPolicy>
+void test_scan_non_commutative(ExPolicy policy)
+{
+    std::vector<std::uint64_t> keys = make_random(test_size);
+
+    std::vector<affine> c(keys.size());
+    for (std::size_t i = 0; i != c.size(); ++i)
+        c[i] = affine{ keys[i] | 1, keys[i] };
+
+    std::vector<affine> d(c.size());
+    std::vector<affine> e(c.size());
+
+    hpx::parallel::inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+        compose(), affine{ 1, 0 });
+    hpx::parallel::v1::detail::sequential_inclusive_scan(c.begin(), c.end(),
+        e.begin(), affine{ 1, 0 }, compose());
+    HPX_TEST(d == e);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_scan_exception(ExPolicy policy)
+{
+    // the operation throws once it sees the marked element
+    std::uint64_t const marker = std::uint64_t(1) << 40;
+
+    std::vector<std::uint64_t> c(test_size, 1);
+    c[test_size / 2] = marker;
+    std::vector<std::uint64_t> d(c.size());
+
+    bool caught_exception = false;
+    try {
+        hpx::parallel::inclusive_scan(policy, c.begin(), c.end(), d.begin(),
+            [marker](std::uint64_t v1, std::uint64_t v2) -> std::uint64_t
+            {
+                if (v2 == marker)
+                    throw std::runtime_error("test");
+                return v1 + v2;
+            },
+            std::uint64_t(0));
+
+        HPX_TEST(false);
+    }
+    catch (hpx::exception_list const& e) {
+        caught_exception = true;
+        HPX_TEST(e.size() != 0);
+    }
+    catch (...) {
+        HPX_TEST(false);
+    }
+
+    HPX_TEST(caught_exception);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// the single-pass scan can be selected explicitly for any sequence, it uses
+// the chunk size given by the executor parameters
+template <typename ExPolicy>
+void test_scan_partitioner_single_pass(ExPolicy policy,
+    std::size_t chunk_size)
+{
+    using namespace hpx::parallel;
+
+    std::vector<std::uint64_t> c = make_random(10007);
+    std::vector<std::uint64_t> d(c.size());
+    std::vector<std::uint64_t> e(c.size());
+
+    typedef std::vector<std::uint64_t>::iterator iterator;
+    typedef util::scan_partitioner<
+            ExPolicy, std::uint64_t, std::uint64_t, void,
+            util::scan_partitioner_single_pass_tag
+        > scan_partitioner_type;
+
+    std::atomic<std::size_t> wrong_sizes(0);
+    std::uint64_t total = scan_partitioner_type::call(policy,
+        c.begin(), c.size(), std::uint64_t(0),
+        // step 1 scans the chunk
+        [&](iterator part_begin, std::size_t part_size) -> std::uint64_t
+        {
+            std::size_t const offset = std::size_t(part_begin - c.begin());
+            if (chunk_size != 0 && offset % chunk_size != 0)
+                ++wrong_sizes;
+            if (chunk_size != 0 &&
+                part_size != (std::min)(chunk_size, c.size() - offset))
+            {
+                ++wrong_sizes;
+            }
+
+            iterator dest = d.begin() + (part_begin - c.begin());
+            std::partial_sum(part_begin, part_begin + part_size, dest);
+            return *(dest + part_size - 1);
+        },
+        // step 2 combines the results of the chunks
+        hpx::util::unwrapping(std::plus<std::uint64_t>()),
+        // step 3 adds the results of the preceding chunks
+        [&](iterator part_begin, std::size_t part_size,
+            hpx::shared_future<std::uint64_t> curr,
+            hpx::shared_future<std::uint64_t> next)
+        {
+            next.get();
+            std::uint64_t const val = curr.get();
+
+            iterator dest = d.begin() + (part_begin - c.begin());
+            std::for_each(dest, dest + part_size,
+                [val](std::uint64_t& v) { v += val; });
+        },
+        // step 4 returns the overall result
+        [](std::vector<hpx::shared_future<std::uint64_t> >&& items,
+            std::vector<hpx::future<void> >&&) -> std::uint64_t
+        {
+            return items.back().get();
+        });
+
+    std::partial_sum(c.begin(), c.end(), e.begin());
+    HPX_TEST(d == e);
+    HPX_TEST_EQ(total, e.back());
+    HPX_TEST_EQ(wrong_sizes.load(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_scans(execution::par);
+    test_scans(execution::par_unseq);
+
+    test_scans_async(execution::par(execution::task));
+
+    test_scan_non_commutative(execution::par);
+    test_scan_exception(execution::par);
+
+    test_scan_partitioner_single_pass(execution::par, 0);
+    test_scan_partitioner_single_pass(
+        execution::par.with(execution::static_chunk_size(1000)), 1000);
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
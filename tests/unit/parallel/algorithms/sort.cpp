@@ -152,6 +152,16 @@ void test_sort2()
         std::greater<float>());
 }
 
+void test_sort3()
+{
+    using namespace hpx::parallel;
+    test_sort3(execution::seq,     int());
+    test_sort3(execution::par,     int());
+    test_sort3(execution::par_unseq, int());
+
+    test_sort3(execution::par,     double());
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 int hpx_main(boost::program_options::variables_map& vm)
 {
@@ -164,6 +174,7 @@ int hpx_main(boost::program_options::variables_map& vm)
 
     test_sort1();
     test_sort2();
+    test_sort3();
     sort_benchmark();
 
     return hpx::finalize();
@@ -596,6 +596,35 @@ void test_sort2_async(ExPolicy && policy, T, Compare comp = Compare())
     HPX_TEST(is_sorted);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+// few distinct values, most of them equal to the smallest one
+template <typename ExPolicy, typename T>
+void test_sort3(ExPolicy && policy, T)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+    msg(typeid(ExPolicy).name(), typeid(T).name(), "default", sync, skewed);
+
+    std::mt19937 eng(static_cast<unsigned int>(std::rand()));
+    std::uniform_int_distribution<int> distr(0, 99);
+
+    std::vector<T> c(HPX_SORT_TEST_SIZE);
+    for (auto& elem : c)
+    {
+        int const value = distr(eng);
+        elem = static_cast<T>(value < 90 ? 0 : value % 4);
+    }
+
+    std::uint64_t t = hpx::util::high_resolution_clock::now();
+    hpx::parallel::sort(std::forward<ExPolicy>(policy),
+            c.begin(), c.end());
+    std::uint64_t elapsed = hpx::util::high_resolution_clock::now() - t;
+
+    bool is_sorted = (verify_(c, std::less<T>(), elapsed, true) != 0);
+    HPX_TEST(is_sorted);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // overload of test routine 1 for strings
 // call sort on a string array with no comparison operator
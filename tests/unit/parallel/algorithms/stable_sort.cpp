@@ -0,0 +1,172 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_STABLE_SORT_TEST_SIZE (1 << 16)
+#else
+#define HPX_STABLE_SORT_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename Distribution>
+std::vector<T> make_random(std::size_t size, Distribution dist)
+{
+    std::vector<T> c(size);
+    for (T& elem : c)
+        elem = static_cast<T>(dist(gen));
+    return c;
+}
+
+std::vector<std::string> make_random_strings(std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 100000);
+
+    std::vector<std::string> c(size);
+    for (std::string& elem : c)
+        elem = std::to_string(dist(gen));
+    return c;
+}
+
+template <typename ExPolicy, typename T>
+void test_stable_sort(ExPolicy policy, std::vector<T> c)
+{
+    std::vector<T> expected = c;
+    std::stable_sort(expected.begin(), expected.end());
+
+    auto result = hpx::parallel::stable_sort(policy, c.begin(), c.end());
+    HPX_TEST(result == c.end());
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy, typename T>
+void test_stable_sort_async(ExPolicy policy, std::vector<T> c)
+{
+    std::vector<T> expected = c;
+    std::stable_sort(expected.begin(), expected.end());
+
+    auto f = hpx::parallel::stable_sort(policy, c.begin(), c.end());
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(c == expected);
+}
+
+// the keys have few distinct values, the original positions of the
+// elements have to be preserved for equal keys
+template <typename ExPolicy>
+void test_stable_sort_stability(ExPolicy policy, std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 100);
+
+    std::vector<std::pair<int, std::size_t> > c(size);
+    for (std::size_t i = 0; i != size; ++i)
+        c[i] = std::make_pair(dist(gen), i);
+
+    std::vector<std::pair<int, std::size_t> > expected = c;
+    std::stable_sort(expected.begin(), expected.end(),
+        [](std::pair<int, std::size_t> const& lhs,
+            std::pair<int, std::size_t> const& rhs)
+        {
+            return lhs.first > rhs.first;
+        });
+
+    hpx::parallel::stable_sort(policy, c.begin(), c.end(),
+        std::greater<int>(),
+        [](std::pair<int, std::size_t> const& p) { return p.first; });
+
+    HPX_TEST(c == expected);
+}
+
+template <typename ExPolicy>
+void test_stable_sort(ExPolicy policy)
+{
+    std::size_t const size = HPX_STABLE_SORT_TEST_SIZE;
+
+    test_stable_sort(policy, make_random<int>(size,
+        std::uniform_int_distribution<int>()));
+    test_stable_sort(policy, make_random<double>(size,
+        std::uniform_real_distribution<double>(-1.0, 1.0)));
+    test_stable_sort(policy, make_random_strings(size / 16));
+
+    // sorted, reversed, small and empty inputs
+    std::vector<int> sorted = make_random<int>(size,
+        std::uniform_int_distribution<int>());
+    std::sort(sorted.begin(), sorted.end());
+    test_stable_sort(policy, sorted);
+
+    std::reverse(sorted.begin(), sorted.end());
+    test_stable_sort(policy, sorted);
+
+    test_stable_sort(policy, make_random<int>(100,
+        std::uniform_int_distribution<int>()));
+    test_stable_sort(policy, std::vector<int>());
+
+    test_stable_sort_stability(policy, size);
+    test_stable_sort_stability(policy, 1000);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_stable_sort(execution::seq);
+    test_stable_sort(execution::par);
+    test_stable_sort(execution::par_unseq);
+
+    test_stable_sort_async(execution::seq(execution::task),
+        make_random<int>(HPX_STABLE_SORT_TEST_SIZE,
+            std::uniform_int_distribution<int>()));
+    test_stable_sort_async(execution::par(execution::task),
+        make_random<int>(HPX_STABLE_SORT_TEST_SIZE,
+            std::uniform_int_distribution<int>()));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,109 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_NTH_ELEMENT_TEST_SIZE (1 << 16)
+#else
+#define HPX_NTH_ELEMENT_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_random(std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 10000);
+
+    std::vector<int> c(size);
+    for (int& elem : c)
+        elem = dist(gen);
+    return c;
+}
+
+template <typename ExPolicy>
+void test_nth_element_range(ExPolicy policy)
+{
+    std::vector<int> c = make_random(HPX_NTH_ELEMENT_TEST_SIZE);
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    std::size_t const n = c.size() / 3;
+    auto result = hpx::parallel::nth_element(policy, c, c.begin() + n,
+        std::greater<int>());
+    HPX_TEST(result == c.end());
+    HPX_TEST_EQ(c[n], expected[n]);
+}
+
+template <typename ExPolicy>
+void test_nth_element_range_async(ExPolicy policy)
+{
+    std::vector<int> c = make_random(HPX_NTH_ELEMENT_TEST_SIZE);
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const n = c.size() / 2;
+    auto f = hpx::parallel::nth_element(policy, c, c.begin() + n);
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST_EQ(c[n], expected[n]);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_nth_element_range(execution::seq);
+    test_nth_element_range(execution::par);
+    test_nth_element_range(execution::par_unseq);
+
+    test_nth_element_range_async(execution::seq(execution::task));
+    test_nth_element_range_async(execution::par(execution::task));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,122 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(HPX_DEBUG)
+#define HPX_PARTIAL_SORT_TEST_SIZE (1 << 16)
+#else
+#define HPX_PARTIAL_SORT_TEST_SIZE (1 << 20)
+#endif
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<int> make_random(std::size_t size)
+{
+    std::uniform_int_distribution<int> dist(0, 10000);
+
+    std::vector<int> c(size);
+    for (int& elem : c)
+        elem = dist(gen);
+    return c;
+}
+
+template <typename ExPolicy>
+void test_partial_sort_range(ExPolicy policy)
+{
+    std::vector<int> c = make_random(HPX_PARTIAL_SORT_TEST_SIZE);
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end(), std::greater<int>());
+
+    std::size_t const m = c.size() / 10;
+
+    std::vector<int> d(m);
+    auto dest = hpx::parallel::partial_sort_copy(policy, c, d,
+        std::greater<int>());
+    HPX_TEST(dest == d.end());
+    HPX_TEST(std::equal(d.begin(), d.end(), expected.begin()));
+
+    auto result = hpx::parallel::partial_sort(policy, c, c.begin() + m,
+        std::greater<int>());
+    HPX_TEST(result == c.end());
+    HPX_TEST(std::equal(c.begin(), c.begin() + m, expected.begin()));
+}
+
+template <typename ExPolicy>
+void test_partial_sort_range_async(ExPolicy policy)
+{
+    std::vector<int> c = make_random(HPX_PARTIAL_SORT_TEST_SIZE);
+    std::vector<int> expected = c;
+    std::sort(expected.begin(), expected.end());
+
+    std::size_t const m = c.size() / 10;
+
+    std::vector<int> d(m);
+    auto g = hpx::parallel::partial_sort_copy(policy, c, d);
+    HPX_TEST(g.get() == d.end());
+    HPX_TEST(std::equal(d.begin(), d.end(), expected.begin()));
+
+    auto f = hpx::parallel::partial_sort(policy, c, c.begin() + m);
+    HPX_TEST(f.get() == c.end());
+    HPX_TEST(std::equal(c.begin(), c.begin() + m, expected.begin()));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    gen.seed(seed);
+
+    using namespace hpx::parallel;
+
+    test_partial_sort_range(execution::seq);
+    test_partial_sort_range(execution::par);
+    test_partial_sort_range(execution::par_unseq);
+
+    test_partial_sort_range_async(execution::seq(execution::task));
+    test_partial_sort_range_async(execution::par(execution::task));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,251 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/parallel_count.hpp>
+#include <hpx/include/parallel_for_each.hpp>
+#include <hpx/include/parallel_for_loop.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+#include <hpx/include/parallel_remove_copy.hpp>
+#include <hpx/include/parallel_view.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    bool operator()(int i) const
+    {
+        return (i & 1) != 0;
+    }
+};
+
+template <typename ExPolicy>
+void test_filtered_algorithms(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    using namespace hpx::parallel;
+
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c),
+        []() { return std::rand() % 1000; });
+
+    std::vector<int> ref;
+    std::copy_if(std::begin(c), std::end(c), std::back_inserter(ref),
+        is_odd());
+
+    auto odd = view::filter(c, is_odd());
+
+    std::atomic<long> sum(0);
+    auto it = for_each(policy, odd, [&](int i) { sum += i; });
+    HPX_TEST(it == odd.end());
+    HPX_TEST_EQ(sum.load(),
+        std::accumulate(std::begin(ref), std::end(ref), 0L));
+
+    HPX_TEST_EQ(count_if(policy, odd, [](int i) { return i > 500; }),
+        std::count_if(std::begin(ref), std::end(ref),
+            [](int i) { return i > 500; }));
+    HPX_TEST_EQ(count(policy, odd, 501),
+        std::count(std::begin(ref), std::end(ref), 501));
+
+    std::vector<int> d(c.size());
+    auto r1 = copy(policy, odd, std::begin(d));
+    HPX_TEST(r1.in() == odd.end());
+    HPX_TEST(std::equal(std::begin(ref), std::end(ref), std::begin(d)));
+    HPX_TEST(r1.out() == std::next(std::begin(d), ref.size()));
+
+    auto small = [](int i) { return i < 500; };
+    auto r2 = copy_if(policy, odd, std::begin(d), small);
+    auto e1 = std::remove_if(std::begin(ref), std::end(ref),
+        [](int i) { return !(i < 500); });
+    HPX_TEST(std::equal(std::begin(ref), e1, std::begin(d)));
+    HPX_TEST(r2.out() == std::next(std::begin(d), e1 - std::begin(ref)));
+
+    ref.clear();
+    std::copy_if(std::begin(c), std::end(c), std::back_inserter(ref),
+        is_odd());
+
+    auto r3 = remove_copy_if(policy, odd, std::begin(d), small);
+    auto e2 = std::remove_if(std::begin(ref), std::end(ref), small);
+    HPX_TEST(std::equal(std::begin(ref), e2, std::begin(d)));
+    HPX_TEST(r3.out() == std::next(std::begin(d), e2 - std::begin(ref)));
+}
+
+template <typename ExPolicy>
+void test_fused_pipeline(ExPolicy policy)
+{
+    using namespace hpx::parallel;
+
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c),
+        []() { return std::rand() % 1000; });
+
+    long ref = 0;
+    for (int i : c)
+    {
+        if ((i * 3) % 2 != 0)
+            ref += i * 3;
+    }
+
+    // filter applied after transform is executed as a single loop over c
+    auto pipeline = view::filter(
+        view::transform(c, [](int i) { return i * 3; }), is_odd());
+
+    HPX_TEST_EQ(reduce(policy, pipeline, 0L, std::plus<long>()), ref);
+    HPX_TEST_EQ(reduce(policy, pipeline, 0L), ref);
+
+    HPX_TEST_EQ(reduce(policy, view::iota(0, 1000)), 499500);
+    HPX_TEST_EQ(reduce(policy, view::transform(view::iota(0, 1000),
+        [](int i) { return 2 * i; }), 0L), 999000L);
+}
+
+template <typename ExPolicy>
+void test_zip_enumerate(ExPolicy policy)
+{
+    using namespace hpx::parallel;
+
+    std::vector<int> c(10007);
+    std::vector<int> d(c.size() / 2);
+    std::generate(std::begin(c), std::end(c),
+        []() { return std::rand() % 1000; });
+
+    // the zipped range is as long as the shortest range
+    for_each(policy, view::zip(c, d),
+        [](hpx::util::tuple<int&, int&> t)
+        {
+            hpx::util::get<1>(t) = hpx::util::get<0>(t) + 1;
+        });
+    for (std::size_t i = 0; i != d.size(); ++i)
+        HPX_TEST_EQ(d[i], c[i] + 1);
+
+    for_each(policy, view::enumerate(c),
+        [](hpx::util::tuple<std::size_t, int&> t)
+        {
+            hpx::util::get<1>(t) = static_cast<int>(hpx::util::get<0>(t));
+        });
+    for (std::size_t i = 0; i != c.size(); ++i)
+        HPX_TEST_EQ(c[i], static_cast<int>(i));
+
+    auto rng = view::transform(view::iota(0, 10007),
+        [](int i) { return 2 * i; });
+    for_loop(policy, hpx::util::begin(rng), hpx::util::end(rng),
+        [&](decltype(hpx::util::begin(rng)) it)
+        {
+            c[*it / 2] = *it;
+        });
+    for (std::size_t i = 0; i != c.size(); ++i)
+        HPX_TEST_EQ(c[i], static_cast<int>(2 * i));
+}
+
+template <typename ExPolicy>
+void test_views_async(ExPolicy p)
+{
+    using namespace hpx::parallel;
+
+    std::vector<int> c(10007);
+    std::generate(std::begin(c), std::end(c),
+        []() { return std::rand() % 1000; });
+
+    auto odd = view::filter(c, is_odd());
+
+    hpx::future<long> f1 = reduce(p, odd, 0L, std::plus<long>());
+    auto f2 = count_if(p, odd, [](int i) { return i > 500; });
+
+    std::vector<int> d(c.size());
+    auto f3 = copy(p, odd, std::begin(d));
+
+    long ref = 0;
+    std::ptrdiff_t count_ref = 0, odd_ref = 0;
+    for (int i : c)
+    {
+        if (is_odd()(i))
+        {
+            ref += i;
+            ++odd_ref;
+            if (i > 500)
+                ++count_ref;
+        }
+    }
+
+    HPX_TEST_EQ(f1.get(), ref);
+    HPX_TEST_EQ(f2.get(), count_ref);
+
+    auto r = f3.get();
+    HPX_TEST(r.in() == odd.end());
+    HPX_TEST(r.out() == std::next(std::begin(d), odd_ref));
+}
+
+void view_test()
+{
+    using namespace hpx::parallel;
+
+    test_filtered_algorithms(execution::seq);
+    test_filtered_algorithms(execution::par);
+    test_filtered_algorithms(execution::par_unseq);
+
+    test_fused_pipeline(execution::seq);
+    test_fused_pipeline(execution::par);
+    test_fused_pipeline(execution::par_unseq);
+
+    test_zip_enumerate(execution::seq);
+    test_zip_enumerate(execution::par);
+    test_zip_enumerate(execution::par_unseq);
+
+    test_views_async(execution::seq(execution::task));
+    test_views_async(execution::par(execution::task));
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    view_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
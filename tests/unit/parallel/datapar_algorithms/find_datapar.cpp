@@ -0,0 +1,239 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_adjacent_find.hpp>
+#include <hpx/include/parallel_equal.hpp>
+#include <hpx/include/parallel_find.hpp>
+#include <hpx/include/parallel_mismatch.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <ctime>
+#include <iostream>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The predicates are generic, they are invoked with vector packs by the
+// vectorized search loops.
+struct is_negative
+{
+    template <typename T>
+    auto operator()(T const& t) const -> decltype(t < T(0))
+    {
+        return t < T(0);
+    }
+};
+
+struct is_not_negative
+{
+    template <typename T>
+    auto operator()(T const& t) const -> decltype(t >= T(0))
+    {
+        return t >= T(0);
+    }
+};
+
+// this predicate can't be invoked with vector packs, the algorithms fall
+// back to scalar loops
+struct is_negative_scalar
+{
+    bool operator()(int t) const
+    {
+        return t < 0;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// The searched sequences start at all offsets up to the vector size to cover
+// the unaligned prologue, the vectorized loop and the epilogue.
+template <typename ExPolicy>
+void test_find(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t offset = 0; offset != 17; ++offset)
+    {
+        std::vector<int> c(10007 + offset);
+        std::iota(std::begin(c), std::end(c), std::rand() % 100);
+
+        auto first = std::begin(c) + offset;
+        for (std::size_t pos : {std::size_t(0), std::size_t(5),
+                 std::size_t(5003), std::size_t(10006)})
+        {
+            int old_value = first[pos];
+            first[pos] = -1;
+
+            auto result = hpx::parallel::find(
+                policy, first, std::end(c), -1);
+            HPX_TEST(result == first + pos);
+
+            result = hpx::parallel::find_if(
+                policy, first, std::end(c), is_negative());
+            HPX_TEST(result == first + pos);
+
+            result = hpx::parallel::find_if(
+                policy, first, std::end(c), is_negative_scalar());
+            HPX_TEST(result == first + pos);
+
+            result = hpx::parallel::find_if_not(
+                policy, first, std::end(c), is_not_negative());
+            HPX_TEST(result == first + pos);
+
+            first[pos] = old_value;
+        }
+
+        auto result = hpx::parallel::find(policy, first, std::end(c), -1);
+        HPX_TEST(result == std::end(c));
+    }
+}
+
+template <typename ExPolicy>
+void test_adjacent_find(ExPolicy policy)
+{
+    for (std::size_t offset = 0; offset != 17; ++offset)
+    {
+        std::vector<int> c(10007 + offset);
+        std::iota(std::begin(c), std::end(c), std::rand() % 100);
+
+        auto first = std::begin(c) + offset;
+        for (std::size_t pos : {std::size_t(0), std::size_t(7),
+                 std::size_t(5003), std::size_t(10005)})
+        {
+            int old_value = first[pos + 1];
+            first[pos + 1] = first[pos];
+
+            auto result = hpx::parallel::adjacent_find(
+                policy, first, std::end(c));
+            HPX_TEST(result == first + pos);
+
+            first[pos + 1] = old_value;
+        }
+
+        auto result = hpx::parallel::adjacent_find(
+            policy, first, std::end(c));
+        HPX_TEST(result == std::end(c));
+    }
+}
+
+template <typename ExPolicy>
+void test_mismatch(ExPolicy policy)
+{
+    for (std::size_t offset = 0; offset != 17; ++offset)
+    {
+        std::vector<int> c1(10007 + offset);
+        std::iota(std::begin(c1), std::end(c1), std::rand() % 100);
+        std::vector<int> c2(c1);
+
+        auto first1 = std::begin(c1) + offset;
+        auto first2 = std::begin(c2) + offset;
+
+        HPX_TEST(hpx::parallel::equal(
+            policy, first1, std::end(c1), first2));
+
+        auto result = hpx::parallel::mismatch(
+            policy, first1, std::end(c1), first2);
+        HPX_TEST(result.first == std::end(c1));
+        HPX_TEST(result.second == std::end(c2));
+
+        for (std::size_t pos : {std::size_t(0), std::size_t(9),
+                 std::size_t(5003), std::size_t(10006)})
+        {
+            ++first2[pos];
+
+            HPX_TEST(!hpx::parallel::equal(
+                policy, first1, std::end(c1), first2));
+            HPX_TEST(!hpx::parallel::equal(
+                policy, first1, std::end(c1), first2, std::end(c2)));
+
+            result = hpx::parallel::mismatch(
+                policy, first1, std::end(c1), first2);
+            HPX_TEST(result.first == first1 + pos);
+            HPX_TEST(result.second == first2 + pos);
+
+            --first2[pos];
+        }
+    }
+}
+
+template <typename ExPolicy>
+void test_find_async(ExPolicy p)
+{
+    std::vector<int> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand() % 100);
+    c[c.size() / 2] = -1;
+
+    hpx::future<std::vector<int>::iterator> f =
+        hpx::parallel::find_if(p, std::begin(c), std::end(c), is_negative());
+    f.wait();
+
+    HPX_TEST(f.get() == std::begin(c) + c.size() / 2);
+
+    hpx::future<bool> e = hpx::parallel::equal(
+        p, std::begin(c), std::end(c), std::begin(c));
+    HPX_TEST(e.get());
+}
+
+void find_test()
+{
+    using namespace hpx::parallel;
+
+    test_find(execution::dataseq);
+    test_find(execution::datapar);
+
+    test_adjacent_find(execution::dataseq);
+    test_adjacent_find(execution::datapar);
+
+    test_mismatch(execution::dataseq);
+    test_mismatch(execution::datapar);
+
+    test_find_async(execution::dataseq(execution::task));
+    test_find_async(execution::datapar(execution::task));
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    find_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,127 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_minmax.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The tests use few distinct values to make sure that the first smallest and
+// largest (and for minmax_element the last largest) elements are found.
+template <typename ExPolicy>
+void test_minmax_element(ExPolicy policy, int range)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t offset = 0; offset != 17; ++offset)
+    {
+        std::vector<float> c(10007 + offset);
+        std::generate(std::begin(c), std::end(c),
+            [range]() { return float(std::rand() % range); });
+
+        auto first = std::begin(c) + offset;
+
+        auto r1 = hpx::parallel::min_element(policy, first, std::end(c));
+        HPX_TEST(r1 == std::min_element(first, std::end(c)));
+
+        auto r2 = hpx::parallel::max_element(policy, first, std::end(c));
+        HPX_TEST(r2 == std::max_element(first, std::end(c)));
+
+        auto r3 = hpx::parallel::minmax_element(policy, first, std::end(c));
+        auto ref = std::minmax_element(first, std::end(c));
+        HPX_TEST(r3.first == ref.first);
+        HPX_TEST(r3.second == ref.second);
+
+        // descending values move the current minimum for each element
+        std::sort(first, std::end(c), std::greater<float>());
+
+        r1 = hpx::parallel::min_element(policy, first, std::end(c));
+        HPX_TEST(r1 == std::min_element(first, std::end(c)));
+
+        r3 = hpx::parallel::minmax_element(policy, first, std::end(c));
+        ref = std::minmax_element(first, std::end(c));
+        HPX_TEST(r3.first == ref.first);
+        HPX_TEST(r3.second == ref.second);
+    }
+}
+
+template <typename ExPolicy>
+void test_minmax_element_async(ExPolicy p)
+{
+    std::vector<float> c(10007);
+    std::generate(std::begin(c), std::end(c),
+        []() { return float(std::rand() % 1000); });
+
+    auto f = hpx::parallel::minmax_element(p, std::begin(c), std::end(c));
+    auto ref = std::minmax_element(std::begin(c), std::end(c));
+
+    auto r = f.get();
+    HPX_TEST(r.first == ref.first);
+    HPX_TEST(r.second == ref.second);
+}
+
+void minmax_element_test()
+{
+    using namespace hpx::parallel;
+
+    test_minmax_element(execution::dataseq, 5);
+    test_minmax_element(execution::datapar, 5);
+    test_minmax_element(execution::dataseq, 100000);
+    test_minmax_element(execution::datapar, 100000);
+
+    test_minmax_element_async(execution::dataseq(execution::task));
+    test_minmax_element_async(execution::datapar(execution::task));
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    minmax_element_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,136 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/datapar.hpp>
+#include <hpx/include/parallel_reduce.hpp>
+#include <hpx/include/parallel_replace.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct is_odd
+{
+    template <typename T>
+    auto operator()(T const& t) const -> decltype((t & T(1)) == T(1))
+    {
+        return (t & T(1)) == T(1);
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename ExPolicy>
+void test_replace(ExPolicy policy)
+{
+    static_assert(
+        hpx::parallel::execution::is_execution_policy<ExPolicy>::value,
+        "hpx::parallel::execution::is_execution_policy<ExPolicy>::value");
+
+    for (std::size_t offset = 0; offset != 17; ++offset)
+    {
+        std::vector<int> c(10007 + offset);
+        std::generate(std::begin(c), std::end(c),
+            []() { return std::rand() % 10; });
+        std::vector<int> d(c);
+
+        auto first = std::begin(c) + offset;
+
+        hpx::parallel::replace(policy, first, std::end(c), 3, 42);
+        std::replace(std::begin(d) + offset, std::end(d), 3, 42);
+        HPX_TEST(c == d);
+
+        hpx::parallel::replace_if(policy, first, std::end(c), is_odd(), 43);
+        std::replace_if(std::begin(d) + offset, std::end(d), is_odd(), 43);
+        HPX_TEST(c == d);
+    }
+}
+
+template <typename ExPolicy>
+void test_reduce(ExPolicy policy)
+{
+    for (std::size_t offset = 0; offset != 17; ++offset)
+    {
+        std::vector<int> c(10007 + offset);
+        std::generate(std::begin(c), std::end(c),
+            []() { return std::rand() % 1000; });
+
+        auto first = std::begin(c) + offset;
+        int ref = std::accumulate(first, std::end(c), 0);
+
+        HPX_TEST_EQ(hpx::parallel::reduce(policy, first, std::end(c)), ref);
+        HPX_TEST_EQ(hpx::parallel::reduce(policy, first, std::end(c), 0), ref);
+    }
+}
+
+template <typename ExPolicy>
+void test_reduce_async(ExPolicy p)
+{
+    std::vector<int> c(10007);
+    std::iota(std::begin(c), std::end(c), std::rand() % 100);
+    int ref = std::accumulate(std::begin(c), std::end(c), 0);
+
+    hpx::future<int> f = hpx::parallel::reduce(p, std::begin(c), std::end(c));
+    HPX_TEST_EQ(f.get(), ref);
+}
+
+void replace_test()
+{
+    using namespace hpx::parallel;
+
+    test_replace(execution::dataseq);
+    test_replace(execution::datapar);
+
+    test_reduce(execution::dataseq);
+    test_reduce(execution::datapar);
+
+    test_reduce_async(execution::dataseq(execution::task));
+    test_reduce_async(execution::datapar(execution::task));
+}
+
+int hpx_main(boost::program_options::variables_map& vm)
+{
+    unsigned int seed = (unsigned int)std::time(nullptr);
+    if (vm.count("seed"))
+        seed = vm["seed"].as<unsigned int>();
+
+    std::cout << "using seed: " << seed << std::endl;
+    std::srand(seed);
+
+    replace_test();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // add command line option which controls the random number generator seed
+    using namespace boost::program_options;
+    options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()
+        ("seed,s", value<unsigned int>(),
+        "the random number generator seed to use for this run")
+        ;
+
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(desc_commandline, argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,119 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/parallel/datapar/simd.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace hpx::parallel::simd;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, std::size_t N>
+void test_pack()
+{
+    typedef pack<T, N> pack_type;
+    typedef mask<T, N> mask_type;
+
+    HPX_TEST_EQ(pack_type::size(), N);
+
+    alignas(pack_type) T a[N];
+    alignas(pack_type) T b[N];
+    T c[N];
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        a[i] = T(i + 1);
+        b[i] = T(2 * i + 1);
+    }
+
+    pack_type x(a, vector_aligned);
+    pack_type y(b, element_aligned);
+
+    // element-wise arithmetic, scalars are broadcast
+    pack_type z = x + y * T(2) - T(1);
+    z.copy_to(c, element_aligned);
+    for (std::size_t i = 0; i != N; ++i)
+        HPX_TEST(c[i] == T(a[i] + b[i] * 2 - 1));
+
+    // comparisons and reductions of masks
+    mask_type m = x < y;
+    HPX_TEST_EQ(popcount(m), N > 1 ? N - 1 : 0);
+    HPX_TEST_EQ(find_first_set(m), N > 1 ? std::size_t(1) : N);
+    HPX_TEST(all_of(x == x));
+    HPX_TEST(none_of(x != x));
+    HPX_TEST(!any_of(x > x));
+    HPX_TEST(all_of(!m || m));
+    HPX_TEST(all_of(mask_type(true)));
+    HPX_TEST(none_of(mask_type(false)));
+
+    pack_type lo = min(x, y);
+    pack_type hi = max(x, y);
+    pack_type sel = choose(m, y, x);
+    for (std::size_t i = 0; i != N; ++i)
+    {
+        HPX_TEST(lo[i] == (a[i] < b[i] ? a[i] : b[i]));
+        HPX_TEST(hi[i] == (a[i] < b[i] ? b[i] : a[i]));
+        HPX_TEST(sel[i] == hi[i]);
+    }
+
+    HPX_TEST(reduce(x) == T(N * (N + 1) / 2));
+
+    // masked assignment
+    pack_type w(T(3));
+    where(m, w) += x;
+    for (std::size_t i = 0; i != N; ++i)
+        HPX_TEST(w[i] == (m[i] ? T(a[i] + 3) : T(3)));
+
+    w.set(0, T(42));
+    HPX_TEST(w[0] == T(42));
+
+    pack_type zero;
+    HPX_TEST(all_of(zero == T(0)));
+}
+
+template <typename T>
+void test_integral_pack()
+{
+    typedef pack<T> pack_type;
+
+    pack_type x(T(7));
+    pack_type y = (x % T(4)) | (x << 1);
+    HPX_TEST(y[0] == T((7 % 4) | (7 << 1)));
+    HPX_TEST((~x)[0] == T(~T(7)));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    // power of two widths map onto vector types
+    test_pack<double, 1>();
+    test_pack<double, 2>();
+    test_pack<double, 4>();
+    test_pack<double, 8>();
+    test_pack<float, 4>();
+    test_pack<float, 16>();
+    test_pack<std::int32_t, 8>();
+    test_pack<std::uint8_t, 16>();
+    test_pack<std::int64_t, 4>();
+    test_pack<std::int16_t, 8>();
+
+    // all other widths and types use plain arrays
+    test_pack<long double, 2>();
+    test_pack<int, 3>();
+    test_pack<double, 3>();
+
+    // native widths
+    test_pack<double, pack<double>::size()>();
+    test_pack<float, pack<float>::size()>();
+    test_pack<unsigned char, pack<unsigned char>::size()>();
+
+    test_integral_pack<int>();
+    test_integral_pack<unsigned char>();
+    test_integral_pack<std::uint64_t>();
+
+    return hpx::util::report_errors();
+}
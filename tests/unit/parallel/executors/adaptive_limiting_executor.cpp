@@ -0,0 +1,175 @@
+//  Copyright (c) 2019 The STE||AR-Group
+//
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/hpx_init.hpp>
+#include <hpx/hpx.hpp>
+#include <hpx/include/parallel_executors.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/runtime/threads/executors/adaptive_limiting_executor.hpp>
+#include <hpx/util/lightweight_test.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef hpx::threads::executors::adaptive_limiting_executor<>
+    executor_type;
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int64_t> running(0);
+std::atomic<std::int64_t> max_running(0);
+
+int test(int passed_through)
+{
+    std::int64_t current = ++running;
+    std::int64_t max_current = max_running.load();
+    while (current > max_current &&
+        !max_running.compare_exchange_weak(max_current, current))
+    {
+    }
+
+    hpx::this_thread::yield();
+
+    --running;
+    return passed_through;
+}
+
+void test_async()
+{
+    executor_type exec;
+    HPX_TEST_EQ(
+        hpx::parallel::execution::async_execute(exec, &test, 42).get(), 42);
+    HPX_TEST_EQ(exec.get_in_flight(), std::int64_t(0));
+}
+
+void test_then()
+{
+    executor_type exec;
+    hpx::future<int> f = hpx::make_ready_future(42);
+
+    HPX_TEST_EQ(hpx::parallel::execution::then_execute(exec,
+        [](hpx::future<int> f) { return test(f.get()); }, f).get(), 42);
+}
+
+struct throw_on_copy
+{
+    throw_on_copy() = default;
+    throw_on_copy(throw_on_copy&&) = default;
+
+    throw_on_copy(throw_on_copy const&)
+    {
+        throw std::runtime_error("throw_on_copy");
+    }
+};
+
+void test_failed_submission()
+{
+    executor_type exec(1, 1, 1);
+    throw_on_copy arg;
+
+    // the slot acquired for a task which could not be submitted is given
+    // back, otherwise the next submission would block forever
+    for (int i = 0; i != 2; ++i)
+    {
+        bool caught_exception = false;
+        try {
+            hpx::parallel::execution::post(exec, [](throw_on_copy) {}, arg);
+        }
+        catch (std::runtime_error const&) {
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+        HPX_TEST_EQ(exec.get_in_flight(), std::int64_t(0));
+    }
+
+    HPX_TEST_EQ(
+        hpx::parallel::execution::async_execute(exec, &test, 42).get(), 42);
+}
+
+void test_limit()
+{
+    std::size_t const max_limit = 8;
+    max_running = 0;
+
+    {
+        executor_type exec(4, 2, max_limit);
+        for (int i = 0; i != 10000; ++i)
+            hpx::parallel::execution::post(exec, &test, i);
+
+        // the limit always stays within the given bounds
+        HPX_TEST(exec.get_limit() >= 2);
+        HPX_TEST(exec.get_limit() <= std::int64_t(max_limit));
+    }
+
+    // the destructor has waited for all tasks to finish
+    HPX_TEST_EQ(running.load(), std::int64_t(0));
+    HPX_TEST(max_running.load() <= std::int64_t(max_limit));
+}
+
+void test_counters()
+{
+    {
+        executor_type exec(16, 1, 1024, "test");
+        for (int i = 0; i != 1000; ++i)
+            hpx::parallel::execution::post(exec, &test, i);
+        exec.wait();
+
+        hpx::performance_counters::performance_counter limit(
+            "/adaptive_limiting_executor{locality#0/total}/test/limit");
+        HPX_TEST_EQ(limit.get_value<std::int64_t>().get(), exec.get_limit());
+
+        hpx::performance_counters::performance_counter in_flight(
+            "/adaptive_limiting_executor{locality#0/total}/test/count/in-flight");
+        HPX_TEST_EQ(in_flight.get_value<std::int64_t>().get(), std::int64_t(0));
+
+        hpx::performance_counters::performance_counter delay(
+            "/adaptive_limiting_executor{locality#0/total}/test/queueing-delay");
+        HPX_TEST(delay.get_value<std::int64_t>().get() >= 0);
+
+        // the name of the counters has to be unique
+        bool caught_exception = false;
+        try {
+            executor_type duplicate(16, 1, 1024, "test");
+        }
+        catch (hpx::exception const& e) {
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    // the counter types are removed together with the executor
+    executor_type exec(16, 1, 1024, "test");
+    HPX_TEST_EQ(exec.get_in_flight(), std::int64_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(int argc, char* argv[])
+{
+    test_async();
+    test_then();
+    test_failed_submission();
+    test_limit();
+    test_counters();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // By default this test should run on all available cores
+    std::vector<std::string> const cfg = {
+        "hpx.os_threads=all"
+    };
+
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, cfg), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -15,10 +15,12 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <numeric>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -131,6 +133,104 @@ void test_persistent_auto_chunk_size()
     }
 }
 
+void test_adaptive_chunk_size()
+{
+    {
+        hpx::parallel::execution::adaptive_chunk_size acs;
+        parameters_test(acs);
+    }
+
+    {
+        // repeated invocations for the same loop shape converge on one of
+        // the candidates
+        hpx::parallel::execution::adaptive_chunk_size acs;
+
+        std::vector<std::size_t> c(10007);
+        for (int i = 0; i != 200; ++i)
+        {
+            hpx::parallel::for_each(
+                hpx::parallel::execution::par.with(acs),
+                std::begin(c), std::end(c),
+                [](std::size_t& v) { ++v; });
+        }
+        HPX_TEST(std::all_of(std::begin(c), std::end(c),
+            [](std::size_t v) { return v == 200; }));
+
+        std::size_t const cores = hpx::get_os_thread_count();
+        std::size_t chunks = acs.learned_chunks_per_core(cores, c.size());
+        HPX_TEST(chunks >= 1 && chunks <= 64);
+        HPX_TEST_EQ(chunks & (chunks - 1), std::size_t(0));
+
+        // the learned values can be stored and reloaded
+        std::stringstream strm;
+        acs.save(strm);
+
+        hpx::parallel::execution::adaptive_chunk_size reloaded(strm);
+        HPX_TEST_EQ(reloaded.learned_chunks_per_core(cores, c.size()), chunks);
+
+        std::stringstream invalid("invalid");
+        HPX_TEST(!reloaded.load(invalid));
+        HPX_TEST_EQ(reloaded.learned_chunks_per_core(cores, c.size()), chunks);
+    }
+
+    {
+        // the best candidate moves to the fastest measured neighbor
+        typedef hpx::parallel::execution::detail::adaptive_chunk_size_bucket
+            bucket_type;
+
+        // time per iteration of the candidates (1, 2, 4, ..., 64 chunks per
+        // core), 8 chunks per core are the fastest
+        double times[bucket_type::num_candidates] =
+            { 100.0, 90.0, 80.0, 50.0, 70.0, 90.0, 100.0 };
+
+        bucket_type b;
+        HPX_TEST_EQ(bucket_type::chunks_per_core(b.best_), std::size_t(4));
+
+        for (int i = 0; i != 12; ++i)
+        {
+            std::size_t const idx = b.next_candidate();
+            b.record(idx, times[idx], -1.0, -1.0, 0.0);
+        }
+        HPX_TEST_EQ(bucket_type::chunks_per_core(b.best_), std::size_t(8));
+
+        // the neighbors have been measured, the best candidate is kept
+        for (int i = 0; i != 12; ++i)
+        {
+            std::size_t const idx = b.next_candidate();
+            b.record(idx, times[idx], -1.0, -1.0, 0.0);
+        }
+        HPX_TEST_EQ(bucket_type::chunks_per_core(b.best_), std::size_t(8));
+
+        // a neighbor which became faster takes over
+        for (int i = 0; i != 3; ++i)
+            b.record(4, 10.0, -1.0, -1.0, 0.0);
+        HPX_TEST_EQ(bucket_type::chunks_per_core(b.best_), std::size_t(16));
+    }
+
+    {
+        // the learned values are read from a prepared state, 32 chunks per
+        // core for 4 cores and 2^10 iterations
+        std::stringstream strm(
+            "adaptive_chunk_size 1\n"
+            "4 10 5 0 0 0 0 0 0 3 2.5 3 1.5 3 2.0 0 0\n");
+
+        hpx::parallel::execution::adaptive_chunk_size acs(strm);
+        HPX_TEST_EQ(acs.learned_chunks_per_core(4, 1024), std::size_t(32));
+        HPX_TEST_EQ(acs.learned_chunks_per_core(4, 2047), std::size_t(32));
+
+        // other loop shapes use the default
+        HPX_TEST_EQ(acs.learned_chunks_per_core(4, 4096), std::size_t(4));
+        HPX_TEST_EQ(acs.learned_chunks_per_core(8, 1024), std::size_t(4));
+
+        // an invalid best candidate is rejected
+        std::stringstream invalid(
+            "adaptive_chunk_size 1\n"
+            "4 10 7 0 0 0 0 0 0 0 0 0 0 0 0 0 0\n");
+        HPX_TEST(!acs.load(invalid));
+        HPX_TEST_EQ(acs.learned_chunks_per_core(4, 1024), std::size_t(32));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 struct timer_hooks_parameters
 {
@@ -188,6 +288,7 @@ int hpx_main(boost::program_options::variables_map& vm)
     test_guided_chunk_size();
     test_auto_chunk_size();
     test_persistent_auto_chunk_size();
+    test_adaptive_chunk_size();
 
     test_combined_hooks();
 